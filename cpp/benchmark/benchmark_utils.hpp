@@ -0,0 +1,148 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_BENCHMARK_BENCHMARK_UTILS_HPP_
+#define CYLON_CPP_BENCHMARK_BENCHMARK_UTILS_HPP_
+
+#include <benchmark/benchmark.h>
+#include <arrow/api.h>
+#include <arrow/compute/api.h>
+
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/table.hpp>
+#include <cylon/util/arrow_rand.hpp>
+
+namespace cylon {
+namespace bench {
+
+/**
+ * Aborts the benchmark on a failed status
+ */
+#define CHECK_BENCHMARK_STATUS(state, expr)                     \
+  do {                                                          \
+    const auto &_st = (expr);                                   \
+    if (!_st.is_ok()) {                                         \
+      (state).SkipWithError(_st.get_msg().c_str());             \
+      return;                                                   \
+    }                                                           \
+  } while (0)
+
+#define CHECK_BENCHMARK_ARROW_STATUS(state, expr)               \
+  do {                                                          \
+    const auto &_st = (expr);                                   \
+    if (!_st.ok()) {                                            \
+      (state).SkipWithError(_st.ToString().c_str());            \
+      return;                                                   \
+    }                                                           \
+  } while (0)
+
+inline const std::shared_ptr<CylonContext> &Context() {
+  static const auto ctx = CylonContext::Init();
+  return ctx;
+}
+
+/**
+ * The arguments of a benchmark: the number of rows, the number of distinct keys as a percentage
+ * of the rows, and the percentage of null keys
+ */
+struct BenchmarkArgs {
+  explicit BenchmarkArgs(const benchmark::State &state)
+      : rows(state.range(0)),
+        cardinality(std::max<int64_t>(1, state.range(0) * state.range(1) / 100)),
+        null_ratio(static_cast<double>(state.range(2)) / 100) {}
+
+  int64_t rows;
+  int64_t cardinality;
+  double null_ratio;
+};
+
+inline void DefaultArgs(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"rows", "distinct%", "null%"})
+      ->ArgsProduct({{1 << 16, 1 << 20}, {1, 100}, {0, 10}})
+      ->Unit(benchmark::kMillisecond);
+}
+
+/**
+ * Random array of a type, with values of cardinality distinct keys. Keys are ints in
+ * [0, cardinality), cast to numeric types or formatted for string types.
+ * @param type
+ * @param rows
+ * @param cardinality
+ * @param null_ratio
+ * @param seed
+ * @param out
+ * @return
+ */
+inline arrow::Status RandomArray(const std::shared_ptr<arrow::DataType> &type, int64_t rows,
+                                 int64_t cardinality, double null_ratio, uint32_t seed,
+                                 std::shared_ptr<arrow::Array> *out) {
+  RandomArrayGenerator gen(seed);
+  const auto &keys = std::static_pointer_cast<arrow::Int64Array>(
+      gen.Numeric<arrow::Int64Type>(rows, 0, cardinality - 1, null_ratio));
+
+  if (type->id() == arrow::Type::STRING) {
+    arrow::StringBuilder builder;
+    ARROW_RETURN_NOT_OK(builder.Reserve(rows));
+    for (int64_t i = 0; i < rows; i++) {
+      if (keys->IsNull(i)) {
+        ARROW_RETURN_NOT_OK(builder.AppendNull());
+      } else {
+        ARROW_RETURN_NOT_OK(builder.Append("key_" + std::to_string(keys->Value(i))));
+      }
+    }
+    return builder.Finish(out);
+  }
+  ARROW_ASSIGN_OR_RAISE(*out, arrow::compute::Cast(*keys, type))
+  return arrow::Status::OK();
+}
+
+/**
+ * Random table of key columns of a type, and a double value column
+ * @param type
+ * @param num_keys
+ * @param args
+ * @param seed
+ * @param out
+ * @return
+ */
+inline arrow::Status RandomTable(const std::shared_ptr<arrow::DataType> &type, int num_keys,
+                                 const BenchmarkArgs &args, uint32_t seed,
+                                 std::shared_ptr<Table> *out) {
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (int i = 0; i < num_keys; i++) {
+    std::shared_ptr<arrow::Array> keys;
+    ARROW_RETURN_NOT_OK(RandomArray(type, args.rows, args.cardinality, args.null_ratio,
+                                    seed + i, &keys));
+    fields.push_back(arrow::field("key" + std::to_string(i), type));
+    arrays.push_back(std::move(keys));
+  }
+  RandomArrayGenerator gen(seed + num_keys);
+  fields.push_back(arrow::field("value", arrow::float64()));
+  arrays.push_back(gen.Numeric<arrow::DoubleType>(args.rows, 0, 1));
+
+  *out = std::make_shared<Table>(Context(),
+                                 arrow::Table::Make(arrow::schema(fields), arrays));
+  return arrow::Status::OK();
+}
+
+template<typename ArrowType>
+std::shared_ptr<arrow::DataType> TypeOf() {
+  return arrow::TypeTraits<ArrowType>::type_singleton();
+}
+
+}  // namespace bench
+}  // namespace cylon
+
+#endif //CYLON_CPP_BENCHMARK_BENCHMARK_UTILS_HPP_
@@ -0,0 +1,83 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cylon/groupby/hash_groupby.hpp>
+#include <cylon/mapreduce/mapreduce.hpp>
+#include <cylon/table.hpp>
+
+#include "benchmark_utils.hpp"
+
+namespace cylon {
+namespace bench {
+
+template<typename ArrowType>
+static void BM_HashGroupBy(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 1, args, 0, &table));
+
+  for (auto _: state) {
+    std::shared_ptr<Table> output;
+    CHECK_BENCHMARK_STATUS(state, HashGroupBy(table, {0}, {{1, compute::SUM}, {1, compute::MAX}},
+                                              output));
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+template<typename ArrowType>
+static void BM_MapredHashGroupBy(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 1, args, 0, &table));
+
+  for (auto _: state) {
+    std::shared_ptr<Table> output;
+    CHECK_BENCHMARK_STATUS(state, mapred::MapredHashGroupBy(
+        table, {0}, {{1, compute::SUM}, {1, compute::MEAN}}, &output));
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+template<typename ArrowType>
+static void BM_Unique(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 2, args, 0, &table));
+
+  for (auto _: state) {
+    std::shared_ptr<Table> output;
+    CHECK_BENCHMARK_STATUS(state, Unique(table, {0, 1}, output, true));
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+BENCHMARK_TEMPLATE(BM_HashGroupBy, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashGroupBy, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashGroupBy, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashGroupBy, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_MapredHashGroupBy, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_MapredHashGroupBy, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_MapredHashGroupBy, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_MapredHashGroupBy, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_Unique, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_Unique, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_Unique, arrow::StringType)->Apply(DefaultArgs);
+
+}  // namespace bench
+}  // namespace cylon
@@ -0,0 +1,66 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cylon/join/hash_join.hpp>
+#include <cylon/join/sort_join.hpp>
+
+#include "benchmark_utils.hpp"
+
+namespace cylon {
+namespace bench {
+
+template<typename ArrowType, join::config::JoinAlgorithm algorithm>
+static void BM_Join(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> left, right;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 1, args, 0, &left));
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 1, args, 100, &right));
+  const auto &config = join::config::JoinConfig::InnerJoin(0, 0, algorithm);
+
+  int64_t output_rows = 0;
+  for (auto _: state) {
+    std::shared_ptr<arrow::Table> joined;
+    if (algorithm == join::config::HASH) {
+      CHECK_BENCHMARK_STATUS(state, join::HashJoin(left->get_table(), right->get_table(), config,
+                                                   &joined, arrow::default_memory_pool()));
+    } else {
+      CHECK_BENCHMARK_STATUS(state, join::SortJoin(left->get_table(), right->get_table(), config,
+                                                   &joined, arrow::default_memory_pool()));
+    }
+    output_rows = joined->num_rows();
+    benchmark::DoNotOptimize(joined);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows * 2);
+  state.counters["output_rows"] = static_cast<double>(output_rows);
+}
+
+static void JoinArgs(benchmark::internal::Benchmark *b) {
+  // 100% distinct keys, so that the output is about the size of the inputs
+  b->ArgNames({"rows", "distinct%", "null%"})
+      ->ArgsProduct({{1 << 16, 1 << 20}, {100}, {0, 10}})
+      ->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK_TEMPLATE(BM_Join, arrow::Int32Type, join::config::HASH)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::Int64Type, join::config::HASH)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::DoubleType, join::config::HASH)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::StringType, join::config::HASH)->Apply(JoinArgs);
+
+BENCHMARK_TEMPLATE(BM_Join, arrow::Int32Type, join::config::SORT)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::Int64Type, join::config::SORT)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::DoubleType, join::config::SORT)->Apply(JoinArgs);
+BENCHMARK_TEMPLATE(BM_Join, arrow::StringType, join::config::SORT)->Apply(JoinArgs);
+
+}  // namespace bench
+}  // namespace cylon
@@ -0,0 +1,245 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Number of messages and latency of a shuffle of a wide table over MPI, for eager packet sizes of
+ * the MPI channel (channel_eager_bytes, 0 sends a header and a data message per buffer).
+ *
+ * Messages are counted by intercepting MPI_Isend through the MPI profiling interface. Rank 0
+ * writes a JSON of the messages sent by all ranks and the time of the slowest rank, per iteration.
+ *
+ * mpirun -np 4 ./message_benchmark --rows 10000 --columns 32 --eager 0,4096,65536 \
+ *    --out messages_4.json
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <mpi.h>
+#include <glog/logging.h>
+
+#include <cylon/arrow/arrow_all_to_all.hpp>
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/net/mpi/mpi_communicator.hpp>
+#include <cylon/net/ops/all_to_all.hpp>
+#include <cylon/table.hpp>
+#include <cylon/util/arrow_rand.hpp>
+#include <cylon/util/macros.hpp>
+
+namespace {
+std::atomic<int64_t> isend_count{0};
+}  // namespace
+
+/**
+ * Counts the point to point messages of the channels
+ */
+extern "C" int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag,
+                         MPI_Comm comm, MPI_Request *request) {
+  isend_count.fetch_add(1, std::memory_order_relaxed);
+  return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+namespace cylon {
+namespace bench {
+
+struct MessageConfig {
+  int64_t rows = 10000;
+  int columns = 32;
+  std::vector<int64_t> eager{0, 4096, 65536};
+  // send a frame per table instead of a message per buffer, see kArrowAllToAllFramesConfig
+  bool frames = false;
+  int iterations = 5;
+  int warmup = 1;
+  uint32_t seed = 0;
+  std::string out = "messages.json";
+};
+
+struct MessageResult {
+  int64_t eager;
+  int iteration;
+  int64_t messages;
+  int64_t time_us;
+};
+
+void PrintUsage() {
+  std::cerr << "message_benchmark [--rows n] [--columns n] [--eager b0,b1,..] [--frames true|false]"
+            << std::endl
+            << "    [--iterations n] [--warmup n] [--seed s] [--out results.json]" << std::endl;
+}
+
+Status ParseArgs(int argc, char *argv[], MessageConfig *config) {
+  for (int i = 1; i < argc; i += 2) {
+    const std::string arg = argv[i];
+    if (i + 1 == argc) {
+      return {Code::Invalid, "missing value of " + arg};
+    }
+    const std::string val = argv[i + 1];
+    if (arg == "--rows") {
+      config->rows = std::stoll(val);
+    } else if (arg == "--columns") {
+      config->columns = std::stoi(val);
+    } else if (arg == "--eager") {
+      config->eager.clear();
+      std::stringstream ss(val);
+      std::string part;
+      while (std::getline(ss, part, ',')) {
+        if (!part.empty()) {
+          config->eager.push_back(std::stoll(part));
+        }
+      }
+    } else if (arg == "--frames") {
+      config->frames = val == "true";
+    } else if (arg == "--iterations") {
+      config->iterations = std::stoi(val);
+    } else if (arg == "--warmup") {
+      config->warmup = std::stoi(val);
+    } else if (arg == "--seed") {
+      config->seed = static_cast<uint32_t>(std::stoul(val));
+    } else if (arg == "--out") {
+      config->out = val;
+    } else {
+      return {Code::Invalid, "unknown argument " + arg};
+    }
+  }
+  if (config->columns < 1) {
+    return {Code::Invalid, "columns should be positive"};
+  }
+  return Status::OK();
+}
+
+/**
+ * A key column and columns-1 value columns, alternating int64, double and boolean columns
+ */
+Status MakeTable(const std::shared_ptr<CylonContext> &ctx, const MessageConfig &config,
+                 std::shared_ptr<Table> *out) {
+  RandomArrayGenerator gen(config.seed + ctx->GetRank(), ToArrowPool(ctx));
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (int c = 0; c < config.columns; c++) {
+    const auto name = "c" + std::to_string(c);
+    if (c % 3 == 0) {
+      fields.push_back(arrow::field(name, arrow::int64()));
+      arrays.push_back(gen.Numeric<arrow::Int64Type>(config.rows, 0, config.rows, 0.1));
+    } else if (c % 3 == 1) {
+      fields.push_back(arrow::field(name, arrow::float64()));
+      arrays.push_back(gen.Numeric<arrow::DoubleType>(config.rows, 0, 1));
+    } else {
+      fields.push_back(arrow::field(name, arrow::boolean()));
+      arrays.push_back(gen.Boolean(config.rows, 0.5, 0.1));
+    }
+  }
+  return Table::FromArrowTable(ctx, arrow::Table::Make(arrow::schema(fields), arrays), *out);
+}
+
+Status WriteJson(const MessageConfig &config, int world,
+                 const std::vector<MessageResult> &results) {
+  std::ofstream out(config.out);
+  if (!out) {
+    return {Code::IOError, "unable to open " + config.out};
+  }
+  out << "{\n"
+      << "  \"world_size\": " << world << ",\n"
+      << "  \"rows\": " << config.rows << ",\n"
+      << "  \"columns\": " << config.columns << ",\n"
+      << "  \"frames\": " << (config.frames ? "true" : "false") << ",\n"
+      << "  \"seed\": " << config.seed << ",\n"
+      << "  \"results\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto &result = results[i];
+    out << (i == 0 ? "\n" : ",\n")
+        << "    {\"eager_bytes\": " << result.eager << ", \"iteration\": " << result.iteration
+        << ", \"messages\": " << result.messages << ", \"time_us\": " << result.time_us << "}";
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+  if (!out) {
+    return {Code::IOError, "unable to write " + config.out};
+  }
+  return Status::OK();
+}
+
+Status RunMessages(const std::shared_ptr<CylonContext> &ctx, const MessageConfig &config) {
+  std::shared_ptr<Table> table;
+  RETURN_CYLON_STATUS_IF_FAILED(MakeTable(ctx, config, &table));
+  ctx->AddConfig(kArrowAllToAllFramesConfig, config.frames ? "true" : "false");
+
+  std::vector<MessageResult> results;
+  for (const auto eager: config.eager) {
+    ctx->AddConfig(kChannelEagerBytesConfig, std::to_string(eager));
+    for (int i = -config.warmup; i < config.iterations; i++) {
+      std::shared_ptr<Table> out;
+      ctx->Barrier();
+      isend_count.store(0);
+      const auto start = std::chrono::steady_clock::now();
+      RETURN_CYLON_STATUS_IF_FAILED(Shuffle(table, {0}, out));
+      const int64_t time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start).count();
+      const int64_t messages = isend_count.load();
+      if (i < 0) {
+        continue;
+      }
+
+      int64_t max_time_us = 0, total_messages = 0;
+      MPI_Reduce(&time_us, &max_time_us, 1, MPI_INT64_T, MPI_MAX, 0, MPI_COMM_WORLD);
+      MPI_Reduce(&messages, &total_messages, 1, MPI_INT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+      if (ctx->GetRank() == 0) {
+        LOG(INFO) << "eager " << eager << " iteration " << i << ": " << total_messages
+                  << " messages " << max_time_us << "[us]";
+        results.push_back({eager, i, total_messages, max_time_us});
+      }
+    }
+  }
+  ctx->AddConfig(kChannelEagerBytesConfig, "");
+  ctx->AddConfig(kArrowAllToAllFramesConfig, "");
+
+  if (ctx->GetRank() == 0) {
+    RETURN_CYLON_STATUS_IF_FAILED(WriteJson(config, ctx->GetWorldSize(), results));
+    LOG(INFO) << "results written to " << config.out;
+  }
+  return Status::OK();
+}
+
+}  // namespace bench
+}  // namespace cylon
+
+int main(int argc, char *argv[]) {
+  cylon::bench::MessageConfig config;
+  auto status = cylon::bench::ParseArgs(argc, argv, &config);
+  if (!status.is_ok()) {
+    LOG(ERROR) << status.get_msg();
+    cylon::bench::PrintUsage();
+    return 1;
+  }
+
+  std::shared_ptr<cylon::CylonContext> ctx;
+  status = cylon::CylonContext::InitDistributed(cylon::net::MPIConfig::Make(), &ctx);
+  if (!status.is_ok()) {
+    LOG(ERROR) << "context initialization failed: " << status.get_msg();
+    return 1;
+  }
+
+  status = cylon::bench::RunMessages(ctx, config);
+  if (!status.is_ok()) {
+    LOG(ERROR) << "message benchmark failed: " << status.get_msg();
+    ctx->Finalize();
+    return 1;
+  }
+  ctx->Finalize();
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+
+#include <cylon/arrow/arrow_partition_kernels.hpp>
+#include <cylon/util/arrow_utils.hpp>
+#include <cylon/util/flatten_array.hpp>
+
+#include "benchmark_utils.hpp"
+
+namespace cylon {
+namespace bench {
+
+static constexpr uint32_t kNumPartitions = 16;
+
+template<typename ArrowType>
+static void BM_HashPartition(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<arrow::Array> values;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomArray(TypeOf<ArrowType>(), args.rows, args.cardinality,
+                                                  args.null_ratio, 0, &values));
+  std::unique_ptr<HashPartitionKernel> kernel;
+  CHECK_BENCHMARK_STATUS(state, CreateHashPartitionKernel(values->type(), &kernel));
+
+  for (auto _: state) {
+    std::vector<uint32_t> targets, histogram;
+    CHECK_BENCHMARK_STATUS(state, kernel->Partition(values, kNumPartitions, targets, histogram));
+    benchmark::DoNotOptimize(targets);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+template<typename ArrowType>
+static void BM_FlattenArrays(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 2, args, 0, &table));
+  // columns of RandomTable have a single chunk
+  const std::vector<std::shared_ptr<arrow::Array>>
+      arrays{table->get_table()->column(0)->chunk(0), table->get_table()->column(1)->chunk(0)};
+
+  for (auto _: state) {
+    std::shared_ptr<FlattenedArray> flattened;
+    CHECK_BENCHMARK_STATUS(state, FlattenArrays(Context().get(), arrays, &flattened));
+    benchmark::DoNotOptimize(flattened);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+template<typename ArrowType>
+static void BM_CopyArrayByIndices(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<arrow::Array> values;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomArray(TypeOf<ArrowType>(), args.rows, args.cardinality,
+                                                  args.null_ratio, 0, &values));
+  // a random permutation of half of the rows
+  std::vector<int64_t> indices(args.rows / 2);
+  std::mt19937 rng(0);
+  std::uniform_int_distribution<int64_t> dist(0, args.rows - 1);
+  for (auto &i: indices) {
+    i = dist(rng);
+  }
+
+  for (auto _: state) {
+    std::shared_ptr<arrow::Array> copied;
+    CHECK_BENCHMARK_ARROW_STATUS(state, util::copy_array_by_indices(indices, values, &copied));
+    benchmark::DoNotOptimize(copied);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_HashPartition, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashPartition, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashPartition, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_HashPartition, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_FlattenArrays, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_FlattenArrays, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_FlattenArrays, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_CopyArrayByIndices, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_CopyArrayByIndices, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_CopyArrayByIndices, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_CopyArrayByIndices, arrow::StringType)->Apply(DefaultArgs);
+
+}  // namespace bench
+}  // namespace cylon
@@ -0,0 +1,453 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Weak/ strong scaling of the distributed operators.
+ *
+ * Each rank generates its own random tables, runs the operators and times them with the trace spans
+ * of the operator phases. The spans of all ranks are gathered to rank 0, which writes a JSON of the
+ * time of each operator and of its phases on each rank.
+ *
+ * mpirun -np 4 ./scaling_benchmark --ops join,sort,groupby,shuffle,repartition \
+ *    --scaling weak --rows 1000000 --out scaling_4.json
+ *
+ * With gloo (-DCYLON_GLOO=ON), ranks can rendezvous through a file store instead of mpirun:
+ * for r in 0 1 2 3; do
+ *    ./scaling_benchmark --comm gloo --rank $r --world 4 --store /tmp/gloo --out scaling_4.json &
+ * done
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include <glog/logging.h>
+
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/groupby/groupby.hpp>
+#include <cylon/net/mpi/mpi_communicator.hpp>
+#include <cylon/table.hpp>
+#include <cylon/util/arrow_rand.hpp>
+#include <cylon/util/macros.hpp>
+#include <cylon/util/trace.hpp>
+
+#ifdef BUILD_CYLON_GLOO
+#include <cylon/net/gloo/gloo_communicator.hpp>
+#endif
+
+namespace cylon {
+namespace bench {
+
+struct ScalingConfig {
+  std::string comm = "mpi";
+  // gloo file store
+  int rank = -1;
+  int world = -1;
+  std::string store = "/tmp/gloo";
+  std::string prefix = "cylon_scaling";
+
+  std::vector<std::string> ops{"join", "sort", "groupby", "shuffle", "repartition"};
+  // weak: rows per rank, strong: rows in total
+  std::string scaling = "weak";
+  int64_t rows = 1 << 20;
+  // distinct keys, as a fraction of the total rows
+  double distinct = 0.5;
+  // fraction of the rows with the same (hot) key
+  double key_skew = 0;
+  // rank r gets (1 + rank_skew * r / (world - 1)) times the rows of rank 0, before normalizing
+  double rank_skew = 0;
+  int iterations = 3;
+  int warmup = 1;
+  uint32_t seed = 0;
+  std::string out = "scaling.json";
+};
+
+void PrintUsage() {
+  std::cerr << "scaling_benchmark [--comm mpi|gloo] [--rank r --world w --store path --prefix p]"
+            << std::endl
+            << "    [--ops join,sort,groupby,shuffle,repartition] [--scaling weak|strong]"
+            << std::endl
+            << "    [--rows n] [--distinct 0.0-1.0] [--key-skew 0.0-1.0] [--rank-skew f]"
+            << std::endl
+            << "    [--iterations n] [--warmup n] [--seed s] [--out results.json]" << std::endl;
+}
+
+std::vector<std::string> Split(const std::string &str, char delim) {
+  std::vector<std::string> parts;
+  std::stringstream ss(str);
+  std::string part;
+  while (std::getline(ss, part, delim)) {
+    if (!part.empty()) {
+      parts.push_back(part);
+    }
+  }
+  return parts;
+}
+
+Status ParseArgs(int argc, char *argv[], ScalingConfig *config) {
+  for (int i = 1; i < argc; i += 2) {
+    const std::string arg = argv[i];
+    if (i + 1 == argc) {
+      return {Code::Invalid, "missing value of " + arg};
+    }
+    const std::string val = argv[i + 1];
+    if (arg == "--comm") {
+      config->comm = val;
+    } else if (arg == "--rank") {
+      config->rank = std::stoi(val);
+    } else if (arg == "--world") {
+      config->world = std::stoi(val);
+    } else if (arg == "--store") {
+      config->store = val;
+    } else if (arg == "--prefix") {
+      config->prefix = val;
+    } else if (arg == "--ops") {
+      config->ops = Split(val, ',');
+    } else if (arg == "--scaling") {
+      config->scaling = val;
+    } else if (arg == "--rows") {
+      config->rows = std::stoll(val);
+    } else if (arg == "--distinct") {
+      config->distinct = std::stod(val);
+    } else if (arg == "--key-skew") {
+      config->key_skew = std::stod(val);
+    } else if (arg == "--rank-skew") {
+      config->rank_skew = std::stod(val);
+    } else if (arg == "--iterations") {
+      config->iterations = std::stoi(val);
+    } else if (arg == "--warmup") {
+      config->warmup = std::stoi(val);
+    } else if (arg == "--seed") {
+      config->seed = static_cast<uint32_t>(std::stoul(val));
+    } else if (arg == "--out") {
+      config->out = val;
+    } else {
+      return {Code::Invalid, "unknown argument " + arg};
+    }
+  }
+  if (config->scaling != "weak" && config->scaling != "strong") {
+    return {Code::Invalid, "scaling should be weak or strong: " + config->scaling};
+  }
+  return Status::OK();
+}
+
+Status InitContext(const ScalingConfig &config, std::shared_ptr<CylonContext> *ctx) {
+  if (config.comm == "mpi") {
+    return CylonContext::InitDistributed(net::MPIConfig::Make(), ctx);
+  }
+#ifdef BUILD_CYLON_GLOO
+  if (config.comm == "gloo") {
+    if (config.rank < 0 || config.world <= 0) {
+      return {Code::Invalid, "gloo requires --rank and --world"};
+    }
+    auto gloo_config = std::make_shared<net::GlooConfig>(config.rank, config.world);
+    gloo_config->SetFileStorePath(config.store);
+    gloo_config->SetStorePrefix(config.prefix);
+    return CylonContext::InitDistributed(gloo_config, ctx);
+  }
+#endif
+  return {Code::Invalid, "unsupported comm: " + config.comm};
+}
+
+/**
+ * Rows of this rank: rows per rank for weak scaling, a share of the rows for strong scaling,
+ * weighted by the rank skew
+ */
+int64_t LocalRows(const ScalingConfig &config, int rank, int world) {
+  const auto total = config.scaling == "weak" ? config.rows * world : config.rows;
+  std::vector<double> weights(world);
+  for (int r = 0; r < world; r++) {
+    weights[r] = 1 + (world > 1 ? config.rank_skew * r / (world - 1) : 0);
+  }
+  const double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+  return static_cast<int64_t>(static_cast<double>(total) * weights[rank] / sum);
+}
+
+/**
+ * Table of (key: int64, value: double). Keys are uniform in [0, distinct * total rows), except for
+ * key_skew of the rows, which have the key 0.
+ */
+Status MakeTable(const std::shared_ptr<CylonContext> &ctx, const ScalingConfig &config,
+                 uint32_t seed, std::shared_ptr<Table> *out) {
+  const int world = ctx->GetWorldSize(), rank = ctx->GetRank();
+  const auto rows = LocalRows(config, rank, world);
+  const auto total = config.scaling == "weak" ? config.rows * world : config.rows;
+  const auto max_key = std::max<int64_t>(1, static_cast<int64_t>(config.distinct * total)) - 1;
+
+  RandomArrayGenerator gen(seed + rank, ToArrowPool(ctx));
+  auto keys = gen.Numeric<arrow::Int64Type>(rows, 0, max_key);
+  auto values = gen.Numeric<arrow::DoubleType>(rows, 0, 1);
+
+  if (config.key_skew > 0) {
+    auto *data = keys->data()->GetMutableValues<int64_t>(1);
+    std::mt19937 rng(seed + rank);
+    std::bernoulli_distribution hot(config.key_skew);
+    for (int64_t i = 0; i < rows; i++) {
+      if (hot(rng)) {
+        data[i] = 0;
+      }
+    }
+  }
+
+  auto schema = arrow::schema({arrow::field("key", arrow::int64()),
+                               arrow::field("value", arrow::float64())});
+  return Table::FromArrowTable(ctx, arrow::Table::Make(schema, {keys, values}), *out);
+}
+
+/**
+ * Runs an operator, and returns the rows of the output
+ */
+Status RunOp(const std::string &op, const std::shared_ptr<Table> &left,
+             const std::shared_ptr<Table> &right, int64_t *out_rows) {
+  std::shared_ptr<Table> output;
+  if (op == "join") {
+    trace::Span span("bench.join");
+    const auto &config = join::config::JoinConfig::InnerJoin(0, 0, join::config::HASH);
+    RETURN_CYLON_STATUS_IF_FAILED(DistributedJoin(left, right, config, output));
+  } else if (op == "sort") {
+    trace::Span span("bench.sort");
+    RETURN_CYLON_STATUS_IF_FAILED(DistributedSort(left, 0, output, true));
+  } else if (op == "groupby") {
+    trace::Span span("bench.groupby");
+    auto table = left;
+    RETURN_CYLON_STATUS_IF_FAILED(
+        DistributedHashGroupBy(table, 0, {1, 1}, {compute::SUM, compute::MAX}, output));
+  } else if (op == "shuffle") {
+    trace::Span span("bench.shuffle");
+    RETURN_CYLON_STATUS_IF_FAILED(Shuffle(left, {0}, output));
+  } else if (op == "repartition") {
+    trace::Span span("bench.repartition");
+    RETURN_CYLON_STATUS_IF_FAILED(Repartition(left, &output));
+  } else {
+    return {Code::Invalid, "unknown op: " + op};
+  }
+  *out_rows = output->Rows();
+  return Status::OK();
+}
+
+/**
+ * Gathers a row of counts from each rank to rank 0, in the order of the ranks
+ */
+Status GatherCounts(const std::shared_ptr<CylonContext> &ctx, const std::vector<int64_t> &counts,
+                    std::vector<std::vector<int64_t>> *out) {
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (size_t i = 0; i < counts.size(); i++) {
+    arrow::Int64Builder builder;
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.Append(counts[i]));
+    CYLON_ASSIGN_OR_RAISE(auto array, builder.Finish())
+    fields.push_back(arrow::field("c" + std::to_string(i), arrow::int64()));
+    arrays.push_back(std::move(array));
+  }
+  std::shared_ptr<Table> local;
+  RETURN_CYLON_STATUS_IF_FAILED(
+      Table::FromArrowTable(ctx, arrow::Table::Make(arrow::schema(fields), arrays), local));
+
+  std::vector<std::shared_ptr<Table>> tables{local};
+  if (ctx->GetWorldSize() > 1) {
+    tables.clear();
+    RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->Gather(local, 0, true, &tables));
+  }
+  out->clear();
+  for (const auto &t: tables) {
+    std::vector<int64_t> row;
+    for (const auto &col: t->get_table()->columns()) {
+      row.push_back(std::static_pointer_cast<arrow::Int64Array>(col->chunk(0))->Value(0));
+    }
+    out->push_back(std::move(row));
+  }
+  return Status::OK();
+}
+
+struct RankResult {
+  int64_t rows_in = 0;
+  int64_t rows_out = 0;
+  int64_t time_us = 0;
+  // total time of each phase (span name) of the operator
+  std::map<std::string, int64_t> phases;
+  std::map<std::string, int64_t> phase_bytes;
+};
+
+struct OpResult {
+  std::string op;
+  int iteration;
+  std::vector<RankResult> ranks;
+};
+
+/**
+ * Sums the gathered spans of an operator run by rank and phase
+ */
+Status CollectSpans(const std::shared_ptr<Table> &spans, const std::string &op,
+                    std::vector<RankResult> *ranks) {
+  CYLON_ASSIGN_OR_RAISE(auto table, spans->get_table()->CombineChunks())
+  if (table->num_rows() == 0) {
+    return Status::OK();
+  }
+  const auto &rank = std::static_pointer_cast<arrow::Int32Array>(table->column(0)->chunk(0));
+  const auto &name = std::static_pointer_cast<arrow::StringArray>(table->column(1)->chunk(0));
+  const auto &duration = std::static_pointer_cast<arrow::Int64Array>(table->column(4)->chunk(0));
+  const auto &bytes = std::static_pointer_cast<arrow::Int64Array>(table->column(5)->chunk(0));
+
+  const std::string op_span = "bench." + op;
+  for (int64_t i = 0; i < table->num_rows(); i++) {
+    auto &result = (*ranks)[rank->Value(i)];
+    const auto &phase = name->GetString(i);
+    if (phase == op_span) {
+      result.time_us += duration->Value(i);
+    } else {
+      result.phases[phase] += duration->Value(i);
+      result.phase_bytes[phase] += bytes->Value(i);
+    }
+  }
+  return Status::OK();
+}
+
+void WriteJsonMap(std::ostream &out, const std::map<std::string, int64_t> &values) {
+  out << "{";
+  bool first = true;
+  for (const auto &v: values) {
+    out << (first ? "" : ", ") << "\"" << v.first << "\": " << v.second;
+    first = false;
+  }
+  out << "}";
+}
+
+Status WriteJson(const ScalingConfig &config, int world, const std::vector<OpResult> &results) {
+  std::ofstream out(config.out);
+  if (!out) {
+    return {Code::IOError, "unable to open " + config.out};
+  }
+  out << "{\n"
+      << "  \"comm\": \"" << config.comm << "\",\n"
+      << "  \"world_size\": " << world << ",\n"
+      << "  \"scaling\": \"" << config.scaling << "\",\n"
+      << "  \"rows\": " << config.rows << ",\n"
+      << "  \"distinct\": " << config.distinct << ",\n"
+      << "  \"key_skew\": " << config.key_skew << ",\n"
+      << "  \"rank_skew\": " << config.rank_skew << ",\n"
+      << "  \"seed\": " << config.seed << ",\n"
+      << "  \"results\": [";
+  for (size_t i = 0; i < results.size(); i++) {
+    const auto &result = results[i];
+    int64_t max_us = 0;
+    for (const auto &r: result.ranks) {
+      max_us = std::max(max_us, r.time_us);
+    }
+    out << (i == 0 ? "\n" : ",\n")
+        << "    {\"op\": \"" << result.op << "\", \"iteration\": " << result.iteration
+        << ", \"time_us\": " << max_us << ", \"ranks\": [";
+    for (size_t rank = 0; rank < result.ranks.size(); rank++) {
+      const auto &r = result.ranks[rank];
+      out << (rank == 0 ? "\n" : ",\n")
+          << "      {\"rank\": " << rank << ", \"rows_in\": " << r.rows_in
+          << ", \"rows_out\": " << r.rows_out << ", \"time_us\": " << r.time_us
+          << ", \"phases_us\": ";
+      WriteJsonMap(out, r.phases);
+      out << ", \"phases_bytes\": ";
+      WriteJsonMap(out, r.phase_bytes);
+      out << "}";
+    }
+    out << "]}";
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+  if (!out) {
+    return {Code::IOError, "unable to write " + config.out};
+  }
+  return Status::OK();
+}
+
+Status RunScaling(const std::shared_ptr<CylonContext> &ctx, const ScalingConfig &config) {
+  const int world = ctx->GetWorldSize();
+  std::shared_ptr<Table> left, right;
+  RETURN_CYLON_STATUS_IF_FAILED(MakeTable(ctx, config, config.seed, &left));
+  RETURN_CYLON_STATUS_IF_FAILED(MakeTable(ctx, config, config.seed + world, &right));
+
+  std::vector<OpResult> results;
+  trace::SetEnabled(true);
+  for (const auto &op: config.ops) {
+    for (int i = -config.warmup; i < config.iterations; i++) {
+      trace::Clear();
+      ctx->Barrier();
+      int64_t rows_out;
+      RETURN_CYLON_STATUS_IF_FAILED(RunOp(op, left, right, &rows_out));
+      if (i < 0) {
+        continue;
+      }
+
+      std::shared_ptr<Table> spans;
+      RETURN_CYLON_STATUS_IF_FAILED(trace::Gather(ctx, &spans, 0));
+      std::vector<std::vector<int64_t>> rows;
+      RETURN_CYLON_STATUS_IF_FAILED(GatherCounts(ctx, {left->Rows(), rows_out}, &rows));
+
+      if (ctx->GetRank() == 0) {
+        OpResult result{op, i, std::vector<RankResult>(world)};
+        RETURN_CYLON_STATUS_IF_FAILED(CollectSpans(spans, op, &result.ranks));
+        for (int r = 0; r < world; r++) {
+          result.ranks[r].rows_in = rows[r][0];
+          result.ranks[r].rows_out = rows[r][1];
+        }
+        LOG(INFO) << op << " iteration " << i << ": "
+                  << std::max_element(result.ranks.begin(), result.ranks.end(),
+                                      [](const RankResult &a, const RankResult &b) {
+                                        return a.time_us < b.time_us;
+                                      })->time_us << "[us]";
+        results.push_back(std::move(result));
+      }
+    }
+  }
+  trace::SetEnabled(false);
+  trace::Clear();
+
+  if (ctx->GetRank() == 0) {
+    RETURN_CYLON_STATUS_IF_FAILED(WriteJson(config, world, results));
+    LOG(INFO) << "results written to " << config.out;
+  }
+  return Status::OK();
+}
+
+}  // namespace bench
+}  // namespace cylon
+
+int main(int argc, char *argv[]) {
+  cylon::bench::ScalingConfig config;
+  auto status = cylon::bench::ParseArgs(argc, argv, &config);
+  if (!status.is_ok()) {
+    LOG(ERROR) << status.get_msg();
+    cylon::bench::PrintUsage();
+    return 1;
+  }
+
+  std::shared_ptr<cylon::CylonContext> ctx;
+  status = cylon::bench::InitContext(config, &ctx);
+  if (!status.is_ok()) {
+    LOG(ERROR) << "context initialization failed: " << status.get_msg();
+    return 1;
+  }
+
+  status = cylon::bench::RunScaling(ctx, config);
+  if (!status.is_ok()) {
+    LOG(ERROR) << "scaling benchmark failed: " << status.get_msg();
+    ctx->Finalize();
+    return 1;
+  }
+  ctx->Finalize();
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <numeric>
+
+#include <cylon/arrow/arrow_buffer.hpp>
+#include <cylon/serialize/table_serialize.hpp>
+
+#include "benchmark_utils.hpp"
+
+namespace cylon {
+namespace bench {
+
+template<typename ArrowType>
+static void BM_SerializeTable(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 2, args, 0, &table));
+
+  int64_t bytes = 0;
+  for (auto _: state) {
+    std::shared_ptr<TableSerializer> serializer;
+    CHECK_BENCHMARK_STATUS(state, CylonTableSerializer::Make(table, &serializer));
+    const auto &sizes = serializer->getBufferSizes();
+    benchmark::DoNotOptimize(serializer->getDataBuffers());
+    bytes = std::accumulate(sizes.begin(), sizes.end(), int64_t{0});
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+template<typename ArrowType>
+static void BM_DeserializeTable(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 2, args, 0, &table));
+  std::shared_ptr<TableSerializer> serializer;
+  CHECK_BENCHMARK_STATUS(state, CylonTableSerializer::Make(table, &serializer));
+
+  // copies of the serialized buffers, as they would be received
+  const auto &sizes = serializer->getBufferSizes();
+  const auto &data = serializer->getDataBuffers();
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  int64_t bytes = 0;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    std::shared_ptr<arrow::Buffer> buf;
+    if (sizes[i] > 0) {
+      CHECK_BENCHMARK_ARROW_STATUS(state, arrow::AllocateBuffer(sizes[i]).Value(&buf));
+      std::memcpy(buf->mutable_data(), data[i], sizes[i]);
+    } else {
+      CHECK_BENCHMARK_ARROW_STATUS(state, arrow::AllocateBuffer(0).Value(&buf));
+    }
+    buffers.push_back(std::make_shared<ArrowBuffer>(std::move(buf)));
+    bytes += sizes[i];
+  }
+  const auto &schema = table->get_table()->schema();
+
+  for (auto _: state) {
+    std::shared_ptr<Table> output;
+    CHECK_BENCHMARK_STATUS(state, DeserializeTable(Context(), schema, buffers, sizes, &output));
+    benchmark::DoNotOptimize(output);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+BENCHMARK_TEMPLATE(BM_SerializeTable, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SerializeTable, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SerializeTable, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SerializeTable, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_DeserializeTable, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_DeserializeTable, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_DeserializeTable, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_DeserializeTable, arrow::StringType)->Apply(DefaultArgs);
+
+}  // namespace bench
+}  // namespace cylon
@@ -0,0 +1,80 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cylon/arrow/arrow_kernels.hpp>
+#include <cylon/table.hpp>
+
+#include "benchmark_utils.hpp"
+
+namespace cylon {
+namespace bench {
+
+template<typename ArrowType>
+static void BM_SortIndices(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<arrow::Array> values;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomArray(TypeOf<ArrowType>(), args.rows, args.cardinality,
+                                                  args.null_ratio, 0, &values));
+
+  for (auto _: state) {
+    std::shared_ptr<arrow::UInt64Array> indices;
+    CHECK_BENCHMARK_ARROW_STATUS(state,
+                                 SortIndices(arrow::default_memory_pool(), values, indices));
+    benchmark::DoNotOptimize(indices);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+template<typename ArrowType>
+static void BM_SortIndicesMultiColumns(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(TypeOf<ArrowType>(), 2, args, 0, &table));
+  const auto &atable = table->get_table();
+
+  for (auto _: state) {
+    std::shared_ptr<arrow::UInt64Array> indices;
+    CHECK_BENCHMARK_ARROW_STATUS(state, SortIndicesMultiColumns(arrow::default_memory_pool(),
+                                                                atable, {0, 1}, indices,
+                                                                {true, false}));
+    benchmark::DoNotOptimize(indices);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+static void BM_SortTable(benchmark::State &state) {
+  const BenchmarkArgs args(state);
+  std::shared_ptr<Table> table;
+  CHECK_BENCHMARK_ARROW_STATUS(state, RandomTable(arrow::int64(), 1, args, 0, &table));
+
+  for (auto _: state) {
+    std::shared_ptr<Table> sorted;
+    CHECK_BENCHMARK_STATUS(state, Sort(table, 0, sorted, true));
+    benchmark::DoNotOptimize(sorted);
+  }
+  state.SetItemsProcessed(state.iterations() * args.rows);
+}
+
+BENCHMARK_TEMPLATE(BM_SortIndices, arrow::Int32Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SortIndices, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SortIndices, arrow::DoubleType)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SortIndices, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK_TEMPLATE(BM_SortIndicesMultiColumns, arrow::Int64Type)->Apply(DefaultArgs);
+BENCHMARK_TEMPLATE(BM_SortIndicesMultiColumns, arrow::StringType)->Apply(DefaultArgs);
+
+BENCHMARK(BM_SortTable)->Apply(DefaultArgs);
+
+}  // namespace bench
+}  // namespace cylon
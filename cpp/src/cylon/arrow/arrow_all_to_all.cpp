@@ -17,12 +17,24 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <limits>
+#include <cstring>
+#include <arrow/util/bit_util.h>
 
 #include <cylon/arrow/arrow_all_to_all.hpp>
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
 #include <cylon/util/macros.hpp>
+#include <cylon/util/trace.hpp>
 
 namespace cylon {
+
+// column index in the header of a frame
+static constexpr int kFrameColumn = -1;
+
+static inline int64_t AlignFrameOffset(int64_t offset) {
+  return arrow::BitUtil::RoundUpToMultipleOf64(offset);
+}
+
 ArrowAllToAll::ArrowAllToAll(const std::shared_ptr<cylon::CylonContext> &ctx,
                              const std::vector<int> &source,
                              const std::vector<int> &targets,
@@ -37,8 +49,9 @@ ArrowAllToAll::ArrowAllToAll(const std::shared_ptr<cylon::CylonContext> &ctx,
     workerId_(ctx->GetRank()),
     pool_(cylon::ToArrowPool(ctx)),
     completed_(false),
-    finishCalled_(false) {
-  allocator_ = new ArrowAllocator(pool_);
+    finishCalled_(false),
+    framed_(ctx->GetConfig(kArrowAllToAllFramesConfig, "false") == "true") {
+  allocator_ = new PooledArrowAllocator(ctx->GetBufferPool());
 
   // we need to pass the correct arguments
   all_ = std::make_shared<AllToAll>(ctx, source, targets, edgeId, this, allocator_);
@@ -79,10 +92,24 @@ bool ArrowAllToAll::isComplete() {
         t.second->currentTable = t.second->pending.front();
         t.second->pending.pop();
         t.second->status = ARROW_HEADER_COLUMN_CONTINUE;
+        if (framed_) {
+          // leaves the frame empty if the table can not be framed
+          makeFrame(t.second->currentTable.first, &t.second->frame, &t.second->frameMetadata);
+        }
       }
     }
 
-    if (t.second->status == ARROW_HEADER_COLUMN_CONTINUE) {
+    if (t.second->status == ARROW_HEADER_COLUMN_CONTINUE && t.second->frame != nullptr) {
+      const auto &frame = t.second->frame;
+      int hdr[6] = {kFrameColumn, t.second->frameMetadata, 0, 0, 0, t.second->currentTable.second};
+      if (all_->insert(frame->data(), frame->size(), t.first, hdr, 6)) {
+        // the table is not needed anymore, only the frame
+        t.second->inFlight.emplace(std::move(t.second->frame), 1);
+        t.second->currentTable.first.reset();
+        releaseSentTables(*t.second);
+        t.second->status = ARROW_HEADER_INIT;
+      }
+    } else if (t.second->status == ARROW_HEADER_COLUMN_CONTINUE) {
       int noOfColumns = t.second->currentTable.first->columns().size();
       bool canContinue = true;
       while (t.second->columnIndex < noOfColumns && canContinue) {
@@ -106,13 +133,14 @@ bool ArrowAllToAll::isComplete() {
             // lets send this buffer, we need to send the length at this point
             bool accept = (buf == nullptr) ?
                           all_->insert(nullptr, 0, t.first, hdr, 6) :
-                          all_->insert(buf->mutable_data(), static_cast<int>(buf->size()), t.first, hdr, 6);
+                          all_->insert(buf->mutable_data(), buf->size(), t.first, hdr, 6);
 
             if (!accept) {
               canContinue = false;
               break;
             }
             t.second->bufferIndex++;
+            t.second->bufferCount++;
           }
           // if we can continue, that means we are finished with this array
           if (canContinue) {
@@ -129,6 +157,9 @@ bool ArrowAllToAll::isComplete() {
 
       // if we are at this stage, we have sent everything for this , so lets resets
       if (canContinue) {
+        t.second->inFlight.emplace(std::move(t.second->currentTable.first), t.second->bufferCount);
+        t.second->bufferCount = 0;
+        releaseSentTables(*t.second);
         t.second->columnIndex = 0;
         t.second->arrayIndex = 0;
         t.second->bufferIndex = 0;
@@ -152,6 +183,10 @@ bool ArrowAllToAll::isComplete() {
   return completed_;
 }
 
+void ArrowAllToAll::pauseReceives(bool pause) {
+  all_->pauseReceives(pause);
+}
+
 void ArrowAllToAll::finish() {
   finished = true;
 }
@@ -171,10 +206,16 @@ void ArrowAllToAll::close() {
   }
 }*/
 
-bool ArrowAllToAll::onReceive(int source, std::shared_ptr<Buffer> buffer, int length) {
+bool ArrowAllToAll::onReceive(int source, std::shared_ptr<Buffer> buffer, int64_t length) {
   CYLON_UNUSED(length);
   std::shared_ptr<PendingReceiveTable> table = receives_[source];
   receivedBuffers_++;
+  if (table->columnIndex == kFrameColumn) {
+    // the header carries the metadata length in place of the buffer index
+    onReceiveFrame(source, std::static_pointer_cast<ArrowBuffer>(buffer)->getBuf(),
+                   table->bufferIndex, table->reference);
+    return true;
+  }
   // create the buffer hosting the value
   table->buffers.push_back(std::static_pointer_cast<ArrowBuffer>(buffer)->getBuf());
   // now check weather we have the expected number of buffers received
@@ -232,12 +273,128 @@ bool ArrowAllToAll::onReceiveHeader(int source, int fin, int *buffer, int length
   return true;
 }
 
-bool ArrowAllToAll::onSendComplete(int target, const void *buffer, int length) {
-//    pool_->Free((uint8_t *)buffer, length);
-  CYLON_UNUSED(target);
+bool ArrowAllToAll::onSendComplete(int target, const void *buffer, int64_t length) {
   CYLON_UNUSED(buffer);
   CYLON_UNUSED(length);
+  // sends to a target complete in the order they were inserted
+  const auto &send_table = inputs_.find(target);
+  if (send_table != inputs_.end()) {
+    send_table->second->sentBuffers++;
+    releaseSentTables(*send_table->second);
+  }
   return false;
 }
 
+bool ArrowAllToAll::makeFrame(const std::shared_ptr<arrow::Table> &table,
+                              std::shared_ptr<arrow::Buffer> *frame,
+                              int *metadata_length) {
+  trace::Span span("all_to_all.serialize");
+  // metadata: for each column, the number of arrays, and for each array, the length, offset,
+  // null count, number of buffers and (offset in the data section, size) of each buffer
+  std::vector<int64_t> metadata;
+  int64_t data_size = 0;
+  for (const auto &column: table->columns()) {
+    metadata.push_back(column->num_chunks());
+    for (const auto &array: column->chunks()) {
+      const auto &data = array->data();
+      if (!data->child_data.empty() || data->dictionary != nullptr) {
+        return false;
+      }
+      metadata.push_back(data->length);
+      metadata.push_back(data->offset);
+      metadata.push_back(data->null_count);
+      metadata.push_back(static_cast<int64_t>(data->buffers.size()));
+      for (const auto &buf: data->buffers) {
+        if (buf == nullptr) {
+          metadata.push_back(-1);
+          metadata.push_back(0);
+        } else {
+          metadata.push_back(data_size);
+          metadata.push_back(buf->size());
+          data_size = AlignFrameOffset(data_size + buf->size());
+        }
+      }
+    }
+  }
+
+  const int64_t data_start = AlignFrameOffset(metadata.size() * sizeof(int64_t));
+  const int64_t frame_size = data_start + data_size;
+  if (frame_size > std::numeric_limits<int>::max()) {
+    return false;
+  }
+
+  std::shared_ptr<arrow::Buffer> buf;
+  if (!allocator_->GetPool()->Allocate(frame_size, &buf).is_ok()) {
+    return false;
+  }
+  span.AddBytes(frame_size);
+  uint8_t *out = buf->mutable_data();
+  // padding is zeroed, so that no uninitialized memory goes over the wire
+  std::memset(out, 0, data_start);
+  std::memcpy(out, metadata.data(), metadata.size() * sizeof(int64_t));
+  int64_t end = 0;
+  for (const auto &column: table->columns()) {
+    for (const auto &array: column->chunks()) {
+      for (const auto &b: array->data()->buffers) {
+        if (b != nullptr) {
+          std::memset(out + data_start + end, 0, AlignFrameOffset(end) - end);
+          end = AlignFrameOffset(end);
+          std::memcpy(out + data_start + end, b->data(), b->size());
+          end += b->size();
+        }
+      }
+    }
+  }
+  std::memset(out + data_start + end, 0, data_size - end);
+
+  *frame = std::move(buf);
+  *metadata_length = static_cast<int>(metadata.size());
+  return true;
+}
+
+void ArrowAllToAll::onReceiveFrame(int source, const std::shared_ptr<arrow::Buffer> &frame,
+                                   int metadata_length, int reference) {
+  trace::Span span("all_to_all.deserialize");
+  span.AddBytes(frame->size());
+  const auto *metadata = reinterpret_cast<const int64_t *>(frame->data());
+  const int64_t data_start = AlignFrameOffset(metadata_length * sizeof(int64_t));
+
+  int64_t m = 0;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  columns.reserve(schema_->num_fields());
+  for (const auto &field: schema_->fields()) {
+    const int64_t num_arrays = metadata[m++];
+    arrow::ArrayVector arrays;
+    arrays.reserve(num_arrays);
+    for (int64_t a = 0; a < num_arrays; a++) {
+      const int64_t length = metadata[m++];
+      const int64_t offset = metadata[m++];
+      const int64_t null_count = metadata[m++];
+      const int64_t num_buffers = metadata[m++];
+      std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+      buffers.reserve(num_buffers);
+      for (int64_t b = 0; b < num_buffers; b++) {
+        const int64_t buf_offset = metadata[m++];
+        const int64_t buf_size = metadata[m++];
+        // slices keep the frame alive
+        buffers.push_back(buf_offset < 0 ? nullptr
+                                         : arrow::SliceBuffer(frame, data_start + buf_offset, buf_size));
+      }
+      arrays.push_back(arrow::MakeArray(arrow::ArrayData::Make(field->type(), length,
+                                                               std::move(buffers), null_count,
+                                                               offset)));
+    }
+    columns.push_back(std::make_shared<arrow::ChunkedArray>(std::move(arrays), field->type()));
+  }
+
+  recv_callback_(source, arrow::Table::Make(schema_, std::move(columns)), reference);
+}
+
+void ArrowAllToAll::releaseSentTables(PendingSendTable &send_table) {
+  while (!send_table.inFlight.empty() && send_table.inFlight.front().second <= send_table.sentBuffers) {
+    send_table.sentBuffers -= send_table.inFlight.front().second;
+    send_table.inFlight.pop();
+  }
+}
+
 }  // namespace cylon
@@ -51,6 +51,17 @@ struct PendingSendTable {
   int arrayIndex{};
   // the current buffer inde
   int bufferIndex{};
+  // number of buffers of the current table handed over to the AllToAll
+  int64_t bufferCount{};
+  // the current table packed into a single frame, if frames are enabled
+  std::shared_ptr<arrow::Buffer> frame{};
+  // number of int64 metadata values at the start of the frame
+  int frameMetadata{};
+  // tables (or frames) whose buffers are all handed over to the AllToAll, with their buffer counts.
+  // A table is released once all its buffers are sent, so that the caller need not keep it alive
+  std::queue<std::pair<std::shared_ptr<void>, int64_t>> inFlight{};
+  // number of buffers sent, which are not yet accounted against inFlight
+  int64_t sentBuffers{};
 };
 
 struct PendingReceiveTable {
@@ -76,6 +87,19 @@ struct PendingReceiveTable {
   std::vector<std::shared_ptr<arrow::Array>> arrays;
 };
 
+/**
+ * Config key (in CylonContext) to send each inserted table as a single frame. Set to "true" to
+ * enable.
+ *
+ * A frame packs the buffers of all the arrays of a table into one contiguous message, preceded by
+ * the array lengths, offsets and the buffer locations in the frame. The receiver wraps slices of the
+ * received frame as the array buffers, so the received table is built without copying. Frames are
+ * copied once at the sender, but replace a message (and a receive buffer allocation) per buffer with
+ * one per table. Tables with nested or dictionary columns, and tables larger than 2GB, are still
+ * sent buffer by buffer.
+ */
+constexpr const char *kArrowAllToAllFramesConfig = "all_to_all_frames";
+
 /**
  * This function is called when a data is received
  * @param source the source
@@ -118,6 +142,11 @@ class ArrowAllToAll : public ReceiveCallback {
   /**
    * Insert a buffer to be sent, if the buffer is accepted return true
    *
+   * Tables can be inserted while the operation is in progress (ie. before finish is called), and each
+   * inserted table is delivered to the receive callback of the target as a separate table. Calling
+   * isComplete between inserts progresses the sends of the tables inserted so far, which lets the
+   * caller overlap producing the next table with communication.
+   *
    * @param buffer the buffer to send
    * @param length the length of the message
    * @param target the target to send the message
@@ -138,6 +167,13 @@ class ArrowAllToAll : public ReceiveCallback {
    */
   void finish();
 
+  /**
+   * Backpressure: while paused, isComplete progresses the sends but not the receives, so that the
+   * sources hold back until the receiver has capacity again
+   * @param pause
+   */
+  void pauseReceives(bool pause);
+
   /*
    * Close the operation
    */
@@ -149,7 +185,7 @@ class ArrowAllToAll : public ReceiveCallback {
    * @param buffer
    * @param length
    */
-  bool onReceive(int source, std::shared_ptr<Buffer> buffer, int length) override;
+  bool onReceive(int source, std::shared_ptr<Buffer> buffer, int64_t length) override;
 
   /**
    * We implement the receive callback
@@ -157,9 +193,27 @@ class ArrowAllToAll : public ReceiveCallback {
    */
   bool onReceiveHeader(int source, int finished, int *buffer, int length) override;
 
-  bool onSendComplete(int target, const void *buffer, int length) override;
+  bool onSendComplete(int target, const void *buffer, int64_t length) override;
 
  private:
+  /**
+   * Release the in flight tables of a target whose buffers are all sent
+   */
+  static void releaseSentTables(PendingSendTable &send_table);
+
+  /**
+   * Packs a table into a frame
+   * @return false if the table can not be sent as a frame
+   */
+  bool makeFrame(const std::shared_ptr<arrow::Table> &table, std::shared_ptr<arrow::Buffer> *frame,
+                 int *metadata_length);
+
+  /**
+   * Builds the table from a received frame and hands it over to the receive callback
+   */
+  void onReceiveFrame(int source, const std::shared_ptr<arrow::Buffer> &frame,
+                      int metadata_length, int reference);
+
   /**
    * The targets
    */
@@ -220,10 +274,12 @@ class ArrowAllToAll : public ReceiveCallback {
    */
   arrow::MemoryPool *pool_;
   // this is the allocator to create memory when receiving
-  ArrowAllocator *allocator_;
+  PooledArrowAllocator *allocator_;
 
   bool completed_;
   bool finishCalled_;
+  // send the tables as frames
+  bool framed_;
 };
 }
 #endif //CYLON_ARROW_H
@@ -12,11 +12,200 @@
  * limitations under the License.
  */
 
+#include <glog/logging.h>
+#include <arrow/util/bit_util.h>
+
 #include "cylon/arrow/arrow_buffer.hpp"
 #include "cylon/util/macros.hpp"
 
 namespace cylon {
 
+namespace {
+constexpr int kMinBlockBits = 6;  // 64 bytes
+constexpr int kMaxBlockBits = 30;  // 1GB
+constexpr int kSubClasses = 4;
+constexpr int kNumSizeClasses = 1 + (kMaxBlockBits - kMinBlockBits) * kSubClasses;
+
+/**
+ * size class of a block. -1 if the block is not pooled
+ */
+int SizeClass(int64_t length, int64_t *block_size) {
+  if (length <= (1LL << kMinBlockBits)) {
+    *block_size = 1LL << kMinBlockBits;
+    return 0;
+  }
+  if (length > (1LL << kMaxBlockBits)) {
+    *block_size = length;
+    return -1;
+  }
+  // 2^k < length <= 2^(k+1)
+  const int k = arrow::BitUtil::Log2(static_cast<uint64_t>(length)) - 1;
+  const int64_t quarter = 1LL << (k - 2);
+  const int sub = static_cast<int>((length - 1) >> (k - 2)) - kSubClasses;
+  *block_size = (kSubClasses + sub + 1) * quarter;
+  return 1 + (k - kMinBlockBits) * kSubClasses + sub;
+}
+
+int64_t ClassBlockSize(int size_class) {
+  if (size_class == 0) {
+    return 1LL << kMinBlockBits;
+  }
+  const int k = kMinBlockBits + (size_class - 1) / kSubClasses;
+  const int sub = (size_class - 1) % kSubClasses;
+  return (kSubClasses + sub + 1) * (1LL << (k - 2));
+}
+}  // namespace
+
+/**
+ * Buffer on a block of a BufferPool. The block goes back to the pool when the buffer is destroyed.
+ */
+class PooledBuffer : public arrow::MutableBuffer {
+ public:
+  PooledBuffer(uint8_t *data, int64_t size, int64_t capacity, std::shared_ptr<BufferPool> pool)
+      : arrow::MutableBuffer(data, size), pool_(std::move(pool)) {
+    capacity_ = capacity;
+  }
+
+  ~PooledBuffer() override {
+    pool_->Recycle(mutable_data(), capacity_);
+  }
+
+ private:
+  std::shared_ptr<BufferPool> pool_;
+};
+
+std::shared_ptr<BufferPool> BufferPool::Make(arrow::MemoryPool *pool, int64_t max_cached_bytes) {
+  return std::shared_ptr<BufferPool>(new BufferPool(pool, max_cached_bytes));
+}
+
+BufferPool::BufferPool(arrow::MemoryPool *pool, int64_t max_cached_bytes)
+    : pool_(pool), max_cached_bytes_(max_cached_bytes), free_blocks_(kNumSizeClasses) {}
+
+BufferPool::~BufferPool() {
+  Trim();
+  SetRegistrar(nullptr);
+}
+
+int64_t BufferPool::BlockSize(int64_t length) {
+  int64_t block_size;
+  SizeClass(length, &block_size);
+  return block_size;
+}
+
+Status BufferPool::Allocate(int64_t length, std::shared_ptr<arrow::Buffer> *buffer) {
+  int64_t block_size;
+  const int size_class = SizeClass(length, &block_size);
+
+  uint8_t *data = nullptr;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (size_class >= 0 && !free_blocks_[size_class].empty()) {
+    data = free_blocks_[size_class].back();
+    free_blocks_[size_class].pop_back();
+    stats_.bytes_cached -= block_size;
+    stats_.hits++;
+  } else {
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(pool_->Allocate(block_size, &data));
+    stats_.misses++;
+    RegisterBlock(data, block_size);
+  }
+  stats_.bytes_in_use += block_size;
+
+  *buffer = std::make_shared<PooledBuffer>(data, length, block_size, shared_from_this());
+  return Status::OK();
+}
+
+void BufferPool::Recycle(uint8_t *data, int64_t capacity) {
+  int64_t block_size;
+  const int size_class = SizeClass(capacity, &block_size);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.bytes_in_use -= capacity;
+  if (size_class >= 0 && stats_.bytes_cached + capacity <= max_cached_bytes_) {
+    free_blocks_[size_class].push_back(data);
+    stats_.bytes_cached += capacity;
+  } else {
+    FreeBlock(data, capacity);
+  }
+}
+
+void BufferPool::FreeBlock(uint8_t *data, int64_t capacity) {
+  auto reg = registrations_.find(data);
+  if (reg != registrations_.end()) {
+    registrar_->Deregister(reg->second);
+    registrations_.erase(reg);
+    stats_.registered_blocks--;
+  }
+  pool_->Free(data, capacity);
+}
+
+void BufferPool::RegisterBlock(uint8_t *data, int64_t capacity) {
+  if (registrar_ == nullptr) {
+    return;
+  }
+  void *handle = nullptr;
+  const auto &status = registrar_->Register(data, capacity, &handle);
+  if (status.is_ok()) {
+    registrations_.emplace(data, handle);
+    stats_.registered_blocks++;
+  } else {
+    // the channels can still use unregistered memory
+    LOG(WARNING) << "Unable to register a receive buffer: " << status.get_msg();
+  }
+}
+
+void BufferPool::SetRegistrar(std::shared_ptr<MemoryRegistrar> registrar) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &reg: registrations_) {
+    registrar_->Deregister(reg.second);
+  }
+  registrations_.clear();
+  stats_.registered_blocks = 0;
+
+  registrar_ = std::move(registrar);
+  for (size_t c = 0; c < free_blocks_.size(); c++) {
+    for (uint8_t *data: free_blocks_[c]) {
+      RegisterBlock(data, ClassBlockSize(static_cast<int>(c)));
+    }
+  }
+}
+
+void *BufferPool::GetMemoryHandle(const uint8_t *data) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto reg = registrations_.find(const_cast<uint8_t *>(data));
+  return reg == registrations_.end() ? nullptr : reg->second;
+}
+
+void BufferPool::Trim() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t c = 0; c < free_blocks_.size(); c++) {
+    const int64_t block_size = ClassBlockSize(static_cast<int>(c));
+    for (uint8_t *data: free_blocks_[c]) {
+      FreeBlock(data, block_size);
+    }
+    free_blocks_[c].clear();
+  }
+  stats_.bytes_cached = 0;
+}
+
+BufferPoolStats BufferPool::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+PooledArrowAllocator::PooledArrowAllocator(std::shared_ptr<BufferPool> pool)
+    : pool(std::move(pool)) {}
+
+Status PooledArrowAllocator::Allocate(int64_t length, std::shared_ptr<Buffer> *buffer) {
+  std::shared_ptr<arrow::Buffer> buf;
+  RETURN_CYLON_STATUS_IF_FAILED(pool->Allocate(length, &buf));
+  *buffer = std::make_shared<ArrowBuffer>(std::move(buf));
+  return Status::OK();
+}
+
+const std::shared_ptr<BufferPool> &PooledArrowAllocator::GetPool() const {
+  return pool;
+}
+
 ArrowAllocator::ArrowAllocator(arrow::MemoryPool *pool) : pool(pool) {}
 
 ArrowAllocator::~ArrowAllocator() = default;
@@ -16,6 +16,10 @@
 #ifndef CYLON_CPP_SRC_CYLON_ARROW_ARROW_BUFFER_HPP_
 #define CYLON_CPP_SRC_CYLON_ARROW_ARROW_BUFFER_HPP_
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include <arrow/api.h>
 
 #include "cylon/net/buffer.hpp"
@@ -49,6 +53,115 @@ class ArrowAllocator : public Allocator {
   arrow::MemoryPool *pool;
 };
 
+/**
+ * Registers memory with a network fabric, so that buffers handed out by a BufferPool can be used
+ * for transfers without registering them on every message (ex: ucp_mem_map in UCX)
+ */
+class MemoryRegistrar {
+ public:
+  virtual ~MemoryRegistrar() = default;
+  virtual Status Register(uint8_t *address, int64_t length, void **handle) = 0;
+  virtual void Deregister(void *handle) = 0;
+};
+
+struct BufferPoolStats {
+  // allocations served from a cached block
+  int64_t hits = 0;
+  // allocations that went to the underlying memory pool
+  int64_t misses = 0;
+  // capacity of the blocks handed out and not yet returned
+  int64_t bytes_in_use = 0;
+  // capacity of the free blocks kept for reuse
+  int64_t bytes_cached = 0;
+  // number of blocks currently registered with the MemoryRegistrar
+  int64_t registered_blocks = 0;
+};
+
+/**
+ * Config key (in CylonContext) for the maximum number of bytes the context's BufferPool keeps
+ * for reuse. 0 disables caching.
+ */
+constexpr const char *kBufferPoolCacheBytesConfig = "buffer_pool_cache_bytes";
+constexpr int64_t kDefaultBufferPoolCacheBytes = 256LL * 1024 * 1024;
+
+/**
+ * Size-class buffer pool for receive buffers.
+ *
+ * Requests are rounded up to a size class (4 classes per power of two, so at most 25% of a block is
+ * wasted) and served from a free list of that class. Buffers are returned to the pool when the last
+ * reference to them (ex: a table built on the received buffers) goes away, so the same blocks are
+ * reused across AllToAll rounds. Blocks larger than 1GB are not pooled. If a MemoryRegistrar is set,
+ * blocks are registered once when they are allocated from the memory pool and stay registered
+ * while cached.
+ */
+class BufferPool : public std::enable_shared_from_this<BufferPool> {
+ public:
+  static std::shared_ptr<BufferPool> Make(arrow::MemoryPool *pool = arrow::default_memory_pool(),
+                                          int64_t max_cached_bytes = kDefaultBufferPoolCacheBytes);
+  ~BufferPool();
+
+  Status Allocate(int64_t length, std::shared_ptr<arrow::Buffer> *buffer);
+
+  /**
+   * Sets the registrar for the blocks of this pool. The blocks registered with the previous
+   * registrar (if any) are deregistered, and the cached blocks are registered with the new one.
+   * @param registrar nullptr to stop registering
+   */
+  void SetRegistrar(std::shared_ptr<MemoryRegistrar> registrar);
+
+  /**
+   * Registration handle of a block of this pool
+   * @param data start of the block
+   * @return nullptr if the block is not registered
+   */
+  void *GetMemoryHandle(const uint8_t *data) const;
+
+  /**
+   * Releases the cached blocks to the memory pool
+   */
+  void Trim();
+
+  BufferPoolStats GetStats() const;
+
+  /**
+   * Size of the block used for a request of length bytes
+   */
+  static int64_t BlockSize(int64_t length);
+
+ private:
+  friend class PooledBuffer;
+
+  BufferPool(arrow::MemoryPool *pool, int64_t max_cached_bytes);
+
+  void Recycle(uint8_t *data, int64_t capacity);
+  // requires mutex_
+  void FreeBlock(uint8_t *data, int64_t capacity);
+  // requires mutex_
+  void RegisterBlock(uint8_t *data, int64_t capacity);
+
+  arrow::MemoryPool *pool_;
+  int64_t max_cached_bytes_;
+  mutable std::mutex mutex_;
+  std::vector<std::vector<uint8_t *>> free_blocks_;
+  std::shared_ptr<MemoryRegistrar> registrar_;
+  std::unordered_map<uint8_t *, void *> registrations_;
+  BufferPoolStats stats_;
+};
+
+/**
+ * Allocator serving the channel receives from a BufferPool
+ */
+class PooledArrowAllocator : public Allocator {
+ public:
+  explicit PooledArrowAllocator(std::shared_ptr<BufferPool> pool);
+
+  Status Allocate(int64_t length, std::shared_ptr<Buffer> *buffer) override;
+
+  const std::shared_ptr<BufferPool> &GetPool() const;
+ private:
+  std::shared_ptr<BufferPool> pool;
+};
+
 }
 
 #endif //CYLON_CPP_SRC_CYLON_ARROW_ARROW_BUFFER_HPP_
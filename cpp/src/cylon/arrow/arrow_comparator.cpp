@@ -757,6 +757,228 @@ Status CreateDualArrayIndexComparator(const std::shared_ptr<arrow::Array> &a1,
   return Status::OK();
 }
 
+/**
+ * Values of a chunked array, addressed by the row index of the chunked array
+ */
+template<typename ArrowT>
+class ChunkedValues {
+  using ArrayT = typename ArrowTypeTraits<ArrowT>::ArrayT;
+
+ public:
+  explicit ChunkedValues(const std::shared_ptr<arrow::ChunkedArray> &array)
+      : resolver(array->chunks()) {
+    chunks.reserve(array->num_chunks());
+    for (const auto &chunk: array->chunks()) {
+      chunks.push_back(std::static_pointer_cast<ArrayT>(chunk));
+    }
+  }
+
+  // chunk of the row, and the offset of the row in that chunk
+  inline std::pair<const ArrayT *, int64_t> Locate(int64_t index) const {
+    const auto &loc = resolver.Resolve(index);
+    return {chunks[loc.first].get(), loc.second};
+  }
+
+ private:
+  std::vector<std::shared_ptr<ArrayT>> chunks;
+  util::ChunkResolver resolver;
+};
+
+template<typename ArrowT, bool Asc, bool NullOrder>
+static inline int CompareLocated(
+    const std::pair<const typename ArrowTypeTraits<ArrowT>::ArrayT *, int64_t> &v1,
+    const std::pair<const typename ArrowTypeTraits<ArrowT>::ArrayT *, int64_t> &v2) {
+  bool is_null1 = v1.first->IsNull(v1.second);
+  bool is_null2 = v2.first->IsNull(v2.second);
+
+  if (is_null1 || is_null2) { // if either one is null,
+    return (is_null1 && !is_null2) * ((Asc == NullOrder) - (Asc != NullOrder))
+        + (!is_null1 && is_null2) * ((Asc != NullOrder) - (Asc == NullOrder));
+  }
+
+  return CompareFunc<ArrowT, Asc>::compare(v1.first->GetView(v1.second),
+                                           v2.first->GetView(v2.second));
+}
+
+template<typename ArrowT>
+static inline bool EqualLocated(
+    const std::pair<const typename ArrowTypeTraits<ArrowT>::ArrayT *, int64_t> &v1,
+    const std::pair<const typename ArrowTypeTraits<ArrowT>::ArrayT *, int64_t> &v2) {
+  bool is_null1 = v1.first->IsNull(v1.second);
+  bool is_null2 = v2.first->IsNull(v2.second);
+
+  return (is_null1 && is_null2) ||
+      (!is_null1 && !is_null2 && (v1.first->GetView(v1.second) == v2.first->GetView(v2.second)));
+}
+
+template<typename ArrowT, bool Asc, bool NullOrder>
+class ChunkedArrayIndexComparator : public ArrayIndexComparator {
+ public:
+  explicit ChunkedArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &array)
+      : values(array) {}
+
+  int compare(const int64_t &index1, const int64_t &index2) const override {
+    return CompareLocated<ArrowT, Asc, NullOrder>(values.Locate(index1), values.Locate(index2));
+  }
+
+  bool equal_to(const int64_t &index1, const int64_t &index2) const override {
+    return EqualLocated<ArrowT>(values.Locate(index1), values.Locate(index2));
+  }
+
+ private:
+  ChunkedValues<ArrowT> values;
+};
+
+template<typename ArrowT, bool Asc, bool NullOrder>
+class DualChunkedArrayIndexComparator : public DualArrayIndexComparator {
+ public:
+  DualChunkedArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &a1,
+                                  const std::shared_ptr<arrow::ChunkedArray> &a2)
+      : values({ChunkedValues<ArrowT>(a1), ChunkedValues<ArrowT>(a2)}) {}
+
+  int compare(int64_t index1, int64_t index2) const override {
+    return CompareLocated<ArrowT, Asc, NullOrder>(
+        values[util::CheckBit(index1)].Locate(util::ClearBit(index1)),
+        values[util::CheckBit(index2)].Locate(util::ClearBit(index2)));
+  }
+
+  int compare(int32_t array_index1, int64_t row_index1,
+              int32_t array_index2, int64_t row_index2) const override {
+    return CompareLocated<ArrowT, Asc, NullOrder>(values[array_index1].Locate(row_index1),
+                                                  values[array_index2].Locate(row_index2));
+  }
+
+  bool equal_to(int64_t index1, int64_t index2) const override {
+    return EqualLocated<ArrowT>(values[util::CheckBit(index1)].Locate(util::ClearBit(index1)),
+                                values[util::CheckBit(index2)].Locate(util::ClearBit(index2)));
+  }
+
+ private:
+  std::array<ChunkedValues<ArrowT>, 2> values;
+};
+
+template<template<typename, bool, bool> class ComparatorT, typename ArrowT, typename BaseT,
+    typename ...Args>
+static Status MakeTypedChunkedComparator(bool asc, bool null_order, std::unique_ptr<BaseT> *out_comp,
+                                         const Args &...args) {
+  if (asc) {
+    if (null_order) {
+      *out_comp = std::make_unique<ComparatorT<ArrowT, true, true>>(args...);
+    } else {
+      *out_comp = std::make_unique<ComparatorT<ArrowT, true, false>>(args...);
+    }
+  } else {
+    if (null_order) {
+      *out_comp = std::make_unique<ComparatorT<ArrowT, false, true>>(args...);
+    } else {
+      *out_comp = std::make_unique<ComparatorT<ArrowT, false, false>>(args...);
+    }
+  }
+  return Status::OK();
+}
+
+template<template<typename, bool, bool> class ComparatorT, typename BaseT, typename ...Args>
+static Status MakeChunkedComparator(const std::shared_ptr<arrow::DataType> &type,
+                                    bool asc, bool null_order,
+                                    std::unique_ptr<BaseT> *out_comp, const Args &...args) {
+  switch (type->id()) {
+    case arrow::Type::UINT8:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::UInt8Type>(asc, null_order, out_comp,
+                                                                       args...);
+    case arrow::Type::INT8:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Int8Type>(asc, null_order, out_comp,
+                                                                      args...);
+    case arrow::Type::UINT16:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::UInt16Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::INT16:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Int16Type>(asc, null_order, out_comp,
+                                                                       args...);
+    case arrow::Type::UINT32:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::UInt32Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::INT32:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Int32Type>(asc, null_order, out_comp,
+                                                                       args...);
+    case arrow::Type::UINT64:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::UInt64Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::INT64:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Int64Type>(asc, null_order, out_comp,
+                                                                       args...);
+    case arrow::Type::HALF_FLOAT:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::HalfFloatType>(asc, null_order,
+                                                                           out_comp, args...);
+    case arrow::Type::FLOAT:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::FloatType>(asc, null_order, out_comp,
+                                                                       args...);
+    case arrow::Type::DOUBLE:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::DoubleType>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::STRING:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::StringType>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::LARGE_STRING:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::LargeStringType>(asc, null_order,
+                                                                             out_comp, args...);
+    case arrow::Type::BINARY:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::BinaryType>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::LARGE_BINARY:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::LargeBinaryType>(asc, null_order,
+                                                                             out_comp, args...);
+    case arrow::Type::FIXED_SIZE_BINARY:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::FixedSizeBinaryType>(asc, null_order,
+                                                                                 out_comp, args...);
+    case arrow::Type::DATE32:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Date32Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::DATE64:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Date64Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::TIMESTAMP:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::TimestampType>(asc, null_order,
+                                                                           out_comp, args...);
+    case arrow::Type::TIME32:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Time32Type>(asc, null_order, out_comp,
+                                                                        args...);
+    case arrow::Type::TIME64:
+      return MakeTypedChunkedComparator<ComparatorT, arrow::Time64Type>(asc, null_order, out_comp,
+                                                                        args...);
+    default:
+      return {Code::Invalid, "Invalid data type for ArrayIndexComparator " + type->ToString()};
+  }
+}
+
+Status CreateArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &array,
+                                  std::unique_ptr<ArrayIndexComparator> *out_comp,
+                                  bool asc, bool null_order) {
+  if (array->num_chunks() <= 1) {
+    return CreateArrayIndexComparator(util::GetChunkOrEmptyArray(array, 0), out_comp, asc,
+                                      null_order);
+  }
+  return MakeChunkedComparator<ChunkedArrayIndexComparator>(array->type(), asc, null_order,
+                                                            out_comp, array);
+}
+
+Status CreateDualArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &a1,
+                                      const std::shared_ptr<arrow::ChunkedArray> &a2,
+                                      std::unique_ptr<DualArrayIndexComparator> *out_comp,
+                                      bool asc, bool null_order) {
+  if (a1->num_chunks() <= 1 && a2->num_chunks() <= 1) {
+    return CreateDualArrayIndexComparator(util::GetChunkOrEmptyArray(a1, 0),
+                                          util::GetChunkOrEmptyArray(a2, 0),
+                                          out_comp, asc, null_order);
+  }
+
+  if (!a1->type()->Equals(a2->type())) {
+    return {Code::Invalid, "array types are not equal " + a1->type()->ToString() + " vs "
+        + a2->type()->ToString()};
+  }
+  return MakeChunkedComparator<DualChunkedArrayIndexComparator>(a1->type(), asc, null_order,
+                                                                out_comp, a1, a2);
+}
+
 Status TableRowIndexEqualTo::Make(const std::shared_ptr<arrow::Table> &table,
                                   const std::vector<int> &col_ids,
                                   std::unique_ptr<TableRowIndexEqualTo> *out_equal_to,
@@ -766,14 +988,11 @@ Status TableRowIndexEqualTo::Make(const std::shared_ptr<arrow::Table> &table,
   bool order_not_given = sort_order.size() == 0;
   for (std::size_t i = 0; i < col_ids.size(); i++) {
     int col_id = col_ids[i];
-    if (table->column(col_id)->num_chunks() > 1) {
-      return {Code::Invalid, "TableRowIndexEqualTo does not support multiple chunks"};
-    }
-
     if (table->num_rows() == 0) {
       comps->emplace_back(std::make_shared<EmptyIndexComparator>());
     } else {
-      const auto &array = table->column(col_id)->chunk(0);
+      // chunked columns are compared in place
+      const auto &array = table->column(col_id);
       std::unique_ptr<ArrayIndexComparator> comp;
       RETURN_CYLON_STATUS_IF_FAILED(CreateArrayIndexComparator(array, &comp, order_not_given || sort_order[i]));
       comps->emplace_back(std::move(comp));
@@ -936,13 +1155,8 @@ Status DualTableRowIndexEqualTo::Make(const std::shared_ptr<arrow::Table> &t1,
   bool order_not_given = sort_order.size() == 0;
 
   for (int i = 0; i < num_cols; i++) {
-    if (t1->column(t1_indices[i])->num_chunks() > 1
-        || t2->column(t2_indices[i])->num_chunks() > 1) {
-      return {Code::Invalid, "DualTableRowIndexEqualTo does not support multiple chunks"};
-    }
-
-    const auto &a1 = util::GetChunkOrEmptyArray(t1->column(t1_indices[i]), 0);
-    const auto &a2 = util::GetChunkOrEmptyArray(t2->column(t2_indices[i]), 0);
+    const auto &a1 = t1->column(t1_indices[i]);
+    const auto &a2 = t2->column(t2_indices[i]);
 
     std::unique_ptr<DualArrayIndexComparator> comp;
 
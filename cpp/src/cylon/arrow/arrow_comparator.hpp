@@ -100,6 +100,18 @@ Status CreateArrayIndexComparator(const std::shared_ptr<arrow::Array> &array,
                                   std::unique_ptr<ArrayIndexComparator> *out_comp,
                                   bool asc = true, bool null_order = true);
 
+/**
+ * Creates a comparator for a chunked array. Indices are row indices of the chunked array, which are
+ * resolved to (chunk, offset) when comparing, hence the chunks need not be combined.
+ * @param array
+ * @param asc ? ascending: descending
+ * @param null_order ? null values considered as largest : null values considered as smallest
+ * @return
+ */
+Status CreateArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &array,
+                                  std::unique_ptr<ArrayIndexComparator> *out_comp,
+                                  bool asc = true, bool null_order = true);
+
 // -----------------------------------------------------------------------------
 
 /**
@@ -154,10 +166,24 @@ Status CreateDualArrayIndexComparator(const std::shared_ptr<arrow::Array> &a1,
                                       std::unique_ptr<DualArrayIndexComparator> *out_comp,
                                       bool asc = true, bool null_order = true);
 
+/**
+ * Creates a comparator for two chunked arrays, with (chunk, offset) addressing of the row indices
+ * @param a1
+ * @param a2
+ * @param asc ? ascending: descending
+ * @param null_order ? null values considered as largest : null values considered as smallest
+ * @return
+ */
+Status CreateDualArrayIndexComparator(const std::shared_ptr<arrow::ChunkedArray> &a1,
+                                      const std::shared_ptr<arrow::ChunkedArray> &a2,
+                                      std::unique_ptr<DualArrayIndexComparator> *out_comp,
+                                      bool asc = true, bool null_order = true);
+
 // -----------------------------------------------------------------------------
 
 /**
- * comparator to compare indices within a table based on multiple column indices
+ * comparator to compare indices within a table based on multiple column indices. Columns may have
+ * multiple chunks.
  */
 class TableRowIndexEqualTo {
  public:
@@ -190,7 +216,7 @@ class TableRowIndexEqualTo {
 // -----------------------------------------------------------------------------
 
 /**
- * hash index within a table based on multiple column indices.
+ * hash index within a table based on multiple column indices. Columns may have multiple chunks.
  * Note: A composite hash would be precomputed in the constructor
  */
 class TableRowIndexHash {
@@ -262,7 +288,7 @@ class DualTableRowIndexHash {
 // -----------------------------------------------------------------------------
 
 /**
- * Equal-to function for two tables, based on the rows.
+ * Equal-to function for two tables, based on the rows. Columns may have multiple chunks.
  * IMPORTANT: to uniquely identify rows of t1 and t2, the most significant bit of index value is encoded as,
  *  0 --> t1
  *  1 --> t2
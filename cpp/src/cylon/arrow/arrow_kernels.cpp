@@ -20,7 +20,9 @@
 #include <cylon/util/macros.hpp>
 #include <cylon/util/sort.hpp>
 #include <cylon/util/arrow_utils.hpp>
+#include <cylon/util/parallel.hpp>
 #include <cylon/arrow/arrow_comparator.hpp>
+#include <cylon/arrow/arrow_radix_sort.hpp>
 #include <utility>
 
 namespace cylon {
@@ -323,8 +325,8 @@ class ArrowBinarySortKernel : public IndexSortKernel {
   using ARRAY_T = typename arrow::TypeTraits<ARROW_T>::ArrayType;
 
  public:
-  ArrowBinarySortKernel(arrow::MemoryPool *pool, bool ascending)
-      : IndexSortKernel(pool, ascending) {}
+  ArrowBinarySortKernel(arrow::MemoryPool *pool, bool ascending, int num_threads)
+      : IndexSortKernel(pool, ascending, num_threads) {}
 
   arrow::Status Sort(const std::shared_ptr<arrow::Array> &values,
                      std::shared_ptr<arrow::UInt64Array> &offsets) const override {
@@ -335,13 +337,13 @@ class ArrowBinarySortKernel : public IndexSortKernel {
           [&array](uint64_t left, uint64_t right) {
             return array->GetView(left).compare(array->GetView(right)) < 0;
           },
-          values->length(), pool_, offsets);
+          values->length(), pool_, offsets, num_threads);
     } else {
       return do_sort(
           [&array](uint64_t left, uint64_t right) {
             return array->GetView(left).compare(array->GetView(right)) > 0;
           },
-          values->length(), pool_, offsets);
+          values->length(), pool_, offsets, num_threads);
     }
   }
 };
@@ -353,8 +355,8 @@ class NumericIndexSortKernel : public IndexSortKernel {
  public:
   using T = typename TYPE::c_type;
 
-  NumericIndexSortKernel(arrow::MemoryPool *pool, bool ascending)
-      : IndexSortKernel(pool, ascending) {}
+  NumericIndexSortKernel(arrow::MemoryPool *pool, bool ascending, int num_threads)
+      : IndexSortKernel(pool, ascending, num_threads) {}
 
   arrow::Status Sort(const std::shared_ptr<arrow::Array> &values,
                      std::shared_ptr<arrow::UInt64Array> &offsets) const override {
@@ -365,11 +367,11 @@ class NumericIndexSortKernel : public IndexSortKernel {
     if (ascending) {
       return do_sort([&left_data](uint64_t left,
                                   uint64_t right) { return left_data[left] < left_data[right]; },
-                     values->length(), pool_, offsets);
+                     values->length(), pool_, offsets, num_threads);
     } else {
       return do_sort([&left_data](uint64_t left,
                                   uint64_t right) { return left_data[left] > left_data[right]; },
-                     values->length(), pool_, offsets);
+                     values->length(), pool_, offsets, num_threads);
     }
   }
 };
@@ -387,36 +389,40 @@ using FloatArraySorter = NumericIndexSortKernel<arrow::FloatType>;
 using DoubleArraySorter = NumericIndexSortKernel<arrow::DoubleType>;
 
 std::unique_ptr<IndexSortKernel> CreateSorter(const std::shared_ptr<arrow::DataType> &type,
-                                              arrow::MemoryPool *pool, bool ascending) {
+                                              arrow::MemoryPool *pool, bool ascending,
+                                              int num_threads) {
   switch (type->id()) {
-    case arrow::Type::UINT8:return std::make_unique<UInt8ArraySorter>(pool, ascending);
-    case arrow::Type::INT8:return std::make_unique<Int8ArraySorter>(pool, ascending);
-    case arrow::Type::UINT16:return std::make_unique<UInt16ArraySorter>(pool, ascending);
-    case arrow::Type::INT16:return std::make_unique<Int16ArraySorter>(pool, ascending);
-    case arrow::Type::UINT32:return std::make_unique<UInt32ArraySorter>(pool, ascending);
-    case arrow::Type::INT32:return std::make_unique<Int32ArraySorter>(pool, ascending);
-    case arrow::Type::UINT64:return std::make_unique<UInt64ArraySorter>(pool, ascending);
-    case arrow::Type::INT64:return std::make_unique<Int64ArraySorter>(pool, ascending);
-    case arrow::Type::FLOAT:return std::make_unique<FloatArraySorter>(pool, ascending);
-    case arrow::Type::DOUBLE:return std::make_unique<DoubleArraySorter>(pool, ascending);
-    case arrow::Type::STRING:return std::make_unique<ArrowBinarySortKernel<arrow::StringType>>(pool, ascending);
-    case arrow::Type::BINARY:return std::make_unique<ArrowBinarySortKernel<arrow::BinaryType>>(pool, ascending);
+    case arrow::Type::UINT8:return std::make_unique<UInt8ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::INT8:return std::make_unique<Int8ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::UINT16:return std::make_unique<UInt16ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::INT16:return std::make_unique<Int16ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::UINT32:return std::make_unique<UInt32ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::INT32:return std::make_unique<Int32ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::UINT64:return std::make_unique<UInt64ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::INT64:return std::make_unique<Int64ArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::FLOAT:return std::make_unique<FloatArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::DOUBLE:return std::make_unique<DoubleArraySorter>(pool, ascending, num_threads);
+    case arrow::Type::STRING:return std::make_unique<ArrowBinarySortKernel<arrow::StringType>>(pool, ascending, num_threads);
+    case arrow::Type::BINARY:return std::make_unique<ArrowBinarySortKernel<arrow::BinaryType>>(pool, ascending, num_threads);
     case arrow::Type::FIXED_SIZE_BINARY:
       return std::make_unique<ArrowBinarySortKernel<arrow::FixedSizeBinaryType>>(pool,
-                                                                                 ascending);
-    case arrow::Type::DATE32:return std::make_unique<NumericIndexSortKernel<arrow::Date32Type>>(pool, ascending);
-    case arrow::Type::DATE64:return std::make_unique<NumericIndexSortKernel<arrow::Date64Type>>(pool, ascending);
-    case arrow::Type::TIMESTAMP:return std::make_unique<NumericIndexSortKernel<arrow::TimestampType>>(pool, ascending);
-    case arrow::Type::TIME32:return std::make_unique<NumericIndexSortKernel<arrow::Time32Type>>(pool, ascending);
-    case arrow::Type::TIME64:return std::make_unique<NumericIndexSortKernel<arrow::Time64Type>>(pool, ascending);
+                                                                                 ascending,
+                                                                                 num_threads);
+    case arrow::Type::DATE32:return std::make_unique<NumericIndexSortKernel<arrow::Date32Type>>(pool, ascending, num_threads);
+    case arrow::Type::DATE64:return std::make_unique<NumericIndexSortKernel<arrow::Date64Type>>(pool, ascending, num_threads);
+    case arrow::Type::TIMESTAMP:return std::make_unique<NumericIndexSortKernel<arrow::TimestampType>>(pool, ascending, num_threads);
+    case arrow::Type::TIME32:return std::make_unique<NumericIndexSortKernel<arrow::Time32Type>>(pool, ascending, num_threads);
+    case arrow::Type::TIME64:return std::make_unique<NumericIndexSortKernel<arrow::Time64Type>>(pool, ascending, num_threads);
     default:return nullptr;
   }
 }
 
 arrow::Status SortIndices(arrow::MemoryPool *memory_pool,
                           const std::shared_ptr<arrow::Array> &values,
-                          std::shared_ptr<arrow::UInt64Array> &offsets, bool ascending) {
-  std::unique_ptr<IndexSortKernel> out = CreateSorter(values->type(), memory_pool, ascending);
+                          std::shared_ptr<arrow::UInt64Array> &offsets, bool ascending,
+                          int num_threads) {
+  std::unique_ptr<IndexSortKernel> out = CreateSorter(values->type(), memory_pool, ascending,
+                                                      num_threads);
   if (out == nullptr) {
     return arrow::Status::NotImplemented("unknown type " + values->type()->ToString());
   }
@@ -505,7 +511,7 @@ arrow::Status SortIndicesInPlace(arrow::MemoryPool *memory_pool,
 
 template<typename Comparator>
 arrow::Status do_sort(Comparator &&comp, int64_t len, arrow::MemoryPool *pool,
-                      std::shared_ptr<arrow::UInt64Array> &offsets) {
+                      std::shared_ptr<arrow::UInt64Array> &offsets, int num_threads) {
   auto buf_size = static_cast<int64_t>(len * sizeof(int64_t));
 
   arrow::Result<std::unique_ptr<arrow::Buffer>> result = arrow::AllocateBuffer(buf_size, pool);
@@ -517,8 +523,11 @@ arrow::Status do_sort(Comparator &&comp, int64_t len, arrow::MemoryPool *pool,
     indices_begin[i] = i;
   }
 
-  int64_t *indices_end = indices_begin + len;
-  std::sort(indices_begin, indices_end, comp);
+  // stable, so that the result is the same for any number of threads
+  const auto &status = util::ParallelStableSort(num_threads, indices_begin, len, comp);
+  if (!status.is_ok()) {
+    return arrow::Status::ExecutionError(status.get_msg());
+  }
   offsets = std::make_shared<arrow::UInt64Array>(len, indices_buf);
   return arrow::Status::OK();
 }
@@ -529,45 +538,31 @@ arrow::Status SortIndicesMultiColumns(arrow::MemoryPool *memory_pool,
                                       const std::shared_ptr<arrow::Table> &table,
                                       const std::vector<int32_t> &columns,
                                       std::shared_ptr<arrow::UInt64Array> &offsets,
-                                      const std::vector<bool> &ascending) {
+                                      const std::vector<bool> &ascending,
+                                      int num_threads) {
   if (columns.size() != ascending.size()) {
     return arrow::Status::Invalid("No of sort columns and no of sort direction indicators mismatch");
   }
 
-  if (util::CheckArrowTableContainsChunks(table, columns)){
-    return arrow::Status::Invalid("SortIndicesMultiColumns can not handle chunked columns");
+  // radix sort normalized keys, rather than comparing the columns one by one
+  if (IsNormalizedKeySortSupported(table, columns)) {
+    return SortIndicesNormalized(memory_pool, table, columns, ascending, offsets, num_threads);
   }
 
   std::vector<std::shared_ptr<ArrayIndexComparator>> comparators;
   comparators.reserve(columns.size());
   for (size_t i = 0; i < columns.size(); i++) {
     std::unique_ptr<ArrayIndexComparator> comp;
-    auto status =
-        CreateArrayIndexComparator(cylon::util::GetChunkOrEmptyArray(table->column(columns[i]), 0),
-                                   &comp, ascending[i], /*null_order=*/true);
+    // chunked columns are compared in place
+    auto status = CreateArrayIndexComparator(table->column(columns[i]), &comp, ascending[i],
+                                             /*null_order=*/true);
     if (!status.is_ok()) {
       return arrow::Status::Invalid(status.get_msg());
     }
     comparators.emplace_back(std::move(comp));
   }
 
-  auto buf_size = (int64_t) (table->num_rows() * sizeof(int64_t));
-
-  arrow::Result<std::unique_ptr<arrow::Buffer>> result = arrow::AllocateBuffer(buf_size, memory_pool);
-  const arrow::Status &status = result.status();
-  if (!status.ok()) {
-    LOG(FATAL) << "Failed to allocate sort indices - " << status.message();
-    return status;
-  }
-  std::shared_ptr<arrow::Buffer> indices_buf(std::move(result.ValueOrDie()));
-
-  auto *indices_begin = reinterpret_cast<int64_t *>(indices_buf->mutable_data());
-  for (int64_t i = 0; i < table->num_rows(); i++) {
-    indices_begin[i] = i;
-  }
-
-  int64_t *indices_end = indices_begin + table->num_rows();
-  std::sort(indices_begin, indices_end, [&comparators](int64_t idx1, int64_t idx2) {
+  return do_sort([&comparators](int64_t idx1, int64_t idx2) {
     for (auto const &comp: comparators) {
       auto res = comp->compare(idx1, idx2);
       if (res != 0) {
@@ -575,10 +570,7 @@ arrow::Status SortIndicesMultiColumns(arrow::MemoryPool *memory_pool,
       }
     }
     return false; // if this point is reached, that means every comparison has returned 0! so, equal. i.e. NOT less
-  });
-
-  offsets = std::make_shared<arrow::UInt64Array>(table->num_rows(), indices_buf);
-  return arrow::Status::OK();
+  }, table->num_rows(), memory_pool, offsets, num_threads);
 }
 
 arrow::Status SortIndicesMultiColumns(arrow::MemoryPool *memory_pool,
@@ -52,7 +52,8 @@ std::unique_ptr<ArrowArraySplitKernel> CreateSplitter(const std::shared_ptr<arro
 
 class IndexSortKernel {
  public:
-  IndexSortKernel(arrow::MemoryPool *pool, bool ascending) : pool_(pool), ascending(ascending) {}
+  IndexSortKernel(arrow::MemoryPool *pool, bool ascending, int num_threads = 1)
+      : pool_(pool), ascending(ascending), num_threads(num_threads) {}
 
   /**
    * Sort the values in the column and return an array with the indices
@@ -70,18 +71,22 @@ class IndexSortKernel {
 
   arrow::MemoryPool *pool_;
   bool ascending;
+  int num_threads;
 };
 
 /**
- * sort indices
+ * sort indices. The sort is stable, and the result does not depend on the number of threads.
  * @param memory_pool
  * @param values
  * @param offsets
+ * @param ascending
+ * @param num_threads
  * @return
  */
 arrow::Status SortIndices(arrow::MemoryPool *memory_pool,
                           const std::shared_ptr<arrow::Array> &values,
-                          std::shared_ptr<arrow::UInt64Array> &offsets, bool ascending = true);
+                          std::shared_ptr<arrow::UInt64Array> &offsets, bool ascending = true,
+                          int num_threads = 1);
 
 // -----------------------------------------------------------------------------
 
@@ -118,11 +123,24 @@ arrow::Status SortIndicesInPlace(arrow::MemoryPool *memory_pool,
                                  std::shared_ptr<arrow::Array> &values,
                                  std::shared_ptr<arrow::UInt64Array> &offsets);
 
+/**
+ * sort indices by multiple columns. The sort is stable, and the result does not depend on the
+ * number of threads. Sort columns may have multiple chunks, and the indices are row indices of
+ * the table.
+ * @param memory_pool
+ * @param table
+ * @param columns
+ * @param offsets
+ * @param ascending
+ * @param num_threads
+ * @return
+ */
 arrow::Status SortIndicesMultiColumns(arrow::MemoryPool *memory_pool,
                                       const std::shared_ptr<arrow::Table> &table,
                                       const std::vector<int32_t> &columns,
                                       std::shared_ptr<arrow::UInt64Array> &offsets,
-                                      const std::vector<bool> &ascending);
+                                      const std::vector<bool> &ascending,
+                                      int num_threads = 1);
 
 arrow::Status SortIndicesMultiColumns(arrow::MemoryPool *memory_pool,
                                       const std::shared_ptr<arrow::Table> &table,
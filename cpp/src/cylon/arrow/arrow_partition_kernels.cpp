@@ -86,11 +86,13 @@ class ModuloPartitionKernel : public HashPartitionKernel {
       return {Code::Invalid, "target partitions or histogram not initialized!"};
     }
 
+    // the hash is truncated to uint32 as in UpdateHash, so that a row goes to the partition
+    // hash % num_partitions of its HashRows hash, for 64 bit values as well
     if (if_power2(num_partitions)) {
       return visit_chunked_array<ARROW_T>(
           idx_col,
           [&](uint64_t offset, T val) {
-            T pseudo_hash = 31 * target_partitions[offset] + val;
+            const auto pseudo_hash = static_cast<uint32_t>(31 * target_partitions[offset] + val);
             uint32_t p = mod_power2(pseudo_hash, num_partitions);
             target_partitions[offset] = p;
             partition_histogram[p]++;
@@ -104,7 +106,7 @@ class ModuloPartitionKernel : public HashPartitionKernel {
       return visit_chunked_array<ARROW_T>(
           idx_col,
           [&](uint64_t offset, T val) {
-            T pseudo_hash = 31 * target_partitions[offset] + val;
+            const auto pseudo_hash = static_cast<uint32_t>(31 * target_partitions[offset] + val);
             uint32_t p = mod(pseudo_hash, num_partitions);
             target_partitions[offset] = p;
             partition_histogram[p]++;
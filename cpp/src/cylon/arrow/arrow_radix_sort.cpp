@@ -0,0 +1,556 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <cylon/arrow/arrow_radix_sort.hpp>
+#include <cylon/arrow/arrow_comparator.hpp>
+#include <cylon/util/arrow_utils.hpp>
+#include <cylon/util/macros.hpp>
+#include <cylon/util/parallel.hpp>
+
+namespace cylon {
+
+// buckets smaller than this are sorted with std::sort
+static constexpr int64_t kRadixSortCutoff = 64;
+
+// rows per thread below which a parallel sort is not worth it
+static constexpr int64_t kMinParallelSortRows = 1 << 14;
+
+struct ColumnKey {
+  std::shared_ptr<arrow::ChunkedArray> column;
+  bool asc;
+  bool nullable;
+  // byte offset of the column in the key
+  int pos;
+};
+
+/**
+ * Number of bytes of a value in the key. 0 if the type is not supported
+ */
+static int ValueBytes(const std::shared_ptr<arrow::DataType> &type, bool *prefix) {
+  *prefix = false;
+  switch (type->id()) {
+    case arrow::Type::UINT8:
+    case arrow::Type::INT8:
+    case arrow::Type::UINT16:
+    case arrow::Type::INT16:
+    case arrow::Type::UINT32:
+    case arrow::Type::INT32:
+    case arrow::Type::UINT64:
+    case arrow::Type::INT64:
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+    case arrow::Type::DATE32:
+    case arrow::Type::DATE64:
+    case arrow::Type::TIMESTAMP:
+    case arrow::Type::TIME32:
+    case arrow::Type::TIME64:
+      return std::static_pointer_cast<arrow::FixedWidthType>(type)->bit_width() / 8;
+    case arrow::Type::FIXED_SIZE_BINARY:
+      // short values are padded, and fully ordered by the key
+      *prefix = std::static_pointer_cast<arrow::FixedSizeBinaryType>(type)->byte_width()
+          > kNormalizedKeyPrefixBytes;
+      return kNormalizedKeyPrefixBytes;
+    case arrow::Type::STRING:
+    case arrow::Type::LARGE_STRING:
+    case arrow::Type::BINARY:
+    case arrow::Type::LARGE_BINARY:*prefix = true;
+      return kNormalizedKeyPrefixBytes;
+    default:return 0;
+  }
+}
+
+/**
+ * Lays out the sort columns in the key
+ * @param keys encoded columns
+ * @param tail first column that is not fully ordered by the key
+ * @return key bytes
+ */
+static int PlanKeys(const std::shared_ptr<arrow::Table> &table,
+                    const std::vector<int32_t> &columns,
+                    const std::vector<bool> &ascending,
+                    std::vector<ColumnKey> *keys,
+                    size_t *tail) {
+  int pos = 0;
+  *tail = columns.size();
+  for (size_t c = 0; c < columns.size(); c++) {
+    const auto &column = table->column(columns[c]);
+    const bool nullable = column->null_count() > 0;
+    bool prefix;
+    const int bytes = ValueBytes(column->type(), &prefix);
+    if (bytes == 0 || pos + nullable + bytes > kMaxNormalizedKeyBytes) {
+      *tail = c;
+      break;
+    }
+    keys->push_back({column, ascending[c], nullable, pos});
+    pos += nullable + bytes;
+    if (prefix) {
+      *tail = c;
+      break;
+    }
+  }
+  return pos;
+}
+
+bool IsNormalizedKeySortSupported(const std::shared_ptr<arrow::Table> &table,
+                                  const std::vector<int32_t> &columns) {
+  std::vector<ColumnKey> keys;
+  size_t tail;
+  return PlanKeys(table, columns, std::vector<bool>(columns.size(), true), &keys, &tail) > 0;
+}
+
+/**
+ * Writes the low `bytes` bytes of v at byte pos of the key, ie. the words of a row
+ */
+static inline void PutBytes(uint64_t *words, int pos, uint64_t v, int bytes) {
+  const int word = pos / 8;
+  const int shift = 64 - 8 * (pos % 8) - 8 * bytes;
+  if (shift >= 0) {
+    words[word] |= v << shift;
+  } else {
+    words[word] |= v >> -shift;
+    words[word + 1] |= v << (64 + shift);
+  }
+}
+
+static inline uint64_t ValueMask(int bytes) {
+  return bytes == 8 ? std::numeric_limits<uint64_t>::max() : (uint64_t(1) << (8 * bytes)) - 1;
+}
+
+// unsigned representations with the same order as the values
+template<typename T>
+static inline std::enable_if_t<std::is_unsigned<T>::value, uint64_t> OrderedBits(T v) {
+  return v;
+}
+
+template<typename T>
+static inline std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, uint64_t>
+OrderedBits(T v) {
+  using U = std::make_unsigned_t<T>;
+  return static_cast<U>(static_cast<U>(v) ^ (U(1) << (sizeof(T) * 8 - 1)));
+}
+
+template<typename T>
+static inline std::enable_if_t<std::is_floating_point<T>::value, uint64_t> OrderedBits(T v) {
+  using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  if (v == 0) {
+    v = 0; // -0.0 == 0.0
+  } else if (std::isnan(v)) {
+    v = std::fabs(std::numeric_limits<T>::quiet_NaN()); // after inf
+  }
+  U u;
+  std::memcpy(&u, &v, sizeof(T));
+  const U sign = U(1) << (sizeof(T) * 8 - 1);
+  return static_cast<U>((u & sign) ? ~u : (u | sign));
+}
+
+template<typename ArrowT>
+static void EncodeValues(const ColumnKey &key, const std::shared_ptr<arrow::Array> &array,
+                         int64_t begin, int64_t end, uint64_t *words, int stride) {
+  using T = typename ArrowT::c_type;
+  const T *values = array->data()->template GetValues<T>(1);
+  const int bytes = sizeof(T);
+  const uint64_t mask = key.asc ? 0 : ValueMask(bytes);
+  if (key.nullable) {
+    const uint64_t null_mask = key.asc ? 0 : ValueMask(1);
+    for (int64_t i = begin; i < end; i++, words += stride) {
+      const bool is_null = array->IsNull(i);
+      PutBytes(words, key.pos, uint64_t(is_null) ^ null_mask, 1);
+      PutBytes(words, key.pos + 1, (is_null ? 0 : OrderedBits(values[i])) ^ mask, bytes);
+    }
+  } else {
+    for (int64_t i = begin; i < end; i++, words += stride) {
+      PutBytes(words, key.pos, OrderedBits(values[i]) ^ mask, bytes);
+    }
+  }
+}
+
+template<typename ArrowT>
+static void EncodePrefixes(const ColumnKey &key, const std::shared_ptr<arrow::Array> &chunk,
+                           int64_t begin, int64_t end, uint64_t *words, int stride) {
+  using ArrayT = typename arrow::TypeTraits<ArrowT>::ArrayType;
+  const auto &array = std::static_pointer_cast<ArrayT>(chunk);
+  const uint64_t mask = key.asc ? 0 : ValueMask(kNormalizedKeyPrefixBytes);
+  const uint64_t null_mask = key.asc ? 0 : ValueMask(1);
+  const int pos = key.pos + key.nullable;
+  for (int64_t i = begin; i < end; i++, words += stride) {
+    const bool is_null = key.nullable && array->IsNull(i);
+    if (key.nullable) {
+      PutBytes(words, key.pos, uint64_t(is_null) ^ null_mask, 1);
+    }
+    // leading bytes, padded with 0s
+    uint64_t prefix = 0;
+    if (!is_null) {
+      const auto &view = array->GetView(i);
+      const size_t len = std::min(view.size(), static_cast<size_t>(kNormalizedKeyPrefixBytes));
+      for (size_t j = 0; j < len; j++) {
+        prefix |= static_cast<uint64_t>(static_cast<uint8_t>(view[j])) << (56 - 8 * j);
+      }
+    }
+    PutBytes(words, pos, prefix ^ mask, kNormalizedKeyPrefixBytes);
+  }
+}
+
+/**
+ * Encodes the rows [begin, end) of a chunk of a column. words point to the first of these rows.
+ */
+static void EncodeChunk(const ColumnKey &key, const std::shared_ptr<arrow::Array> &chunk,
+                        int64_t begin, int64_t end, uint64_t *words, int stride) {
+  switch (chunk->type_id()) {
+    case arrow::Type::UINT8:
+      return EncodeValues<arrow::UInt8Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::INT8:
+      return EncodeValues<arrow::Int8Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::UINT16:
+      return EncodeValues<arrow::UInt16Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::INT16:
+      return EncodeValues<arrow::Int16Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::UINT32:
+      return EncodeValues<arrow::UInt32Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::INT32:
+      return EncodeValues<arrow::Int32Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::UINT64:
+      return EncodeValues<arrow::UInt64Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::INT64:
+      return EncodeValues<arrow::Int64Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::FLOAT:
+      return EncodeValues<arrow::FloatType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::DOUBLE:
+      return EncodeValues<arrow::DoubleType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::DATE32:
+      return EncodeValues<arrow::Date32Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::DATE64:
+      return EncodeValues<arrow::Date64Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::TIMESTAMP:
+      return EncodeValues<arrow::TimestampType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::TIME32:
+      return EncodeValues<arrow::Time32Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::TIME64:
+      return EncodeValues<arrow::Time64Type>(key, chunk, begin, end, words, stride);
+    case arrow::Type::STRING:
+      return EncodePrefixes<arrow::StringType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::LARGE_STRING:
+      return EncodePrefixes<arrow::LargeStringType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::BINARY:
+      return EncodePrefixes<arrow::BinaryType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::LARGE_BINARY:
+      return EncodePrefixes<arrow::LargeBinaryType>(key, chunk, begin, end, words, stride);
+    case arrow::Type::FIXED_SIZE_BINARY:
+      return EncodePrefixes<arrow::FixedSizeBinaryType>(key, chunk, begin, end, words, stride);
+    default:return;
+  }
+}
+
+/**
+ * Encodes the rows [begin, end) of a column, from the chunks that hold them. words point to the
+ * first of these rows.
+ */
+static void EncodeColumn(const ColumnKey &key, int64_t begin, int64_t end, uint64_t *words,
+                         int stride) {
+  int64_t chunk_begin = 0;
+  for (const auto &chunk: key.column->chunks()) {
+    const int64_t chunk_end = chunk_begin + chunk->length();
+    const int64_t lo = std::max(begin, chunk_begin), hi = std::min(end, chunk_end);
+    if (lo < hi) {
+      EncodeChunk(key, chunk, lo - chunk_begin, hi - chunk_begin, words + (lo - begin) * stride,
+                  stride);
+    }
+    if (chunk_end >= end) {
+      break;
+    }
+    chunk_begin = chunk_end;
+  }
+}
+
+/**
+ * A row of the sort. The key bytes are in the words, most significant byte first.
+ */
+template<int K>
+struct KeyRow {
+  uint64_t key[K];
+  int64_t index;
+};
+
+template<int K>
+static inline bool KeyEquals(const KeyRow<K> &a, const KeyRow<K> &b) {
+  for (int k = 0; k < K; k++) {
+    if (a.key[k] != b.key[k]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<int K>
+static inline bool RowLess(const KeyRow<K> &a, const KeyRow<K> &b) {
+  for (int k = 0; k < K; k++) {
+    if (a.key[k] != b.key[k]) {
+      return a.key[k] < b.key[k];
+    }
+  }
+  return a.index < b.index;
+}
+
+template<int K>
+static inline uint8_t Digit(const KeyRow<K> &row, int byte) {
+  return static_cast<uint8_t>(row.key[byte / 8] >> (56 - 8 * (byte % 8)));
+}
+
+/**
+ * MSD radix sort of the rows from the given key byte. The scatter is stable, so rows with equal
+ * keys stay in the order of their indices.
+ */
+template<int K>
+static void MsdRadixSort(KeyRow<K> *rows, KeyRow<K> *tmp, int64_t n, int byte, int key_bytes) {
+  while (n > kRadixSortCutoff && byte < key_bytes) {
+    int64_t counts[256] = {0};
+    for (int64_t i = 0; i < n; i++) {
+      counts[Digit(rows[i], byte)]++;
+    }
+    // skip the bytes that are the same in all rows
+    if (counts[Digit(rows[0], byte)] == n) {
+      byte++;
+      continue;
+    }
+
+    int64_t starts[256];
+    int64_t start = 0;
+    for (int d = 0; d < 256; d++) {
+      starts[d] = start;
+      start += counts[d];
+    }
+    for (int64_t i = 0; i < n; i++) {
+      tmp[starts[Digit(rows[i], byte)]++] = rows[i];
+    }
+    std::copy(tmp, tmp + n, rows);
+
+    start = 0;
+    for (int d = 0; d < 256; start += counts[d], d++) {
+      if (counts[d] > 1) {
+        MsdRadixSort<K>(rows + start, tmp + start, counts[d], byte + 1, key_bytes);
+      }
+    }
+    return;
+  }
+
+  if (byte < key_bytes) {
+    std::sort(rows, rows + n, RowLess<K>);
+  }
+}
+
+static inline arrow::Status ToArrowStatus(const Status &status) {
+  return status.is_ok() ? arrow::Status::OK() : arrow::Status::ExecutionError(status.get_msg());
+}
+
+/**
+ * MsdRadixSort of all rows with num_threads threads. The first radix pass is split into row ranges
+ * (each scatters to its own offsets in the buckets, so the order is the same as a serial pass),
+ * and the buckets are then sorted in parallel.
+ */
+template<int K>
+static Status ParallelMsdRadixSort(int num_threads, KeyRow<K> *rows, KeyRow<K> *tmp, int64_t n,
+                                   int key_bytes) {
+  const int64_t num_ranges = std::min<int64_t>(num_threads, n / kMinParallelSortRows);
+  if (num_ranges <= 1) {
+    MsdRadixSort<K>(rows, tmp, n, 0, key_bytes);
+    return Status::OK();
+  }
+
+  std::vector<int64_t> bounds(num_ranges + 1);
+  for (int64_t r = 0; r <= num_ranges; r++) {
+    bounds[r] = n * r / num_ranges;
+  }
+
+  // histograms of each range, on the first byte that is not the same in all rows
+  std::vector<std::array<int64_t, 256>> counts(num_ranges);
+  std::array<int64_t, 256> totals{};
+  int byte = 0;
+  for (; byte < key_bytes; byte++) {
+    RETURN_CYLON_STATUS_IF_FAILED(util::ParallelFor(num_threads, num_ranges, [&](int64_t r) {
+      counts[r].fill(0);
+      for (int64_t i = bounds[r]; i < bounds[r + 1]; i++) {
+        counts[r][Digit(rows[i], byte)]++;
+      }
+      return Status::OK();
+    }));
+    totals.fill(0);
+    for (const auto &c: counts) {
+      for (int d = 0; d < 256; d++) {
+        totals[d] += c[d];
+      }
+    }
+    if (totals[Digit(rows[0], byte)] != n) {
+      break;
+    }
+  }
+  if (byte == key_bytes) {
+    // all keys are equal
+    return Status::OK();
+  }
+
+  // bucket d of range r starts after the rows of smaller digits, and of d in the previous ranges
+  std::array<int64_t, 256> starts{};
+  for (int d = 1; d < 256; d++) {
+    starts[d] = starts[d - 1] + totals[d - 1];
+  }
+  std::vector<std::array<int64_t, 256>> range_starts(num_ranges);
+  for (int d = 0; d < 256; d++) {
+    int64_t start = starts[d];
+    for (int64_t r = 0; r < num_ranges; r++) {
+      range_starts[r][d] = start;
+      start += counts[r][d];
+    }
+  }
+
+  RETURN_CYLON_STATUS_IF_FAILED(util::ParallelFor(num_threads, num_ranges, [&](int64_t r) {
+    auto &next = range_starts[r];
+    for (int64_t i = bounds[r]; i < bounds[r + 1]; i++) {
+      tmp[next[Digit(rows[i], byte)]++] = rows[i];
+    }
+    return Status::OK();
+  }));
+  RETURN_CYLON_STATUS_IF_FAILED(util::ParallelFor(num_threads, num_ranges, [&](int64_t r) {
+    std::copy(tmp + bounds[r], tmp + bounds[r + 1], rows + bounds[r]);
+    return Status::OK();
+  }));
+
+  return util::ParallelFor(num_threads, 256, [&](int64_t d) {
+    if (totals[d] > 1) {
+      MsdRadixSort<K>(rows + starts[d], tmp + starts[d], totals[d], byte + 1, key_bytes);
+    }
+    return Status::OK();
+  });
+}
+
+template<int K>
+static arrow::Status SortRows(arrow::MemoryPool *memory_pool,
+                              const std::shared_ptr<arrow::Table> &table,
+                              const std::vector<int32_t> &columns,
+                              const std::vector<bool> &ascending,
+                              const std::vector<ColumnKey> &keys,
+                              int key_bytes,
+                              size_t tail,
+                              int num_threads,
+                              std::shared_ptr<arrow::UInt64Array> &offsets) {
+  static_assert(sizeof(KeyRow<K>) == (K + 1) * sizeof(uint64_t), "unexpected padding");
+  const int64_t num_rows = table->num_rows();
+  const int64_t num_ranges = std::max<int64_t>(1, std::min<int64_t>(num_threads,
+                                                                    num_rows / kMinParallelSortRows));
+
+  std::vector<KeyRow<K>> rows(num_rows);
+  RETURN_ARROW_STATUS_IF_FAILED(ToArrowStatus(util::ParallelFor(num_threads, num_ranges,
+                                                                [&](int64_t r) {
+    const int64_t begin = num_rows * r / num_ranges, end = num_rows * (r + 1) / num_ranges;
+    for (int64_t i = begin; i < end; i++) {
+      rows[i].index = i;
+    }
+    auto *words = reinterpret_cast<uint64_t *>(rows.data() + begin);
+    for (const auto &key: keys) {
+      EncodeColumn(key, begin, end, words, K + 1);
+    }
+    return Status::OK();
+  })));
+
+  {
+    std::vector<KeyRow<K>> tmp(num_rows);
+    RETURN_ARROW_STATUS_IF_FAILED(ToArrowStatus(
+        ParallelMsdRadixSort<K>(num_threads, rows.data(), tmp.data(), num_rows, key_bytes)));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto indices_buf, arrow::AllocateBuffer(num_rows * sizeof(int64_t),
+                                                                memory_pool))
+  auto *indices = reinterpret_cast<int64_t *>(indices_buf->mutable_data());
+  for (int64_t i = 0; i < num_rows; i++) {
+    indices[i] = rows[i].index;
+  }
+
+  if (tail < columns.size()) {
+    // order the rows with equal keys by the remaining columns
+    std::vector<std::unique_ptr<ArrayIndexComparator>> comparators;
+    for (size_t c = tail; c < columns.size(); c++) {
+      std::unique_ptr<ArrayIndexComparator> comp;
+      const auto &status = CreateArrayIndexComparator(table->column(columns[c]), &comp,
+                                                      ascending[c], /*null_order=*/true);
+      if (!status.is_ok()) {
+        return arrow::Status::Invalid(status.get_msg());
+      }
+      comparators.push_back(std::move(comp));
+    }
+    auto less = [&comparators](int64_t idx1, int64_t idx2) {
+      for (const auto &comp: comparators) {
+        const int res = comp->compare(idx1, idx2);
+        if (res != 0) {
+          return res < 0;
+        }
+      }
+      return idx1 < idx2;
+    };
+
+    std::vector<std::pair<int64_t, int64_t>> ties;
+    for (int64_t i = 0, j; i < num_rows; i = j) {
+      for (j = i + 1; j < num_rows && KeyEquals(rows[i], rows[j]); j++) {}
+      if (j - i > 1) {
+        ties.emplace_back(i, j);
+      }
+    }
+    RETURN_ARROW_STATUS_IF_FAILED(ToArrowStatus(util::ParallelFor(num_threads, ties.size(),
+                                                                  [&](int64_t t) {
+      std::sort(indices + ties[t].first, indices + ties[t].second, less);
+      return Status::OK();
+    })));
+  }
+
+  offsets = std::make_shared<arrow::UInt64Array>(num_rows, std::move(indices_buf));
+  return arrow::Status::OK();
+}
+
+arrow::Status SortIndicesNormalized(arrow::MemoryPool *memory_pool,
+                                    const std::shared_ptr<arrow::Table> &table,
+                                    const std::vector<int32_t> &columns,
+                                    const std::vector<bool> &ascending,
+                                    std::shared_ptr<arrow::UInt64Array> &offsets,
+                                    int num_threads) {
+  if (columns.size() != ascending.size()) {
+    return arrow::Status::Invalid("No of sort columns and no of sort direction indicators mismatch");
+  }
+
+  std::vector<ColumnKey> keys;
+  size_t tail;
+  const int key_bytes = PlanKeys(table, columns, ascending, &keys, &tail);
+  num_threads = util::GetNumThreads(num_threads);
+  switch ((key_bytes + 7) / 8) {
+    case 1:
+      return SortRows<1>(memory_pool, table, columns, ascending, keys, key_bytes, tail,
+                         num_threads, offsets);
+    case 2:
+      return SortRows<2>(memory_pool, table, columns, ascending, keys, key_bytes, tail,
+                         num_threads, offsets);
+    case 3:
+      return SortRows<3>(memory_pool, table, columns, ascending, keys, key_bytes, tail,
+                         num_threads, offsets);
+    case 4:
+      return SortRows<4>(memory_pool, table, columns, ascending, keys, key_bytes, tail,
+                         num_threads, offsets);
+    default:
+      return arrow::Status::NotImplemented("normalized keys are not supported for the sort columns");
+  }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_ARROW_ARROW_RADIX_SORT_HPP_
+#define CYLON_CPP_SRC_CYLON_ARROW_ARROW_RADIX_SORT_HPP_
+
+#include <arrow/api.h>
+
+namespace cylon {
+
+/**
+ * Normalized keys are at most this many bytes
+ */
+constexpr int kMaxNormalizedKeyBytes = 32;
+
+/**
+ * Number of leading bytes of a string/ binary value that go into its normalized key
+ */
+constexpr int kNormalizedKeyPrefixBytes = 8;
+
+/**
+ * Whether the sort columns of the table can be sorted with normalized keys (SortIndicesNormalized)
+ * @param table
+ * @param columns
+ * @return
+ */
+bool IsNormalizedKeySortSupported(const std::shared_ptr<arrow::Table> &table,
+                                  const std::vector<int32_t> &columns);
+
+/**
+ * Sorts the rows of a table by multiple columns, in the same order as SortIndicesMultiColumns
+ * (nulls are the largest values), using normalized keys.
+ *
+ * The sort columns of each row are encoded into a fixed width key, whose bytes compare (as
+ * unsigned, most significant first) in the same order as the row. Each column adds a null byte
+ * (if it has nulls) and the order-preserving bytes of its value (ints with the sign bit flipped,
+ * floats with the sign bit or all bits flipped), with all bytes inverted for descending columns.
+ * String/ binary columns add a kNormalizedKeyPrefixBytes prefix and end the key. Rows with equal
+ * keys are then ordered by comparing the remaining columns.
+ *
+ * Keys are sorted by a MSD radix sort, which falls back to std::sort for small buckets. Rows with
+ * equal values keep their original order.
+ *
+ * With more than one thread, the keys are encoded and scattered on the first radix byte in
+ * parallel row ranges, and the buckets are then sorted in parallel. The result is the same for
+ * any number of threads.
+ * @param memory_pool
+ * @param table sort columns may have multiple chunks, which are read in place
+ * @param columns
+ * @param ascending
+ * @param offsets
+ * @param num_threads
+ * @return
+ */
+arrow::Status SortIndicesNormalized(arrow::MemoryPool *memory_pool,
+                                    const std::shared_ptr<arrow::Table> &table,
+                                    const std::vector<int32_t> &columns,
+                                    const std::vector<bool> &ascending,
+                                    std::shared_ptr<arrow::UInt64Array> &offsets,
+                                    int num_threads = 1);
+
+}
+
+#endif //CYLON_CPP_SRC_CYLON_ARROW_ARROW_RADIX_SORT_HPP_
@@ -0,0 +1,517 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <arrow/compute/api.h>
+#include <arrow/util/bitmap_generate.h>
+#include <arrow/util/bitmap_ops.h>
+
+#include <cylon/util/macros.hpp>
+
+#include "cylon/compute/predicate.hpp"
+#include "cylon/arrow/arrow_type_traits.hpp"
+
+namespace cylon {
+namespace compute {
+
+// rows evaluated per kernel call. A multiple of 8, so that every batch starts at a byte boundary
+static constexpr int64_t kBatchSize = 4096;
+static constexpr int64_t kBatchBytes = kBatchSize / 8;
+// IN-lists up to this size are scanned linearly, larger ones are binary searched
+static constexpr size_t kLinearSearchMax = 16;
+
+template<typename T>
+struct TypeTag {
+  using type = T;
+};
+
+/**
+ * calls visitor(TypeTag<ArrowT>) for the types supported by predicate kernels
+ */
+template<typename Visitor>
+static Status VisitPredicateType(const arrow::DataType &type, Visitor &&visitor) {
+  switch (type.id()) {
+    case arrow::Type::BOOL: return visitor(TypeTag<arrow::BooleanType>());
+    case arrow::Type::UINT8: return visitor(TypeTag<arrow::UInt8Type>());
+    case arrow::Type::INT8: return visitor(TypeTag<arrow::Int8Type>());
+    case arrow::Type::UINT16: return visitor(TypeTag<arrow::UInt16Type>());
+    case arrow::Type::INT16: return visitor(TypeTag<arrow::Int16Type>());
+    case arrow::Type::UINT32: return visitor(TypeTag<arrow::UInt32Type>());
+    case arrow::Type::INT32: return visitor(TypeTag<arrow::Int32Type>());
+    case arrow::Type::UINT64: return visitor(TypeTag<arrow::UInt64Type>());
+    case arrow::Type::INT64: return visitor(TypeTag<arrow::Int64Type>());
+    case arrow::Type::FLOAT: return visitor(TypeTag<arrow::FloatType>());
+    case arrow::Type::DOUBLE: return visitor(TypeTag<arrow::DoubleType>());
+    case arrow::Type::DATE32: return visitor(TypeTag<arrow::Date32Type>());
+    case arrow::Type::DATE64: return visitor(TypeTag<arrow::Date64Type>());
+    case arrow::Type::TIMESTAMP: return visitor(TypeTag<arrow::TimestampType>());
+    case arrow::Type::TIME32: return visitor(TypeTag<arrow::Time32Type>());
+    case arrow::Type::TIME64: return visitor(TypeTag<arrow::Time64Type>());
+    case arrow::Type::DURATION: return visitor(TypeTag<arrow::DurationType>());
+    case arrow::Type::STRING: return visitor(TypeTag<arrow::StringType>());
+    case arrow::Type::LARGE_STRING: return visitor(TypeTag<arrow::LargeStringType>());
+    case arrow::Type::BINARY: return visitor(TypeTag<arrow::BinaryType>());
+    case arrow::Type::LARGE_BINARY: return visitor(TypeTag<arrow::LargeBinaryType>());
+    default:
+      return {Code::NotImplemented, "predicates are not supported for type " + type.ToString()};
+  }
+}
+
+/**
+ * ANDs the validity bits of rows [offset, offset + length) of an array into out
+ */
+static inline void AndValidity(const arrow::ArrayData &data, int64_t offset, int64_t length,
+                               uint8_t *out, uint8_t *scratch) {
+  if (data.buffers[0] == nullptr || data.GetNullCount() == 0) {
+    return;
+  }
+  arrow::internal::CopyBitmap(data.buffers[0]->data(), data.offset + offset, length, scratch, 0);
+  const int64_t num_bytes = arrow::BitUtil::BytesForBits(length);
+  for (int64_t i = 0; i < num_bytes; i++) {
+    out[i] &= scratch[i];
+  }
+}
+
+template<CompareOp Op>
+struct CompareFn {};
+
+template<>
+struct CompareFn<EQUAL> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a == b; }
+};
+
+template<>
+struct CompareFn<NOT_EQUAL> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a != b; }
+};
+
+template<>
+struct CompareFn<LESS> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a < b; }
+};
+
+template<>
+struct CompareFn<LESS_EQUAL> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a <= b; }
+};
+
+template<>
+struct CompareFn<GREATER> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a > b; }
+};
+
+template<>
+struct CompareFn<GREATER_EQUAL> {
+  template<typename T>
+  static inline bool Apply(const T &a, const T &b) { return a >= b; }
+};
+
+/**
+ * writes a constant value for every row. Used for literals that can never match
+ */
+class ConstantKernel : public PredicateKernel {
+ public:
+  explicit ConstantKernel(bool value) : value_(value) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    CYLON_UNUSED(offset);
+    std::memset(out, value_ ? 0xFF : 0, arrow::BitUtil::BytesForBits(length));
+    return Status::OK();
+  }
+
+ private:
+  bool value_;
+};
+
+template<typename ArrowT, CompareOp Op>
+class CompareKernel : public PredicateKernel {
+  using ArrayT = typename ArrowTypeTraits<ArrowT>::ArrayT;
+  using ValueT = typename ArrowTypeTraits<ArrowT>::ValueT;
+
+ public:
+  CompareKernel(const std::shared_ptr<arrow::Array> &array, std::shared_ptr<arrow::Scalar> value)
+      : array_(std::static_pointer_cast<ArrayT>(array)), value_(std::move(value)),
+        literal_(ArrowTypeTraits<ArrowT>::ExtractFromScalar(value_)), scratch_(kBatchBytes) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    const ArrayT &array = *array_;
+    int64_t i = offset;
+    arrow::internal::GenerateBitsUnrolled(out, 0, length, [&]() {
+      return CompareFn<Op>::Apply(static_cast<ValueT>(array.GetView(i++)), literal_);
+    });
+    AndValidity(*array.data(), offset, length, out, scratch_.data());
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<ArrayT> array_;
+  std::shared_ptr<arrow::Scalar> value_; // keeps string literals alive
+  ValueT literal_;
+  std::vector<uint8_t> scratch_;
+};
+
+template<typename ArrowT>
+static std::unique_ptr<PredicateKernel> MakeCompareKernel(CompareOp op,
+                                                          const std::shared_ptr<arrow::Array> &array,
+                                                          std::shared_ptr<arrow::Scalar> value) {
+  switch (op) {
+    case EQUAL:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, EQUAL>(array, std::move(value)));
+    case NOT_EQUAL:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, NOT_EQUAL>(array, std::move(value)));
+    case LESS:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, LESS>(array, std::move(value)));
+    case LESS_EQUAL:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, LESS_EQUAL>(array, std::move(value)));
+    case GREATER:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, GREATER>(array, std::move(value)));
+    case GREATER_EQUAL:
+      return std::unique_ptr<PredicateKernel>(new CompareKernel<ArrowT, GREATER_EQUAL>(array, std::move(value)));
+  }
+  return nullptr;
+}
+
+template<typename ArrowT>
+class IsInKernel : public PredicateKernel {
+  using ArrayT = typename ArrowTypeTraits<ArrowT>::ArrayT;
+  using ValueT = typename ArrowTypeTraits<ArrowT>::ValueT;
+
+ public:
+  IsInKernel(const std::shared_ptr<arrow::Array> &array, const std::shared_ptr<arrow::Array> &value_set)
+      : array_(std::static_pointer_cast<ArrayT>(array)), value_set_(value_set), scratch_(kBatchBytes) {
+    const auto &values = std::static_pointer_cast<ArrayT>(value_set_);
+    values_.reserve(values->length());
+    for (int64_t i = 0; i < values->length(); i++) {
+      if (values->IsValid(i)) {
+        const auto &val = static_cast<ValueT>(values->GetView(i));
+        if (val == val) { // NaNs never match
+          values_.push_back(val);
+        }
+      }
+    }
+    std::sort(values_.begin(), values_.end());
+    values_.erase(std::unique(values_.begin(), values_.end()), values_.end());
+  }
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    const ArrayT &array = *array_;
+    int64_t i = offset;
+    if (values_.empty()) {
+      std::memset(out, 0, arrow::BitUtil::BytesForBits(length));
+      return Status::OK();
+    } else if (values_.size() <= kLinearSearchMax) {
+      arrow::internal::GenerateBitsUnrolled(out, 0, length, [&]() {
+        const auto &val = static_cast<ValueT>(array.GetView(i++));
+        return std::any_of(values_.begin(), values_.end(), [&](const ValueT &v) { return v == val; });
+      });
+    } else {
+      arrow::internal::GenerateBitsUnrolled(out, 0, length, [&]() {
+        return std::binary_search(values_.begin(), values_.end(), static_cast<ValueT>(array.GetView(i++)));
+      });
+    }
+    AndValidity(*array.data(), offset, length, out, scratch_.data());
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<ArrayT> array_;
+  std::shared_ptr<arrow::Array> value_set_; // keeps string views alive
+  std::vector<ValueT> values_;
+  std::vector<uint8_t> scratch_;
+};
+
+class NullCheckKernel : public PredicateKernel {
+ public:
+  NullCheckKernel(std::shared_ptr<arrow::Array> array, bool is_null)
+      : array_(std::move(array)), is_null_(is_null) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    const auto &data = *array_->data();
+    const int64_t num_bytes = arrow::BitUtil::BytesForBits(length);
+    const int64_t null_count = data.GetNullCount();
+    if (data.buffers[0] == nullptr || null_count == 0 || null_count == data.length) {
+      // either all rows are valid or all are null (eg: NullType)
+      const bool all_null = null_count != 0;
+      std::memset(out, all_null == is_null_ ? 0xFF : 0, num_bytes);
+      return Status::OK();
+    }
+    arrow::internal::CopyBitmap(data.buffers[0]->data(), data.offset + offset, length, out, 0);
+    if (is_null_) {
+      for (int64_t i = 0; i < num_bytes; i++) {
+        out[i] = ~out[i];
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<arrow::Array> array_;
+  bool is_null_;
+};
+
+class AndKernel : public PredicateKernel {
+ public:
+  AndKernel(std::unique_ptr<PredicateKernel> left, std::unique_ptr<PredicateKernel> right)
+      : left_(std::move(left)), right_(std::move(right)), scratch_(kBatchBytes) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    RETURN_CYLON_STATUS_IF_FAILED(left_->Evaluate(offset, length, out));
+    if (arrow::internal::CountSetBits(out, 0, length) == 0) { // nothing left to filter
+      return Status::OK();
+    }
+    RETURN_CYLON_STATUS_IF_FAILED(right_->Evaluate(offset, length, scratch_.data()));
+    const int64_t num_bytes = arrow::BitUtil::BytesForBits(length);
+    for (int64_t i = 0; i < num_bytes; i++) {
+      out[i] &= scratch_[i];
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<PredicateKernel> left_, right_;
+  std::vector<uint8_t> scratch_;
+};
+
+class OrKernel : public PredicateKernel {
+ public:
+  OrKernel(std::unique_ptr<PredicateKernel> left, std::unique_ptr<PredicateKernel> right)
+      : left_(std::move(left)), right_(std::move(right)), scratch_(kBatchBytes) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    RETURN_CYLON_STATUS_IF_FAILED(left_->Evaluate(offset, length, out));
+    if (arrow::internal::CountSetBits(out, 0, length) == length) { // everything already selected
+      return Status::OK();
+    }
+    RETURN_CYLON_STATUS_IF_FAILED(right_->Evaluate(offset, length, scratch_.data()));
+    const int64_t num_bytes = arrow::BitUtil::BytesForBits(length);
+    for (int64_t i = 0; i < num_bytes; i++) {
+      out[i] |= scratch_[i];
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<PredicateKernel> left_, right_;
+  std::vector<uint8_t> scratch_;
+};
+
+class NotKernel : public PredicateKernel {
+ public:
+  explicit NotKernel(std::unique_ptr<PredicateKernel> child) : child_(std::move(child)) {}
+
+  Status Evaluate(int64_t offset, int64_t length, uint8_t *out) override {
+    RETURN_CYLON_STATUS_IF_FAILED(child_->Evaluate(offset, length, out));
+    const int64_t num_bytes = arrow::BitUtil::BytesForBits(length);
+    for (int64_t i = 0; i < num_bytes; i++) {
+      out[i] = ~out[i];
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<PredicateKernel> child_;
+};
+
+static Status GetColumnArray(const std::shared_ptr<arrow::Table> &table, int column,
+                             std::shared_ptr<arrow::Array> *array) {
+  if (column < 0 || column >= table->num_columns()) {
+    return {Code::IndexError, "predicate column index out of range " + std::to_string(column)};
+  }
+  const auto &chunked = table->column(column);
+  if (chunked->num_chunks() != 1) {
+    return {Code::Invalid, "predicates can only be bound to single chunk columns"};
+  }
+  *array = chunked->chunk(0);
+  return Status::OK();
+}
+
+class ComparePredicate : public Predicate {
+ public:
+  ComparePredicate(int column, CompareOp op, std::shared_ptr<arrow::Scalar> value)
+      : column_(column), op_(op), value_(std::move(value)) {}
+
+  Status Bind(const std::shared_ptr<arrow::Table> &table,
+              std::unique_ptr<PredicateKernel> *out) const override {
+    std::shared_ptr<arrow::Array> array;
+    RETURN_CYLON_STATUS_IF_FAILED(GetColumnArray(table, column_, &array));
+    if (value_ == nullptr || !value_->is_valid) {
+      *out = std::unique_ptr<PredicateKernel>(new ConstantKernel(false));
+      return Status::OK();
+    }
+
+    std::shared_ptr<arrow::Scalar> value = value_;
+    if (!value->type->Equals(array->type())) {
+      CYLON_ASSIGN_OR_RAISE(auto cast_res, arrow::compute::Cast(arrow::Datum(value), array->type()))
+      value = cast_res.scalar();
+    }
+
+    const auto &op = op_;
+    return VisitPredicateType(*array->type(), [&](auto tag) {
+      using ArrowT = typename decltype(tag)::type;
+      *out = MakeCompareKernel<ArrowT>(op, array, value);
+      return Status::OK();
+    });
+  }
+
+ private:
+  int column_;
+  CompareOp op_;
+  std::shared_ptr<arrow::Scalar> value_;
+};
+
+class IsInPredicate : public Predicate {
+ public:
+  IsInPredicate(int column, std::shared_ptr<arrow::Array> values)
+      : column_(column), values_(std::move(values)) {}
+
+  Status Bind(const std::shared_ptr<arrow::Table> &table,
+              std::unique_ptr<PredicateKernel> *out) const override {
+    std::shared_ptr<arrow::Array> array;
+    RETURN_CYLON_STATUS_IF_FAILED(GetColumnArray(table, column_, &array));
+    if (values_ == nullptr || values_->length() == values_->null_count()) {
+      *out = std::unique_ptr<PredicateKernel>(new ConstantKernel(false));
+      return Status::OK();
+    }
+
+    std::shared_ptr<arrow::Array> values = values_;
+    if (!values->type()->Equals(array->type())) {
+      CYLON_ASSIGN_OR_RAISE(values, arrow::compute::Cast(*values, array->type()))
+    }
+
+    return VisitPredicateType(*array->type(), [&](auto tag) {
+      using ArrowT = typename decltype(tag)::type;
+      *out = std::unique_ptr<PredicateKernel>(new IsInKernel<ArrowT>(array, values));
+      return Status::OK();
+    });
+  }
+
+ private:
+  int column_;
+  std::shared_ptr<arrow::Array> values_;
+};
+
+class NullCheckPredicate : public Predicate {
+ public:
+  NullCheckPredicate(int column, bool is_null) : column_(column), is_null_(is_null) {}
+
+  Status Bind(const std::shared_ptr<arrow::Table> &table,
+              std::unique_ptr<PredicateKernel> *out) const override {
+    std::shared_ptr<arrow::Array> array;
+    RETURN_CYLON_STATUS_IF_FAILED(GetColumnArray(table, column_, &array));
+    *out = std::unique_ptr<PredicateKernel>(new NullCheckKernel(std::move(array), is_null_));
+    return Status::OK();
+  }
+
+ private:
+  int column_;
+  bool is_null_;
+};
+
+template<typename KernelT>
+class BinaryLogicPredicate : public Predicate {
+ public:
+  BinaryLogicPredicate(std::shared_ptr<Predicate> left, std::shared_ptr<Predicate> right)
+      : left_(std::move(left)), right_(std::move(right)) {}
+
+  Status Bind(const std::shared_ptr<arrow::Table> &table,
+              std::unique_ptr<PredicateKernel> *out) const override {
+    std::unique_ptr<PredicateKernel> left, right;
+    RETURN_CYLON_STATUS_IF_FAILED(left_->Bind(table, &left));
+    RETURN_CYLON_STATUS_IF_FAILED(right_->Bind(table, &right));
+    *out = std::unique_ptr<PredicateKernel>(new KernelT(std::move(left), std::move(right)));
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Predicate> left_, right_;
+};
+
+class NotPredicate : public Predicate {
+ public:
+  explicit NotPredicate(std::shared_ptr<Predicate> child) : child_(std::move(child)) {}
+
+  Status Bind(const std::shared_ptr<arrow::Table> &table,
+              std::unique_ptr<PredicateKernel> *out) const override {
+    std::unique_ptr<PredicateKernel> child;
+    RETURN_CYLON_STATUS_IF_FAILED(child_->Bind(table, &child));
+    *out = std::unique_ptr<PredicateKernel>(new NotKernel(std::move(child)));
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Predicate> child_;
+};
+
+std::shared_ptr<Predicate> Compare(int column, CompareOp op, std::shared_ptr<arrow::Scalar> value) {
+  return std::make_shared<ComparePredicate>(column, op, std::move(value));
+}
+
+std::shared_ptr<Predicate> IsIn(int column, std::shared_ptr<arrow::Array> values) {
+  return std::make_shared<IsInPredicate>(column, std::move(values));
+}
+
+std::shared_ptr<Predicate> IsNull(int column) {
+  return std::make_shared<NullCheckPredicate>(column, true);
+}
+
+std::shared_ptr<Predicate> IsValid(int column) {
+  return std::make_shared<NullCheckPredicate>(column, false);
+}
+
+std::shared_ptr<Predicate> And(std::shared_ptr<Predicate> left, std::shared_ptr<Predicate> right) {
+  return std::make_shared<BinaryLogicPredicate<AndKernel>>(std::move(left), std::move(right));
+}
+
+std::shared_ptr<Predicate> Or(std::shared_ptr<Predicate> left, std::shared_ptr<Predicate> right) {
+  return std::make_shared<BinaryLogicPredicate<OrKernel>>(std::move(left), std::move(right));
+}
+
+std::shared_ptr<Predicate> Not(std::shared_ptr<Predicate> child) {
+  return std::make_shared<NotPredicate>(std::move(child));
+}
+
+Status Evaluate(const std::shared_ptr<arrow::Table> &table,
+                const Predicate &predicate,
+                std::shared_ptr<arrow::BooleanArray> *mask,
+                arrow::MemoryPool *pool) {
+  const int64_t length = table->num_rows();
+  CYLON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> bitmap, arrow::AllocateBitmap(length, pool))
+
+  if (length > 0) {
+    std::shared_ptr<arrow::Table> combined = table;
+    COMBINE_CHUNKS_RETURN_CYLON_STATUS(combined, pool);
+
+    std::unique_ptr<PredicateKernel> kernel;
+    RETURN_CYLON_STATUS_IF_FAILED(predicate.Bind(combined, &kernel));
+
+    uint8_t *out = bitmap->mutable_data();
+    for (int64_t offset = 0; offset < length; offset += kBatchSize) {
+      RETURN_CYLON_STATUS_IF_FAILED(
+          kernel->Evaluate(offset, std::min(kBatchSize, length - offset), out + offset / 8));
+    }
+  }
+
+  *mask = std::make_shared<arrow::BooleanArray>(length, std::move(bitmap));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace cylon
@@ -0,0 +1,124 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_COMPUTE_PREDICATE_HPP_
+#define CYLON_CPP_SRC_CYLON_COMPUTE_PREDICATE_HPP_
+
+#include <memory>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include <cylon/status.hpp>
+
+namespace cylon {
+namespace compute {
+
+/**
+ * Vectorized predicates
+ *
+ * A Predicate is an expression tree over the columns of a table (comparisons against a literal,
+ * IN-lists, null checks and AND/OR/NOT combinations). Evaluating it binds the tree to the table,
+ * producing a tree of PredicateKernels, which are then run over batches of rows, writing one bit
+ * per row into a selection bitmap. There is no per-row virtual call or Row materialization.
+ *
+ * Nulls never satisfy a comparison or an IN-list (two-valued logic). Hence NOT(a > 5) is true for a
+ * null a, the same as pandas' ~(df.a > 5).
+ */
+
+enum CompareOp {
+  EQUAL,
+  NOT_EQUAL,
+  LESS,
+  LESS_EQUAL,
+  GREATER,
+  GREATER_EQUAL
+};
+
+/**
+ * Predicate bound to the arrays of a table
+ */
+class PredicateKernel {
+ public:
+  virtual ~PredicateKernel() = default;
+
+  /**
+   * Evaluates rows [offset, offset + length) and writes the result into out, starting from bit 0.
+   * @param offset row offset. Always a multiple of 8
+   * @param length number of rows
+   * @param out bitmap with at least ceil(length / 8) bytes
+   * @return
+   */
+  virtual Status Evaluate(int64_t offset, int64_t length, uint8_t *out) = 0;
+};
+
+class Predicate {
+ public:
+  virtual ~Predicate() = default;
+
+  /**
+   * Binds the predicate to a table. Every referenced column of the table should be a single chunk.
+   * @param table
+   * @param out
+   * @return
+   */
+  virtual Status Bind(const std::shared_ptr<arrow::Table> &table,
+                      std::unique_ptr<PredicateKernel> *out) const = 0;
+};
+
+/**
+ * column <op> value. value is cast to the type of the column when the predicate is bound.
+ * A null value matches no rows.
+ * @param column column index
+ * @param op
+ * @param value
+ * @return
+ */
+std::shared_ptr<Predicate> Compare(int column, CompareOp op, std::shared_ptr<arrow::Scalar> value);
+
+/**
+ * column IN (values). values are cast to the type of the column. Nulls in values are ignored.
+ * @param column column index
+ * @param values
+ * @return
+ */
+std::shared_ptr<Predicate> IsIn(int column, std::shared_ptr<arrow::Array> values);
+
+std::shared_ptr<Predicate> IsNull(int column);
+
+std::shared_ptr<Predicate> IsValid(int column);
+
+std::shared_ptr<Predicate> And(std::shared_ptr<Predicate> left, std::shared_ptr<Predicate> right);
+
+std::shared_ptr<Predicate> Or(std::shared_ptr<Predicate> left, std::shared_ptr<Predicate> right);
+
+std::shared_ptr<Predicate> Not(std::shared_ptr<Predicate> child);
+
+/**
+ * Evaluates a predicate over all rows of a table into a boolean mask (without nulls)
+ * @param table
+ * @param predicate
+ * @param mask
+ * @param pool
+ * @return
+ */
+Status Evaluate(const std::shared_ptr<arrow::Table> &table,
+                const Predicate &predicate,
+                std::shared_ptr<arrow::BooleanArray> *mask,
+                arrow::MemoryPool *pool = arrow::default_memory_pool());
+
+}  // namespace compute
+}  // namespace cylon
+
+#endif //CYLON_CPP_SRC_CYLON_COMPUTE_PREDICATE_HPP_
@@ -0,0 +1,169 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "cylon/ctx/arena_memory_pool.hpp"
+#include "cylon/util/macros.hpp"
+
+namespace cylon {
+
+namespace {
+constexpr int64_t kAlignment = 64;
+
+// allocations of 0 bytes point here
+alignas(kAlignment) uint8_t zero_size_area[1];
+uint8_t *const kZeroSizeArea = zero_size_area;
+
+inline int64_t RoundUp(int64_t size) {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+}
+
+ArenaMemoryPool::ArenaMemoryPool(int64_t block_size, arrow::MemoryPool *pool)
+    : block_size_(RoundUp(std::max<int64_t>(block_size, kAlignment))), pool_(pool) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {
+  Reset();
+}
+
+Status ArenaMemoryPool::AllocateUnlocked(int64_t size, uint8_t **out) {
+  if (size < 0) {
+    return {Code::Invalid, "negative allocation size"};
+  }
+  if (size == 0) {
+    *out = kZeroSizeArea;
+    return Status::OK();
+  }
+
+  const int64_t aligned = RoundUp(size);
+  if (aligned > block_size_) { // a block of its own, the current block stays in use
+    uint8_t *data;
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(pool_->Allocate(aligned, &data));
+    blocks_.push_back({data, aligned});
+    bytes_reserved_ += aligned;
+    *out = data;
+  } else {
+    if (head_ == nullptr || end_ - head_ < aligned) {
+      uint8_t *data;
+      RETURN_CYLON_STATUS_IF_ARROW_FAILED(pool_->Allocate(block_size_, &data));
+      blocks_.push_back({data, block_size_});
+      bytes_reserved_ += block_size_;
+      head_ = data;
+      end_ = data + block_size_;
+    }
+    *out = head_;
+    last_ = head_;
+    head_ += aligned;
+  }
+
+  bytes_allocated_ += size;
+  max_memory_ = std::max(max_memory_, bytes_allocated_);
+  return Status::OK();
+}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t **out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return AllocateUnlocked(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t **ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (new_size < 0) {
+    return {Code::Invalid, "negative allocation size"};
+  }
+  if (*ptr == kZeroSizeArea) {
+    return AllocateUnlocked(new_size, ptr);
+  }
+
+  const int64_t aligned = RoundUp(new_size);
+  if ((*ptr == last_ && end_ - last_ >= aligned) // the last allocation grows in place
+      || RoundUp(old_size) >= aligned) { // or fits in its own space
+    if (*ptr == last_) {
+      head_ = last_ + aligned;
+    }
+    bytes_allocated_ += new_size - old_size;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+    return Status::OK();
+  }
+
+  uint8_t *out;
+  RETURN_CYLON_STATUS_IF_FAILED(AllocateUnlocked(new_size, &out));
+  std::memcpy(out, *ptr, std::min(old_size, new_size));
+  bytes_allocated_ -= old_size;
+  *ptr = out;
+  return Status::OK();
+}
+
+void ArenaMemoryPool::Free(uint8_t *buffer, int64_t size) {
+  if (buffer == kZeroSizeArea) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  bytes_allocated_ -= size;
+  if (buffer == last_) { // give back the last allocation of the current block
+    head_ = last_;
+    last_ = nullptr;
+  }
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_allocated_;
+}
+
+int64_t ArenaMemoryPool::max_memory() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_memory_;
+}
+
+std::string ArenaMemoryPool::backend_name() const {
+  return "arena(" + pool_->backend_name() + ")";
+}
+
+int64_t ArenaMemoryPool::bytes_reserved() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_reserved_;
+}
+
+void ArenaMemoryPool::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &block: blocks_) {
+    pool_->Free(block.data, block.size);
+  }
+  blocks_.clear();
+  head_ = end_ = last_ = nullptr;
+  bytes_allocated_ = 0;
+  bytes_reserved_ = 0;
+}
+
+OperatorArena::OperatorArena(const std::shared_ptr<CylonContext> &ctx) {
+  if (ctx->GetConfig(kOperatorArenaConfig) == "true") {
+    const auto &block_bytes = ctx->GetConfig(kArenaBlockBytesConfig);
+    arena_ = new ArenaMemoryPool(block_bytes.empty() ? kDefaultArenaBlockBytes
+                                                     : std::stoll(block_bytes),
+                                 ToArrowPool(ctx));
+    proxy_ = std::make_unique<ProxyMemoryPool>(arena_);
+    pool_ = proxy_.get();
+  } else {
+    pool_ = ToArrowPool(ctx);
+  }
+}
+
+int64_t OperatorArena::max_memory() const {
+  return arena_ == nullptr ? -1 : arena_->max_memory();
+}
+
+}
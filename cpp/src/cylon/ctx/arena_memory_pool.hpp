@@ -0,0 +1,139 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_CTX_ARENA_MEMORY_POOL_HPP_
+#define CYLON_CPP_SRC_CYLON_CTX_ARENA_MEMORY_POOL_HPP_
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <arrow/memory_pool.h>
+
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/ctx/memory_pool.hpp>
+
+namespace cylon {
+
+/**
+ * CylonContext config to allocate the scratch memory of operators (ie. sort indices, group-by
+ * filters, selection masks) from an arena per operator call (OperatorArena). Set to "true" to enable.
+ */
+constexpr const char *kOperatorArenaConfig = "operator_arena";
+
+/**
+ * CylonContext config for the block size of the operator arenas. Defaults to
+ * kDefaultArenaBlockBytes
+ */
+constexpr const char *kArenaBlockBytesConfig = "arena_block_bytes";
+constexpr int64_t kDefaultArenaBlockBytes = 1024 * 1024;
+
+/**
+ * Bump (arena) allocator.
+ *
+ * Memory is carved out of large blocks taken from an underlying arrow memory pool, by bumping a
+ * pointer. Free only gives back the memory of the last allocation (so that stack-like
+ * allocations, ex: builders that grow and are released, reuse the same region). Everything else is
+ * freed in bulk by Reset, or when the arena is destroyed. Allocations larger than the block size
+ * get a block of their own.
+ *
+ * An arena can be used for the scratch memory of an operator (OperatorArena), or as the memory
+ * pool of a CylonContext for a query (CylonContext::SetMemoryPool), which is then Reset once the
+ * tables of the query have been released. Memory allocated from the arena must not be used after
+ * the arena is Reset or destroyed. This class is thread safe.
+ */
+class ArenaMemoryPool : public MemoryPool {
+ public:
+  explicit ArenaMemoryPool(int64_t block_size = kDefaultArenaBlockBytes,
+                           arrow::MemoryPool *pool = arrow::default_memory_pool());
+
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t **out) override;
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t **ptr) override;
+
+  void Free(uint8_t *buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  /**
+   * High-water mark of bytes_allocated, since the arena was created
+   */
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  /**
+   * Bytes of the blocks taken from the underlying memory pool
+   */
+  int64_t bytes_reserved() const;
+
+  /**
+   * Returns all blocks to the underlying memory pool
+   */
+  void Reset();
+
+ private:
+  struct Block {
+    uint8_t *data;
+    int64_t size;
+  };
+
+  // requires mutex_
+  Status AllocateUnlocked(int64_t size, uint8_t **out);
+
+  const int64_t block_size_;
+  arrow::MemoryPool *pool_;
+  mutable std::mutex mutex_;
+  std::vector<Block> blocks_;
+  // free region of the current block
+  uint8_t *head_ = nullptr;
+  uint8_t *end_ = nullptr;
+  // start of the last allocation from the current block
+  uint8_t *last_ = nullptr;
+  int64_t bytes_allocated_ = 0;
+  int64_t max_memory_ = 0;
+  int64_t bytes_reserved_ = 0;
+};
+
+/**
+ * Memory pool for the scratch memory of an operator call, ie. memory that does not outlive the
+ * operator. If kOperatorArenaConfig is set, it is an ArenaMemoryPool, which is freed in bulk when
+ * this goes out of scope. Otherwise, it is the memory pool of the context.
+ *
+ * Declare it before the arrays allocated from it, so that they are released before the arena.
+ */
+class OperatorArena {
+ public:
+  explicit OperatorArena(const std::shared_ptr<CylonContext> &ctx);
+
+  arrow::MemoryPool *pool() const { return pool_; }
+
+  /**
+   * High-water mark of the scratch memory, or -1 if the arena is not enabled
+   */
+  int64_t max_memory() const;
+
+ private:
+  // owns the arena
+  std::unique_ptr<ProxyMemoryPool> proxy_;
+  ArenaMemoryPool *arena_ = nullptr;
+  arrow::MemoryPool *pool_;
+};
+
+}
+
+#endif //CYLON_CPP_SRC_CYLON_CTX_ARENA_MEMORY_POOL_HPP_
@@ -15,10 +15,15 @@
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
 
 arrow::MemoryPool *cylon::ToArrowPool(const std::shared_ptr<cylon::CylonContext> &ctx) {
-  return ToArrowPool(ctx->GetMemoryPool());
+  return ToArrowPool(ctx.get());
 }
 
 arrow::MemoryPool *cylon::ToArrowPool(cylon::CylonContext *ctx) {
+  // allocations of an operator go through its tracker
+  auto *tracker = ctx->GetActiveMemoryTracker();
+  if (tracker != nullptr) {
+    return tracker;
+  }
   return ToArrowPool(ctx->GetMemoryPool());
 }
 
@@ -18,6 +18,8 @@
 #include <arrow/memory_pool.h>
 
 #include "cylon/ctx/cylon_context.hpp"
+#include "cylon/ctx/arrow_memory_pool_utils.hpp"
+#include "cylon/arrow/arrow_buffer.hpp"
 #include "cylon/util/macros.hpp"
 
 #include "cylon/net/mpi/mpi_communicator.hpp"
@@ -111,7 +113,7 @@ void CylonContext::setDistributed(bool distributed) {
 }
 
 void CylonContext::AddConfig(const std::string &key, const std::string &value) {
-  this->config.insert(std::pair<std::string, std::string>(key, value));
+  this->config[key] = value;
 }
 std::string CylonContext::GetConfig(const std::string &key, const std::string &def) {
   auto find = this->config.find(key);
@@ -156,6 +158,38 @@ cylon::MemoryPool *CylonContext::GetMemoryPool() {
 void CylonContext::SetMemoryPool(cylon::MemoryPool *mem_pool) {
   this->memory_pool = mem_pool;
 }
+const std::shared_ptr<BufferPool> &CylonContext::GetBufferPool() {
+  if (this->buffer_pool == nullptr) {
+    const auto &cache_bytes = GetConfig(kBufferPoolCacheBytesConfig,
+                                        std::to_string(kDefaultBufferPoolCacheBytes));
+    // cached across operators, so not counted in their trackers
+    this->buffer_pool = BufferPool::Make(ToArrowPool(this->memory_pool), std::stoll(cache_bytes));
+  }
+  return this->buffer_pool;
+}
+
+MemoryTrackers *CylonContext::GetMemoryTrackers() {
+  if (this->memory_trackers == nullptr) {
+    this->memory_trackers = std::make_shared<MemoryTrackers>(ToArrowPool(this->memory_pool));
+  }
+  return this->memory_trackers.get();
+}
+
+MemoryTracker *CylonContext::GetActiveMemoryTracker() const {
+  if (this->memory_trackers == nullptr) {
+    return nullptr;
+  }
+  auto *tracker = this->memory_trackers->current();
+  return tracker == this->memory_trackers->root() ? nullptr : tracker;
+}
+
+std::vector<OperatorMemoryUsage> CylonContext::GetMemoryReport() const {
+  if (this->memory_trackers == nullptr) {
+    return {};
+  }
+  return this->memory_trackers->report();
+}
+
 int32_t CylonContext::GetNextSequence() {
   return this->sequence_no++;
 }
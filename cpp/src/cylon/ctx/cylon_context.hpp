@@ -21,9 +21,12 @@
 #include <cylon/net/comm_config.hpp>
 #include <cylon/net/communicator.hpp>
 #include <cylon/ctx/memory_pool.hpp>
+#include <cylon/ctx/memory_tracker.hpp>
 
 namespace cylon {
 
+class BufferPool;
+
 /**
  * The entry point to cylon operations
  */
@@ -33,6 +36,8 @@ class CylonContext {
   bool is_distributed;
   std::shared_ptr<cylon::net::Communicator> communicator{};
   cylon::MemoryPool *memory_pool{};
+  std::shared_ptr<BufferPool> buffer_pool{};
+  std::shared_ptr<MemoryTrackers> memory_trackers{};
   int32_t sequence_no = 0;
 
  public:
@@ -64,7 +69,7 @@ class CylonContext {
   void Finalize();
 
   /**
-   * Adds a configuration
+   * Adds a configuration. An existing value for the key is replaced
    * @param <std::string> key
    * @param <std::string> value
    */
@@ -129,6 +134,34 @@ class CylonContext {
    */
   void SetMemoryPool(cylon::MemoryPool *mem_pool);
 
+  /**
+   * Returns the pool of the receive buffers used by the channels. It is created on the first call
+   * from the memory pool of the context, caching up to `buffer_pool_cache_bytes` (config) bytes.
+   * @return <cylon::BufferPool>
+   */
+  const std::shared_ptr<BufferPool> &GetBufferPool();
+
+  /**
+   * Returns the memory trackers of the operators. They are created on the first call, on top of the
+   * memory pool of the context.
+   * @return <cylon::MemoryTrackers>
+   */
+  MemoryTrackers *GetMemoryTrackers();
+
+  /**
+   * Returns the tracker of the operator being run by the calling thread, or nullptr if its memory is
+   * not tracked
+   * @return <cylon::MemoryTracker>
+   */
+  MemoryTracker *GetActiveMemoryTracker() const;
+
+  /**
+   * Returns the memory used by the operators of the last (top level) operator call, if memory
+   * tracking is enabled (`memory_tracking` config)
+   * @return a std::vector<OperatorMemoryUsage>
+   */
+  std::vector<OperatorMemoryUsage> GetMemoryReport() const;
+
   /**
    * Returns the next sequence number
    * @return <int>
@@ -0,0 +1,206 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <sstream>
+
+#include "cylon/ctx/memory_tracker.hpp"
+#include "cylon/ctx/cylon_context.hpp"
+
+namespace cylon {
+
+namespace {
+constexpr const char *kRootTrackerName = "context";
+
+inline void UpdatePeak(std::atomic<int64_t> &peak, int64_t bytes) {
+  int64_t prev = peak.load();
+  while (prev < bytes && !peak.compare_exchange_weak(prev, bytes)) {
+  }
+}
+
+int64_t GetBudget(const std::shared_ptr<CylonContext> &ctx, const std::string &key) {
+  const auto &budget = ctx->GetConfig(key);
+  return budget.empty() ? -1 : std::stoll(budget);
+}
+
+// current tracker of this thread, for each MemoryTrackers with an operator running on the thread.
+// an entry is removed when the top level operator returns
+thread_local std::unordered_map<const MemoryTrackers *, MemoryTracker *> thread_trackers;
+}
+
+MemoryTracker::MemoryTracker(std::string name, MemoryTracker *parent, arrow::MemoryPool *pool)
+    : name_(std::move(name)), parent_(parent), pool_(pool) {
+  if (parent_ == nullptr || parent_->parent_ == nullptr) { // root or its children
+    path_ = name_;
+  } else {
+    path_ = parent_->path_ + "/" + name_;
+  }
+}
+
+arrow::Status MemoryTracker::Reserve(int64_t size) {
+  for (auto *t = this; t != nullptr; t = t->parent_) {
+    const int64_t bytes = t->bytes_allocated_.fetch_add(size) + size;
+    const int64_t limit = t->limit_.load();
+    if (limit >= 0 && bytes > limit) {
+      for (auto *r = this; r != t->parent_; r = r->parent_) {
+        r->bytes_allocated_.fetch_sub(size);
+      }
+      return arrow::Status::OutOfMemory("memory budget of ", t->path_, " (", limit,
+                                        " bytes) exceeded, allocating ", size, " bytes with ",
+                                        bytes - size, " bytes in use");
+    }
+  }
+  for (auto *t = this; t != nullptr; t = t->parent_) {
+    UpdatePeak(t->max_memory_, t->bytes_allocated_.load());
+  }
+  return arrow::Status::OK();
+}
+
+void MemoryTracker::Release(int64_t size) {
+  for (auto *t = this; t != nullptr; t = t->parent_) {
+    t->bytes_allocated_.fetch_sub(size);
+  }
+}
+
+arrow::Status MemoryTracker::Allocate(int64_t size, uint8_t **out) {
+  ARROW_RETURN_NOT_OK(Reserve(size));
+  const auto &status = pool_->Allocate(size, out);
+  if (!status.ok()) {
+    Release(size);
+  }
+  return status;
+}
+
+arrow::Status MemoryTracker::Reallocate(int64_t old_size, int64_t new_size, uint8_t **ptr) {
+  const int64_t grow = new_size - old_size;
+  if (grow > 0) {
+    ARROW_RETURN_NOT_OK(Reserve(grow));
+  }
+  const auto &status = pool_->Reallocate(old_size, new_size, ptr);
+  if (!status.ok()) {
+    if (grow > 0) {
+      Release(grow);
+    }
+    return status;
+  }
+  if (grow < 0) {
+    Release(-grow);
+  }
+  return arrow::Status::OK();
+}
+
+void MemoryTracker::Free(uint8_t *buffer, int64_t size) {
+  pool_->Free(buffer, size);
+  Release(size);
+}
+
+int64_t MemoryTracker::bytes_allocated() const {
+  return bytes_allocated_.load();
+}
+
+int64_t MemoryTracker::max_memory() const {
+  return max_memory_.load();
+}
+
+std::string MemoryTracker::backend_name() const {
+  return pool_->backend_name();
+}
+
+void MemoryTracker::ResetPeak() {
+  max_memory_.store(bytes_allocated_.load());
+}
+
+MemoryTrackers::MemoryTrackers(arrow::MemoryPool *pool)
+    : pool_(pool), root_(new MemoryTracker(kRootTrackerName, nullptr, pool)) {}
+
+MemoryTracker *MemoryTrackers::current() const {
+  if (thread_trackers.empty()) {
+    return root_.get();
+  }
+  const auto it = thread_trackers.find(this);
+  return it == thread_trackers.end() ? root_.get() : it->second;
+}
+
+MemoryTracker *MemoryTrackers::Push(const std::string &name) {
+  auto *parent = current();
+  MemoryTracker *tracker;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (parent == root_.get()) { // a top level call
+      report_.clear();
+    }
+    const auto &path = parent == root_.get() ? name : parent->path() + "/" + name;
+    auto &entry = trackers_[path];
+    if (entry == nullptr) {
+      entry.reset(new MemoryTracker(name, parent, pool_));
+    }
+    tracker = entry.get();
+  }
+  thread_trackers[this] = tracker;
+  return tracker;
+}
+
+void MemoryTrackers::Pop(const OperatorMemoryUsage &usage) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    report_.push_back(usage);
+  }
+  const auto it = thread_trackers.find(this);
+  if (it->second->parent() == root_.get()) {
+    thread_trackers.erase(it);
+  } else {
+    it->second = it->second->parent();
+  }
+}
+
+std::vector<OperatorMemoryUsage> MemoryTrackers::report() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return report_;
+}
+
+std::string MemoryTrackers::ReportString() const {
+  std::stringstream ss;
+  for (const auto &usage: report()) {
+    ss << usage.op << " peak:" << usage.peak_bytes << " retained:" << usage.retained_bytes;
+    if (usage.budget >= 0) {
+      ss << " budget:" << usage.budget;
+    }
+    ss << "\n";
+  }
+  return ss.str();
+}
+
+MemoryScope::MemoryScope(const std::shared_ptr<CylonContext> &ctx, const std::string &name) {
+  const int64_t budget = GetBudget(ctx, std::string(kMemoryBudgetConfig) + "." + name);
+  const int64_t total_budget = GetBudget(ctx, kMemoryBudgetConfig);
+  if (budget < 0 && total_budget < 0 && ctx->GetConfig(kMemoryTrackingConfig) != "true") {
+    return;
+  }
+
+  trackers_ = ctx->GetMemoryTrackers();
+  trackers_->root()->SetLimit(total_budget);
+  tracker_ = trackers_->Push(name);
+  tracker_->SetLimit(budget);
+  start_bytes_ = tracker_->bytes_allocated();
+  tracker_->ResetPeak();
+}
+
+MemoryScope::~MemoryScope() {
+  if (tracker_ == nullptr) {
+    return;
+  }
+  trackers_->Pop({tracker_->path(), tracker_->max_memory() - start_bytes_,
+                  tracker_->bytes_allocated() - start_bytes_, tracker_->limit()});
+}
+
+}
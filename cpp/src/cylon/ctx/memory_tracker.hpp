@@ -0,0 +1,188 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_CTX_MEMORY_TRACKER_HPP_
+#define CYLON_CPP_SRC_CYLON_CTX_MEMORY_TRACKER_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <arrow/memory_pool.h>
+
+namespace cylon {
+
+class CylonContext;
+
+/**
+ * CylonContext config to track the memory of the operators (MemoryScope). Set to "true" to enable.
+ * Setting a budget enables it as well.
+ */
+constexpr const char *kMemoryTrackingConfig = "memory_tracking";
+
+/**
+ * CylonContext config for the memory budget (in bytes) of all the operators of the context. The
+ * budget of an operator is set by appending its name, ex: "memory_budget.join"
+ */
+constexpr const char *kMemoryBudgetConfig = "memory_budget";
+
+/**
+ * An arrow memory pool that counts the bytes allocated through it and enforces a budget.
+ *
+ * Trackers form a tree: an allocation is counted in the tracker and all of its ancestors, and fails
+ * with OutOfMemory if it takes any of them over its budget. The memory itself comes from the
+ * underlying pool of the tree.
+ */
+class MemoryTracker : public arrow::MemoryPool {
+ public:
+  MemoryTracker(std::string name, MemoryTracker *parent, arrow::MemoryPool *pool);
+
+  arrow::Status Allocate(int64_t size, uint8_t **out) override;
+
+  arrow::Status Reallocate(int64_t old_size, int64_t new_size, uint8_t **ptr) override;
+
+  void Free(uint8_t *buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  /**
+   * Peak of bytes_allocated, since the tracker was created or ResetPeak
+   */
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+  const std::string &name() const { return name_; }
+
+  /**
+   * Names of the ancestors (except the root) and of this tracker, separated by '/'. ex: "join/shuffle"
+   */
+  const std::string &path() const { return path_; }
+
+  MemoryTracker *parent() const { return parent_; }
+
+  /**
+   * Budget in bytes, or -1 if there is none
+   */
+  int64_t limit() const { return limit_.load(); }
+
+  void SetLimit(int64_t limit) { limit_.store(limit); }
+
+  /**
+   * Sets the peak to the bytes currently allocated
+   */
+  void ResetPeak();
+
+ private:
+  // counts size bytes in this tracker and its ancestors, if all of them are within their budgets
+  arrow::Status Reserve(int64_t size);
+  void Release(int64_t size);
+
+  const std::string name_;
+  std::string path_;
+  MemoryTracker *const parent_;
+  arrow::MemoryPool *const pool_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  std::atomic<int64_t> max_memory_{0};
+  std::atomic<int64_t> limit_{-1};
+};
+
+/**
+ * Memory used by an operator call
+ */
+struct OperatorMemoryUsage {
+  // path of the tracker of the operator
+  std::string op;
+  // peak bytes allocated during the call
+  int64_t peak_bytes;
+  // bytes allocated during the call and still held at its end, ie. the output
+  int64_t retained_bytes;
+  // -1 if there is none
+  int64_t budget;
+};
+
+/**
+ * The trackers of a CylonContext, one for each operator path, under a root tracker for the
+ * whole context. Trackers live as long as the context, so the memory allocated from them must be
+ * released before the context (as for the memory pool of the context).
+ *
+ * The current tracker is kept per thread, so that operators run by different threads (ex: the ops
+ * of a ThreadPoolExecution) are counted in their own trackers. Worker threads of an operator do
+ * not inherit its tracker, so the operator should pass its ToArrowPool to them.
+ */
+class MemoryTrackers {
+ public:
+  explicit MemoryTrackers(arrow::MemoryPool *pool);
+
+  MemoryTracker *root() const { return root_.get(); }
+
+  /**
+   * Tracker of the operator being run by the calling thread, or the root outside of the operators
+   */
+  MemoryTracker *current() const;
+
+  /**
+   * Makes the child of the current tracker with this name current, for the calling thread
+   */
+  MemoryTracker *Push(const std::string &name);
+
+  /**
+   * Makes the parent of the current tracker current for the calling thread, and records the usage
+   * of the call
+   */
+  void Pop(const OperatorMemoryUsage &usage);
+
+  /**
+   * Memory used by the operators of the last top level operator call, inner operators first
+   */
+  std::vector<OperatorMemoryUsage> report() const;
+
+  std::string ReportString() const;
+
+ private:
+  arrow::MemoryPool *pool_;
+  std::unique_ptr<MemoryTracker> root_;
+  // guards trackers_ and report_
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<MemoryTracker>> trackers_;
+  std::vector<OperatorMemoryUsage> report_;
+};
+
+/**
+ * Tracks the memory of an operator call, while in scope. Memory allocated from
+ * ToArrowPool(ctx) is counted in the tracker of the operator (nested under the tracker of the
+ * enclosing operator, if any), and allocations that exceed the budgets fail with OutOfMemory.
+ * When the scope ends, the usage of the call is added to CylonContext::GetMemoryReport.
+ *
+ * Does nothing unless memory tracking is enabled. Declare it before any ToArrowPool(ctx) call of
+ * the operator.
+ */
+class MemoryScope {
+ public:
+  MemoryScope(const std::shared_ptr<CylonContext> &ctx, const std::string &name);
+
+  ~MemoryScope();
+
+ private:
+  MemoryTrackers *trackers_ = nullptr;
+  MemoryTracker *tracker_ = nullptr;
+  int64_t start_bytes_ = 0;
+};
+
+}
+
+#endif //CYLON_CPP_SRC_CYLON_CTX_MEMORY_TRACKER_HPP_
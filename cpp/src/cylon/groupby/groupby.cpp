@@ -18,6 +18,10 @@
 #include <cylon/groupby/hash_groupby.hpp>
 #include <cylon/groupby/pipeline_groupby.hpp>
 #include <cylon/groupby/groupby.hpp>
+#include <cylon/groupby/partial_groupby.hpp>
+#include <cylon/join/join_planner.hpp>
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/ctx/memory_tracker.hpp>
 
 namespace cylon {
 
@@ -30,6 +34,45 @@ static inline bool is_associative(const std::vector<compute::AggregationOpId> &a
   });
 }
 
+/**
+ * Decides whether to pre-aggregate the local groups. This is a collective operation, unless the
+ * max ratio is configured to be <= 0 or >= 1.
+ */
+static Status ShouldPreAggregate(const std::shared_ptr<Table> &table,
+                                 const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations,
+                                 int num_keys,
+                                 bool *pre_aggregate) {
+  const auto &ctx = table->GetContext();
+  const auto &atable = table->get_table();
+
+  const auto &config = ctx->GetConfig(kGroupByPreAggregationRatioConfig);
+  const double max_ratio = config.empty() ? kPreAggregationMaxRatio : std::stod(config);
+
+  *pre_aggregate = max_ratio > 0;
+  if (max_ratio <= 0 || max_ratio >= 1) {
+    return Status::OK();
+  }
+
+  // the partial table has a row per distinct (keys, NUNIQUE/QUANTILE values) of each worker
+  join::KeyStats stats;
+  RETURN_CYLON_STATUS_IF_FAILED(join::SampleKeyStats(atable,
+                                                     PartialGroupByColumns(num_keys, aggregations),
+                                                     &stats));
+  arrow::Int64Builder builder(ToArrowPool(ctx));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.AppendValues({stats.rows, stats.distinct}));
+  CYLON_ASSIGN_OR_RAISE(auto local, builder.Finish())
+  std::shared_ptr<Column> global;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->AllReduce(Column::Make(std::move(local)),
+                                                                  net::SUM, &global));
+  const auto &sums = std::static_pointer_cast<arrow::Int64Array>(global->data());
+  *pre_aggregate = sums->Value(1) <= max_ratio * static_cast<double>(sums->Value(0));
+
+  LOG_IF(INFO, ctx->GetRank() == 0) << "Distributed hash groupby: " << sums->Value(1)
+                                    << " estimated local groups of " << sums->Value(0)
+                                    << " rows, pre-aggregate " << *pre_aggregate;
+  return Status::OK();
+}
+
 Status DistributedHashGroupBy(std::shared_ptr<Table> &table,
                               const std::vector<int32_t> &index_cols,
                               const std::vector<int32_t> &aggregate_cols,
@@ -54,10 +97,45 @@ Status DistributedHashGroupBy(std::shared_ptr<Table> &table,
     agg_after_projection.emplace_back(index_cols.size() + i, aggregate_ops[i]);
   }
 
-  // do local group by if world_sz is 1 or if all agg ops are associative
-  // todo: find a better way to do this, rather than checking the associativity
+  if (table->GetContext()->GetWorldSize() == 1) {
+    return HashGroupBy(projected_table, indices_after_project, agg_after_projection, output);
+  }
+  MemoryScope memory_scope(table->GetContext(), "groupby");
+
+  std::vector<std::shared_ptr<compute::AggregationOp>> aggregations;
+  aggregations.reserve(aggregate_ops.size());
+  for (const auto &op: aggregate_ops) {
+    aggregations.push_back(compute::MakeAggregationOpFromID(op));
+  }
+  const int num_keys = static_cast<int>(index_cols.size());
+
+  // the schema is the same in all workers, so is this
+  const auto &schema = projected_table->get_table()->schema();
+  bool supported = true;
+  for (int i = num_keys; i < schema->num_fields() && supported; i++) {
+    supported = IsPartialGroupBySupported(schema->field(i)->type());
+  }
+
+  bool pre_aggregate = false;
+  if (supported) {
+    RETURN_CYLON_STATUS_IF_FAILED(ShouldPreAggregate(projected_table, aggregations, num_keys,
+                                                     &pre_aggregate));
+  }
+
+  if (pre_aggregate) {
+    // combine the local groups, shuffle the partial states and merge them
+    std::shared_ptr<Table> partial;
+    RETURN_CYLON_STATUS_IF_FAILED(PartialHashGroupBy(projected_table, num_keys, aggregations,
+                                                     partial));
+    // the merge reuses the row hashes of the shuffle
+    std::shared_ptr<std::vector<uint32_t>> row_hashes;
+    RETURN_CYLON_STATUS_IF_FAILED(Shuffle(partial, indices_after_project, partial, row_hashes));
+    return MergePartialGroupBy(partial, schema, num_keys, aggregations, output, row_hashes);
+  }
+
   std::shared_ptr<Table> local_table;
-  if (table->GetContext()->GetWorldSize() == 1 || is_associative(aggregate_ops)) {
+  if (!supported && is_associative(aggregate_ops)) {
+    // types that PartialHashGroupBy does not support, ie. bool
     RETURN_CYLON_STATUS_IF_FAILED(HashGroupBy(projected_table,
                                               indices_after_project,
                                               agg_after_projection,
@@ -66,20 +144,18 @@ Status DistributedHashGroupBy(std::shared_ptr<Table> &table,
     local_table = std::move(projected_table);
   }
 
-  if (table->GetContext()->GetWorldSize() > 1) {
-    // shuffle
-    RETURN_CYLON_STATUS_IF_FAILED(Shuffle(local_table, indices_after_project, local_table));
+  // shuffle
+  std::shared_ptr<std::vector<uint32_t>> row_hashes;
+  RETURN_CYLON_STATUS_IF_FAILED(Shuffle(local_table, indices_after_project, local_table,
+                                        row_hashes));
 
-    // do local distribute again
-    RETURN_CYLON_STATUS_IF_FAILED(HashGroupBy(local_table,
-                                              indices_after_project,
-                                              agg_after_projection,
-                                              output));
-  } else {
-    output = local_table;
+  // do local distribute again, with the row hashes of the shuffle
+  std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> aggs;
+  aggs.reserve(agg_after_projection.size());
+  for (size_t i = 0; i < aggregations.size(); i++) {
+    aggs.emplace_back(num_keys + (int32_t) i, aggregations[i]);
   }
-
-  return Status::OK();
+  return HashGroupBy(local_table, indices_after_project, aggs, row_hashes, output);
 }
 
 Status DistributedHashGroupBy(std::shared_ptr<Table> &table,
@@ -99,6 +175,7 @@ Status DistributedPipelineGroupBy(std::shared_ptr<Table> &table,
   if (aggregate_cols.size() != aggregate_ops.size()) {
     return Status(Code::Invalid, "aggregate_cols size != aggregate_ops size");
   }
+  MemoryScope memory_scope(table->GetContext(), "groupby");
 
   // first filter index + aggregation cols
   std::vector<int32_t> project_cols{index_col};
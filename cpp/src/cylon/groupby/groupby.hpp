@@ -20,6 +20,32 @@
 
 namespace cylon {
 
+/**
+ * DistributedHashGroupBy pre-aggregates the local groups before the shuffle when the (estimated)
+ * number of local groups is at most this fraction of the rows
+ */
+constexpr double kPreAggregationMaxRatio = 0.5;
+
+/**
+ * Config key (in CylonContext) to replace kPreAggregationMaxRatio, ie. "0" never and "1" always
+ * pre-aggregates the supported types. Must be the same in all workers.
+ */
+constexpr const char *kGroupByPreAggregationRatioConfig = "groupby_preaggregation_max_ratio";
+
+/**
+ * Hash group-by of a distributed table. This is a collective operation.
+ *
+ * If the value types support partial aggregation (PartialHashGroupBy), the workers estimate the
+ * reduction of pre-aggregating their local groups (sampled number of distinct groups / rows). If
+ * the global ratio is small enough, the partial states are shuffled and merged. Otherwise the
+ * rows are shuffled and grouped as is.
+ * @param table
+ * @param index_cols
+ * @param aggregate_cols
+ * @param aggregate_ops
+ * @param output
+ * @return
+ */
 Status DistributedHashGroupBy(std::shared_ptr<Table> &table,
                               const std::vector<int32_t> &index_cols,
                               const std::vector<int32_t> &aggregate_cols,
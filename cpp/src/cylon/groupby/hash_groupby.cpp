@@ -15,12 +15,14 @@
 #include <arrow/api.h>
 #include <arrow/visitor_inline.h>
 #include <arrow/compute/api.h>
-#include <chrono>
 #include <glog/logging.h>
 
 #include "cylon/arrow/arrow_comparator.hpp"
+#include "cylon/ctx/arena_memory_pool.hpp"
+#include "cylon/ctx/memory_tracker.hpp"
 #include "cylon/ctx/arrow_memory_pool_utils.hpp"
 #include "cylon/util/macros.hpp"
+#include "cylon/util/trace.hpp"
 #include "cylon/groupby/hash_groupby.hpp"
 #include "cylon/thridparty/flat_hash_map/bytell_hash_map.hpp"
 
@@ -89,6 +91,7 @@ namespace cylon {
 static Status make_groups(arrow::MemoryPool *pool,
                           const std::shared_ptr<arrow::Table> &atable,
                           const std::vector<int> &idx_cols,
+                          const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
                           std::vector<int64_t> *group_ids,
                           std::shared_ptr<arrow::Array> *group_filter,
                           int64_t *unique_groups) {
@@ -104,7 +107,14 @@ static Status make_groups(arrow::MemoryPool *pool,
   RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexEqualTo::Make(atable, idx_cols, &comp));
 
   std::unique_ptr<TableRowIndexHash> hash;
-  RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(atable, idx_cols, &hash));
+  if (row_hashes != nullptr) {
+    if ((int64_t) row_hashes->size() != num_rows) {
+      return {Code::Invalid, "number of row hashes should be equal to the number of rows"};
+    }
+    hash = std::make_unique<TableRowIndexHash>(row_hashes);
+  } else {
+    RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(atable, idx_cols, &hash));
+  }
 
   ska::bytell_hash_map<int64_t, int64_t, TableRowIndexHash, TableRowIndexEqualTo>
       hash_map(num_rows, *hash, *comp);
@@ -341,25 +351,32 @@ Status HashGroupBy(const std::shared_ptr<Table> &table,
                    const std::vector<int32_t> &idx_cols,
                    const std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> &aggregations,
                    std::shared_ptr<Table> &output) {
-#ifdef CYLON_DEBUG
-  auto t1 = std::chrono::steady_clock::now();
-#endif
+  return HashGroupBy(table, idx_cols, aggregations, nullptr, output);
+}
+
+Status HashGroupBy(const std::shared_ptr<Table> &table,
+                   const std::vector<int32_t> &idx_cols,
+                   const std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> &aggregations,
+                   const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+                   std::shared_ptr<Table> &output) {
+  trace::Span span("groupby.local");
   const auto &ctx = table->GetContext();
+  MemoryScope memory_scope(ctx, "groupby");
   arrow::MemoryPool *pool = ToArrowPool(ctx);
 
   std::shared_ptr<arrow::Table> atable = table->get_table();
   COMBINE_CHUNKS_RETURN_CYLON_STATUS(atable, pool);
-#ifdef CYLON_DEBUG
-  auto t2 = std::chrono::steady_clock::now();
-#endif
+  // the group filter is scratch memory
+  OperatorArena arena(ctx);
   std::vector<int64_t> group_ids;
   int64_t unique_groups = 0;
   std::shared_ptr<arrow::Array> group_filter;
-  RETURN_CYLON_STATUS_IF_FAILED(make_groups(pool, atable, idx_cols, &group_ids, &group_filter,
-                                            &unique_groups));
-#ifdef CYLON_DEBUG
-  auto t3 = std::chrono::steady_clock::now();
-#endif
+  {
+    trace::Span groups_span("groupby.make_groups");
+    RETURN_CYLON_STATUS_IF_FAILED(make_groups(arena.pool(), atable, idx_cols, row_hashes, &group_ids,
+                                              &group_filter, &unique_groups));
+  }
+  trace::Span aggregate_span("groupby.aggregate");
   std::vector<std::shared_ptr<arrow::ChunkedArray>> new_arrays;
   std::vector<std::shared_ptr<arrow::Field>> new_fields;
   int new_cols = (int) (idx_cols.size() + aggregations.size());
@@ -387,13 +404,6 @@ Status HashGroupBy(const std::shared_ptr<Table> &table,
   auto agg_table = arrow::Table::Make(std::move(schema), std::move(new_arrays));
 
   output = std::make_shared<Table>(ctx, std::move(agg_table));
-#ifdef CYLON_DEBUG
-  auto t4 = std::chrono::steady_clock::now();
-  LOG(INFO) << "hash groupby setup:" << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count()
-            << " make_groups:" << std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count()
-            << " aggregate:" << std::chrono::duration_cast<std::chrono::milliseconds>(t4 - t3).count()
-            << " total:" << std::chrono::duration_cast<std::chrono::milliseconds>(t4 - t1).count();
-#endif
   return Status::OK();
 }
 
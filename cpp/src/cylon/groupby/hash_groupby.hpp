@@ -47,6 +47,23 @@ Status HashGroupBy(const std::shared_ptr<Table> &table,
                    const std::vector<int32_t> &idx_cols,
                    const std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> &aggregations,
                    std::shared_ptr<Table> &output);
+
+/**
+ * Hash group-by operation by using <col_index, AggregationOp> pairs, with precomputed row hashes of
+ * the idx_cols (HashRows), ie. the hashes that a hash shuffle carried along with the rows
+ * NOTE: Nulls in the value columns will be ignored!
+ * @param table
+ * @param idx_cols
+ * @param aggregations
+ * @param row_hashes hashes of the rows, or nullptr to compute them
+ * @param output
+ * @return
+ */
+Status HashGroupBy(const std::shared_ptr<Table> &table,
+                   const std::vector<int32_t> &idx_cols,
+                   const std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> &aggregations,
+                   const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+                   std::shared_ptr<Table> &output);
 /**
  * Hash group-by operation by using AggregationOpId vector
  * NOTE: Nulls in the value columns will be ignored!
@@ -0,0 +1,565 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <arrow/api.h>
+#include <arrow/visitor_inline.h>
+#include <arrow/compute/api.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "cylon/ctx/arrow_memory_pool_utils.hpp"
+#include "cylon/groupby/partial_groupby.hpp"
+#include "cylon/mapreduce/mapreduce.hpp"
+#include "cylon/util/macros.hpp"
+
+namespace cylon {
+
+template<typename ArrowT>
+struct TypeTag {
+  using type = ArrowT;
+};
+
+/**
+ * Calls fn with the TypeTag of a supported value type
+ */
+template<typename Fn>
+static Status DispatchValueType(const std::shared_ptr<arrow::DataType> &type, Fn &&fn) {
+  switch (type->id()) {
+    case arrow::Type::UINT8:return fn(TypeTag<arrow::UInt8Type>{});
+    case arrow::Type::INT8:return fn(TypeTag<arrow::Int8Type>{});
+    case arrow::Type::UINT16:return fn(TypeTag<arrow::UInt16Type>{});
+    case arrow::Type::INT16:return fn(TypeTag<arrow::Int16Type>{});
+    case arrow::Type::UINT32:return fn(TypeTag<arrow::UInt32Type>{});
+    case arrow::Type::INT32:return fn(TypeTag<arrow::Int32Type>{});
+    case arrow::Type::UINT64:return fn(TypeTag<arrow::UInt64Type>{});
+    case arrow::Type::INT64:return fn(TypeTag<arrow::Int64Type>{});
+    case arrow::Type::FLOAT:return fn(TypeTag<arrow::FloatType>{});
+    case arrow::Type::DOUBLE:return fn(TypeTag<arrow::DoubleType>{});
+    case arrow::Type::DATE32:return fn(TypeTag<arrow::Date32Type>{});
+    case arrow::Type::DATE64:return fn(TypeTag<arrow::Date64Type>{});
+    case arrow::Type::TIMESTAMP:return fn(TypeTag<arrow::TimestampType>{});
+    case arrow::Type::TIME32:return fn(TypeTag<arrow::Time32Type>{});
+    case arrow::Type::TIME64:return fn(TypeTag<arrow::Time64Type>{});
+    default:
+      return {Code::NotImplemented, "Unsupported partial groupby type " + type->ToString()};
+  }
+}
+
+bool IsPartialGroupBySupported(const std::shared_ptr<arrow::DataType> &type) {
+  return DispatchValueType(type, [](auto tag) {
+    CYLON_UNUSED(tag);
+    return Status::OK();
+  }).is_ok();
+}
+
+static inline bool IsDigestOp(compute::AggregationOpId op) {
+  return op == compute::NUNIQUE || op == compute::QUANTILE;
+}
+
+static int NumStates(compute::AggregationOpId op) {
+  switch (op) {
+    case compute::MEAN: return 2;
+    case compute::VAR:
+    case compute::STDDEV: return 3;
+    case compute::NUNIQUE:
+    case compute::QUANTILE:
+    case compute::SUM:
+    case compute::MIN:
+    case compute::MAX:
+    case compute::COUNT: return 1;
+  }
+  return 1;
+}
+
+// output field name, the same as HashGroupBy
+static std::string OutputName(compute::AggregationOpId op, const std::string &name) {
+  const char *prefix = "";
+  switch (op) {
+    case compute::SUM: prefix = compute::KernelTraits<compute::SUM, int64_t>::name();
+      break;
+    case compute::MIN: prefix = compute::KernelTraits<compute::MIN, int64_t>::name();
+      break;
+    case compute::MAX: prefix = compute::KernelTraits<compute::MAX, int64_t>::name();
+      break;
+    case compute::COUNT: prefix = compute::KernelTraits<compute::COUNT, int64_t>::name();
+      break;
+    case compute::MEAN: prefix = compute::KernelTraits<compute::MEAN, int64_t>::name();
+      break;
+    case compute::VAR: prefix = compute::KernelTraits<compute::VAR, int64_t>::name();
+      break;
+    case compute::STDDEV: prefix = compute::KernelTraits<compute::STDDEV, int64_t>::name();
+      break;
+    case compute::NUNIQUE: prefix = compute::KernelTraits<compute::NUNIQUE, int64_t>::name();
+      break;
+    case compute::QUANTILE: prefix = compute::KernelTraits<compute::QUANTILE, int64_t>::name();
+      break;
+  }
+  return name.find(prefix) == std::string::npos ? prefix + name : name;
+}
+
+static Status GetArray(const std::shared_ptr<arrow::Table> &table, int i, arrow::MemoryPool *pool,
+                       std::shared_ptr<arrow::Array> *out) {
+  const auto &col = table->column(i);
+  if (col->num_chunks() == 1) {
+    *out = col->chunk(0);
+  } else if (col->num_chunks() == 0) {
+    CYLON_ASSIGN_OR_RAISE(*out, arrow::MakeArrayOfNull(col->type(), 0, pool))
+  } else {
+    CYLON_ASSIGN_OR_RAISE(*out, arrow::Concatenate(col->chunks(), pool))
+  }
+  return Status::OK();
+}
+
+/**
+ * Allocates a non-null array of C type T, with all values set to init
+ */
+template<typename T>
+static Status MakeValues(int64_t length, T init, arrow::MemoryPool *pool,
+                         std::shared_ptr<arrow::Array> *out, T **values) {
+  using ArrowT = typename arrow::CTypeTraits<T>::ArrowType;
+  CYLON_ASSIGN_OR_RAISE(auto buf, arrow::AllocateBuffer(length * sizeof(T), pool))
+  *values = reinterpret_cast<T *>(buf->mutable_data());
+  std::fill(*values, *values + length, init);
+  *out = arrow::MakeArray(arrow::ArrayData::Make(arrow::TypeTraits<ArrowT>::type_singleton(),
+                                                 length, {nullptr, std::move(buf)}, 0));
+  return Status::OK();
+}
+
+template<typename ArrowT, typename Visitor>
+static void VisitGroups(const std::shared_ptr<arrow::Array> &values, const int64_t *group_ids,
+                        Visitor &&visitor) {
+  using T = typename ArrowT::c_type;
+  int64_t i = 0;
+  arrow::VisitArrayDataInline<ArrowT>(*values->data(),
+                                      [&](const T &val) {
+                                        visitor(val, group_ids[i]);
+                                        i++;
+                                      },
+                                      [&]() { i++; });
+}
+
+template<typename T>
+static const T *StateValues(const std::shared_ptr<arrow::Array> &state) {
+  return state->data()->GetValues<T>(1);
+}
+
+/**
+ * Accumulates the values (or the states, if merge) of each group with fn, in an array of C type S
+ */
+template<typename ArrowT, typename S, typename Fn>
+static Status Accumulate(const std::shared_ptr<arrow::Array> &values, bool merge,
+                         const int64_t *group_ids, int64_t num_groups, S init,
+                         arrow::MemoryPool *pool, Fn &&fn, std::shared_ptr<arrow::Array> *out) {
+  S *acc;
+  RETURN_CYLON_STATUS_IF_FAILED(MakeValues<S>(num_groups, init, pool, out, &acc));
+  if (merge) {
+    const S *states = StateValues<S>(values);
+    for (int64_t i = 0; i < values->length(); i++) {
+      acc[group_ids[i]] = fn(acc[group_ids[i]], states[i]);
+    }
+  } else {
+    VisitGroups<ArrowT>(values, group_ids, [&](const typename ArrowT::c_type &val, int64_t g) {
+      acc[g] = fn(acc[g], static_cast<S>(val));
+    });
+  }
+  return Status::OK();
+}
+
+/**
+ * Sums, sums of squares and counts. Merging the states of the same op gives the states of the
+ * union of the rows.
+ * @param states the values (num_states = 1) or the states to merge
+ */
+template<typename ArrowT>
+static Status AccumulateStates(compute::AggregationOpId op,
+                               const arrow::ArrayVector &states,
+                               bool merge,
+                               const int64_t *group_ids,
+                               int64_t num_groups,
+                               arrow::MemoryPool *pool,
+                               arrow::ArrayVector *out) {
+  using T = typename ArrowT::c_type;
+  const auto &values = states[0];
+  auto sum = [](const T &a, const T &b) -> T { return a + b; };
+  auto sum_sq = [](const T &a, const T &b) -> T { return a + b * b; };
+  auto sums = [&](const std::shared_ptr<arrow::Array> &arr, const auto &fn,
+                  std::shared_ptr<arrow::Array> *res) {
+    return Accumulate<ArrowT, T>(arr, merge, group_ids, num_groups, 0, pool, fn, res);
+  };
+  auto count = [&](const std::shared_ptr<arrow::Array> &arr, std::shared_ptr<arrow::Array> *res) {
+    if (merge) {
+      return Accumulate<arrow::Int64Type, int64_t>(arr, true, group_ids, num_groups, 0, pool,
+                                                   [](int64_t a, int64_t b) { return a + b; }, res);
+    }
+    int64_t *counts;
+    RETURN_CYLON_STATUS_IF_FAILED(MakeValues<int64_t>(num_groups, 0, pool, res, &counts));
+    VisitGroups<ArrowT>(arr, group_ids, [&](const T &val, int64_t g) {
+      CYLON_UNUSED(val);
+      counts[g]++;
+    });
+    return Status::OK();
+  };
+
+  out->resize(NumStates(op));
+  switch (op) {
+    case compute::SUM:
+      return sums(values, sum, &(*out)[0]);
+    case compute::MIN:
+      return Accumulate<ArrowT, T>(values, merge, group_ids, num_groups,
+                                   std::numeric_limits<T>::max(), pool,
+                                   [](const T &a, const T &b) { return std::min(a, b); },
+                                   &(*out)[0]);
+    case compute::MAX:
+      // the same initial value as compute::MaxKernel
+      return Accumulate<ArrowT, T>(values, merge, group_ids, num_groups,
+                                   std::numeric_limits<T>::min(), pool,
+                                   [](const T &a, const T &b) { return std::max(a, b); },
+                                   &(*out)[0]);
+    case compute::COUNT:return count(values, &(*out)[0]);
+    case compute::MEAN:
+      RETURN_CYLON_STATUS_IF_FAILED(sums(values, sum, &(*out)[0]));
+      return count(merge ? states[1] : values, &(*out)[1]);
+    case compute::VAR:
+    case compute::STDDEV: {
+      if (merge) {
+        RETURN_CYLON_STATUS_IF_FAILED(sums(states[0], sum, &(*out)[0]));
+      } else {
+        RETURN_CYLON_STATUS_IF_FAILED(sums(values, sum_sq, &(*out)[0]));
+      }
+      RETURN_CYLON_STATUS_IF_FAILED(sums(merge ? states[1] : values, sum, &(*out)[1]));
+      return count(merge ? states[2] : values, &(*out)[2]);
+    }
+    case compute::NUNIQUE:
+    case compute::QUANTILE:break;
+  }
+  return {Code::Invalid, "op does not have partial states"};
+}
+
+/**
+ * Final results from the merged states, as in the KernelFinalize of the compute kernels
+ */
+template<typename ArrowT>
+static Status FinalizeStates(const compute::AggregationOp &op,
+                             const arrow::ArrayVector &states,
+                             arrow::MemoryPool *pool,
+                             std::shared_ptr<arrow::Array> *out) {
+  using T = typename ArrowT::c_type;
+  const int64_t num_groups = states[0]->length();
+  switch (op.id()) {
+    case compute::SUM:
+    case compute::MIN:
+    case compute::MAX:
+    case compute::COUNT:*out = states[0];
+      return Status::OK();
+    case compute::MEAN: {
+      const T *sums = StateValues<T>(states[0]);
+      const int64_t *counts = StateValues<int64_t>(states[1]);
+      T *means;
+      RETURN_CYLON_STATUS_IF_FAILED(MakeValues<T>(num_groups, 0, pool, out, &means));
+      for (int64_t i = 0; i < num_groups; i++) {
+        if (counts[i] != 0) {
+          means[i] = sums[i] / counts[i];
+        }
+      }
+      return Status::OK();
+    }
+    case compute::VAR:
+    case compute::STDDEV: {
+      const auto *options = reinterpret_cast<compute::VarKernelOptions *>(op.options());
+      const int ddof = options == nullptr ? 0 : options->ddof_;
+      const T *sq_sums = StateValues<T>(states[0]);
+      const T *sums = StateValues<T>(states[1]);
+      const int64_t *counts = StateValues<int64_t>(states[2]);
+      double *res;
+      RETURN_CYLON_STATUS_IF_FAILED(MakeValues<double>(num_groups, 0, pool, out, &res));
+      for (int64_t i = 0; i < num_groups; i++) {
+        if (counts[i] > 1) {
+          const auto count = static_cast<double>(counts[i]);
+          const double mean = static_cast<double>(sums[i]) / count;
+          const double mean_sum_sq = static_cast<double>(sq_sums[i]) / count;
+          const double var = count * (mean_sum_sq - mean * mean) / (counts[i] - ddof);
+          res[i] = op.id() == compute::STDDEV ? sqrt(var) : var;
+        }
+      }
+      return Status::OK();
+    }
+    case compute::NUNIQUE:
+    case compute::QUANTILE:break;
+  }
+  return {Code::Invalid, "op does not have partial states"};
+}
+
+/**
+ * NUNIQUE and QUANTILE from the (value, frequency) digests of the groups
+ */
+template<typename ArrowT>
+static Status FinalizeDigests(const compute::AggregationOp &op,
+                              const std::shared_ptr<arrow::Array> &values,
+                              const int64_t *frequencies,
+                              const int64_t *group_ids,
+                              int64_t num_groups,
+                              arrow::MemoryPool *pool,
+                              std::shared_ptr<arrow::Array> *out) {
+  using T = typename ArrowT::c_type;
+
+  // bucket the valid (value, frequency) pairs by group
+  std::vector<int64_t> offsets(num_groups + 1, 0);
+  VisitGroups<ArrowT>(values, group_ids, [&](const T &val, int64_t g) {
+    CYLON_UNUSED(val);
+    offsets[g + 1]++;
+  });
+  for (int64_t g = 0; g < num_groups; g++) {
+    offsets[g + 1] += offsets[g];
+  }
+  std::vector<std::pair<T, int64_t>> digests(offsets[num_groups]);
+  std::vector<int64_t> next(offsets.begin(), offsets.end() - 1);
+  int64_t row = 0;
+  arrow::VisitArrayDataInline<ArrowT>(*values->data(),
+                                      [&](const T &val) {
+                                        digests[next[group_ids[row]]++] = {val, frequencies[row]};
+                                        row++;
+                                      },
+                                      [&]() { row++; });
+
+  if (op.id() == compute::NUNIQUE) {
+    int64_t *res;
+    RETURN_CYLON_STATUS_IF_FAILED(MakeValues<int64_t>(num_groups, 0, pool, out, &res));
+    for (int64_t g = 0; g < num_groups; g++) {
+      auto begin = digests.begin() + offsets[g], end = digests.begin() + offsets[g + 1];
+      std::sort(begin, end);
+      res[g] = std::distance(begin, std::unique(begin, end, [](const auto &a, const auto &b) {
+        return a.first == b.first;
+      }));
+    }
+    return Status::OK();
+  }
+
+  const auto *options = reinterpret_cast<compute::QuantileKernelOptions *>(op.options());
+  const double quantile = options == nullptr ? 0.5 : options->quantile;
+  double *res;
+  RETURN_CYLON_STATUS_IF_FAILED(MakeValues<double>(num_groups, 0, pool, out, &res));
+  for (int64_t g = 0; g < num_groups; g++) {
+    auto begin = digests.begin() + offsets[g], end = digests.begin() + offsets[g + 1];
+    if (begin == end) {
+      continue;
+    }
+    std::sort(begin, end);
+    int64_t total = 0;
+    for (auto it = begin; it != end; ++it) {
+      total += it->second;
+    }
+    // value at a position of the sorted values
+    auto value_at = [&](int64_t pos) {
+      int64_t seen = 0;
+      for (auto it = begin; it != end; ++it) {
+        seen += it->second;
+        if (pos < seen) {
+          return it->first;
+        }
+      }
+      return (end - 1)->first;
+    };
+
+    // type 2 quantile, as in compute::QuantileKernel
+    const double np = total * quantile, j = floor(np), frac = np - j;
+    const auto pos = std::min(static_cast<int64_t>(j), total - 1);
+    const T val = value_at(pos);
+    if (frac == 0) {
+      res[g] = 0.5 * (static_cast<double>(pos > 0 ? value_at(pos - 1) : val) + val);
+    } else {
+      res[g] = static_cast<double>(val);
+    }
+  }
+  return Status::OK();
+}
+
+std::vector<int> PartialGroupByColumns(int num_keys,
+                                       const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations) {
+  std::vector<int> group_cols(num_keys);
+  std::iota(group_cols.begin(), group_cols.end(), 0);
+  for (size_t i = 0; i < aggregations.size(); i++) {
+    if (IsDigestOp(aggregations[i]->id())) {
+      group_cols.push_back(num_keys + (int) i);
+    }
+  }
+  return group_cols;
+}
+
+static Status MapToGroups(const std::shared_ptr<arrow::Table> &atable,
+                          const std::vector<int> &group_cols,
+                          const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+                          arrow::MemoryPool *pool,
+                          std::shared_ptr<arrow::Array> *group_ids,
+                          std::shared_ptr<arrow::Array> *group_indices,
+                          int64_t *num_groups) {
+  arrow::ArrayVector arrays;
+  arrays.reserve(group_cols.size());
+  for (int i: group_cols) {
+    std::shared_ptr<arrow::Array> arr;
+    RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, i, pool, &arr));
+    arrays.push_back(std::move(arr));
+  }
+  mapred::MapToGroupKernel mapper(pool);
+  return mapper.Map(arrays, row_hashes, group_ids, group_indices, num_groups);
+}
+
+Status PartialHashGroupBy(const std::shared_ptr<Table> &table,
+                          int num_keys,
+                          const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations,
+                          std::shared_ptr<Table> &partial) {
+  const auto &ctx = table->GetContext();
+  auto pool = ToArrowPool(ctx);
+  const auto &atable = table->get_table();
+  if (atable->num_columns() != num_keys + (int) aggregations.size()) {
+    return {Code::Invalid, "expected a value column per aggregation"};
+  }
+
+  const auto &group_cols = PartialGroupByColumns(num_keys, aggregations);
+  const bool has_digests = group_cols.size() > (size_t) num_keys;
+  std::shared_ptr<arrow::Array> group_ids, group_indices;
+  int64_t num_groups;
+  RETURN_CYLON_STATUS_IF_FAILED(MapToGroups(atable, group_cols, nullptr, pool, &group_ids, &group_indices,
+                                            &num_groups));
+  const int64_t *ids = std::static_pointer_cast<arrow::Int64Array>(group_ids)->raw_values();
+
+  arrow::FieldVector fields;
+  arrow::ArrayVector arrays;
+  auto take_groups = [&](int i) {
+    std::shared_ptr<arrow::Array> arr;
+    RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, i, pool, &arr));
+    arrow::compute::ExecContext exec_ctx(pool);
+    CYLON_ASSIGN_OR_RAISE(auto taken, arrow::compute::Take(arr, group_indices,
+                                                           arrow::compute::TakeOptions::NoBoundsCheck(),
+                                                           &exec_ctx))
+    fields.push_back(atable->field(i));
+    arrays.push_back(taken.make_array());
+    return Status::OK();
+  };
+
+  for (int i = 0; i < num_keys; i++) {
+    RETURN_CYLON_STATUS_IF_FAILED(take_groups(i));
+  }
+
+  for (size_t a = 0; a < aggregations.size(); a++) {
+    const int col = num_keys + (int) a;
+    const auto op = aggregations[a]->id();
+    if (IsDigestOp(op)) {
+      RETURN_CYLON_STATUS_IF_FAILED(take_groups(col));
+      continue;
+    }
+
+    std::shared_ptr<arrow::Array> values;
+    RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, col, pool, &values));
+    arrow::ArrayVector states;
+    RETURN_CYLON_STATUS_IF_FAILED(DispatchValueType(values->type(), [&](auto tag) {
+      return AccumulateStates<typename decltype(tag)::type>(op, {values}, false, ids, num_groups,
+                                                            pool, &states);
+    }));
+    for (size_t s = 0; s < states.size(); s++) {
+      fields.push_back(arrow::field(atable->field(col)->name() + "_" + std::to_string(s),
+                                    states[s]->type()));
+      arrays.push_back(std::move(states[s]));
+    }
+  }
+
+  if (has_digests) {
+    // number of rows of each group
+    std::shared_ptr<arrow::Array> counts;
+    int64_t *values;
+    RETURN_CYLON_STATUS_IF_FAILED(MakeValues<int64_t>(num_groups, 0, pool, &counts, &values));
+    for (int64_t i = 0; i < atable->num_rows(); i++) {
+      values[ids[i]]++;
+    }
+    fields.push_back(arrow::field("count", arrow::int64()));
+    arrays.push_back(std::move(counts));
+  }
+
+  return Table::FromArrowTable(ctx, arrow::Table::Make(arrow::schema(std::move(fields)),
+                                                       std::move(arrays)), partial);
+}
+
+Status MergePartialGroupBy(const std::shared_ptr<Table> &partial,
+                           const std::shared_ptr<arrow::Schema> &schema,
+                           int num_keys,
+                           const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations,
+                           std::shared_ptr<Table> &output,
+                           const std::shared_ptr<std::vector<uint32_t>> &row_hashes) {
+  const auto &ctx = partial->GetContext();
+  auto pool = ToArrowPool(ctx);
+  const auto &atable = partial->get_table();
+
+  std::vector<int> key_cols(num_keys);
+  std::iota(key_cols.begin(), key_cols.end(), 0);
+  std::shared_ptr<arrow::Array> group_ids, group_indices;
+  int64_t num_groups;
+  RETURN_CYLON_STATUS_IF_FAILED(MapToGroups(atable, key_cols, row_hashes, pool, &group_ids, &group_indices,
+                                            &num_groups));
+  const int64_t *ids = std::static_pointer_cast<arrow::Int64Array>(group_ids)->raw_values();
+
+  arrow::FieldVector fields;
+  arrow::ArrayVector arrays;
+  arrow::compute::ExecContext exec_ctx(pool);
+  for (int i = 0; i < num_keys; i++) {
+    std::shared_ptr<arrow::Array> arr;
+    RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, i, pool, &arr));
+    CYLON_ASSIGN_OR_RAISE(auto taken, arrow::compute::Take(arr, group_indices,
+                                                           arrow::compute::TakeOptions::NoBoundsCheck(),
+                                                           &exec_ctx))
+    fields.push_back(atable->field(i));
+    arrays.push_back(taken.make_array());
+  }
+
+  // number of rows of the (value, group) pairs of NUNIQUE and QUANTILE
+  std::shared_ptr<arrow::Array> counts;
+  const int64_t *frequencies = nullptr;
+  if (PartialGroupByColumns(num_keys, aggregations).size() > (size_t) num_keys) {
+    RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, atable->num_columns() - 1, pool, &counts));
+    frequencies = StateValues<int64_t>(counts);
+  }
+
+  int col = num_keys;
+  for (size_t a = 0; a < aggregations.size(); a++) {
+    const auto &op = *aggregations[a];
+    const auto &field = schema->field(num_keys + (int) a);
+    const int num_states = NumStates(op.id());
+
+    arrow::ArrayVector states(num_states);
+    for (int s = 0; s < num_states; s++) {
+      RETURN_CYLON_STATUS_IF_FAILED(GetArray(atable, col + s, pool, &states[s]));
+    }
+    col += num_states;
+
+    std::shared_ptr<arrow::Array> result;
+    RETURN_CYLON_STATUS_IF_FAILED(DispatchValueType(field->type(), [&](auto tag) {
+      using ArrowT = typename decltype(tag)::type;
+      if (IsDigestOp(op.id())) {
+        return FinalizeDigests<ArrowT>(op, states[0], frequencies, ids, num_groups, pool, &result);
+      }
+      arrow::ArrayVector merged;
+      RETURN_CYLON_STATUS_IF_FAILED(AccumulateStates<ArrowT>(op.id(), states, true, ids,
+                                                             num_groups, pool, &merged));
+      return FinalizeStates<ArrowT>(op, merged, pool, &result);
+    }));
+
+    fields.push_back(arrow::field(OutputName(op.id(), field->name()), result->type()));
+    arrays.push_back(std::move(result));
+  }
+
+  return Table::FromArrowTable(ctx, arrow::Table::Make(arrow::schema(std::move(fields)),
+                                                       std::move(arrays)), output);
+}
+
+}
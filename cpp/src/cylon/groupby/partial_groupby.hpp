@@ -0,0 +1,91 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_GROUPBY_PARTIAL_GROUPBY_HPP_
+#define CYLON_CPP_SRC_CYLON_GROUPBY_PARTIAL_GROUPBY_HPP_
+
+#include <cylon/table.hpp>
+#include <cylon/compute/aggregate_kernels.hpp>
+
+namespace cylon {
+
+/**
+ * Partial (combine + merge) hash group-by, used by the two-phase DistributedHashGroupBy.
+ *
+ * The table is laid out as key columns [0, num_keys), followed by one value column per
+ * aggregation, ie. aggregations[i] aggregates column num_keys + i.
+ *
+ * The partial table holds a row per local group, with mergeable states that give the same
+ * results as HashGroupBy once merged,
+ *  - SUM, MIN, MAX: the partial aggregate
+ *  - COUNT: the count
+ *  - MEAN: sum and count
+ *  - VAR, STDDEV: sum of squares, sum and count
+ *  - NUNIQUE, QUANTILE: the value itself. Their value columns are added to the group keys, and
+ *  the partial table gets a trailing column with the number of rows of each group. This is an
+ *  exact digest of the distinct values and their frequencies, which is small when the values are
+ *  heavily duplicated within the groups.
+ */
+
+/**
+ * Whether PartialHashGroupBy supports aggregating values of this type
+ * @param type
+ * @return
+ */
+bool IsPartialGroupBySupported(const std::shared_ptr<arrow::DataType> &type);
+
+/**
+ * Group columns of the partial table, ie. the keys and the value columns of NUNIQUE and QUANTILE
+ * @param num_keys
+ * @param aggregations
+ * @return
+ */
+std::vector<int> PartialGroupByColumns(int num_keys,
+                                       const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations);
+
+/**
+ * Combines the rows of each local group into a row of the partial table. This is a local operation.
+ * @param table
+ * @param num_keys
+ * @param aggregations
+ * @param partial
+ * @return
+ */
+Status PartialHashGroupBy(const std::shared_ptr<Table> &table,
+                          int num_keys,
+                          const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations,
+                          std::shared_ptr<Table> &partial);
+
+/**
+ * Merges the rows of partial tables (ie. after a shuffle on the key columns), and produces the
+ * same output as HashGroupBy on the input table. This is a local operation.
+ * @param partial
+ * @param schema schema of the input table of PartialHashGroupBy
+ * @param num_keys
+ * @param aggregations
+ * @param output
+ * @param row_hashes (optional) row hashes of the key columns of the partial table (HashRows), ie.
+ * the hashes that the shuffle carried along with the rows
+ * @return
+ */
+Status MergePartialGroupBy(const std::shared_ptr<Table> &partial,
+                           const std::shared_ptr<arrow::Schema> &schema,
+                           int num_keys,
+                           const std::vector<std::shared_ptr<compute::AggregationOp>> &aggregations,
+                           std::shared_ptr<Table> &output,
+                           const std::shared_ptr<std::vector<uint32_t>> &row_hashes = nullptr);
+
+}
+
+#endif //CYLON_CPP_SRC_CYLON_GROUPBY_PARTIAL_GROUPBY_HPP_
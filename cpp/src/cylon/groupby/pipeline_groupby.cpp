@@ -21,6 +21,7 @@
 #include <cylon/util/macros.hpp>
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/ctx/memory_tracker.hpp>
 
 #include <cylon/groupby/pipeline_groupby.hpp>
 
@@ -215,6 +216,7 @@ Status PipelineGroupBy(std::shared_ptr<Table> &table,
                        const std::vector<std::pair<int32_t, compute::AggregationOpId>> &aggregations,
                        std::shared_ptr<Table> &output) {
   const auto& ctx = table->GetContext();
+  MemoryScope memory_scope(ctx, "groupby");
   arrow::MemoryPool *pool = ToArrowPool(ctx);
 
   const std::shared_ptr<arrow::Table> &a_table = table->get_table();
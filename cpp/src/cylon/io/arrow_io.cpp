@@ -14,6 +14,7 @@
 
 #include <arrow/io/api.h>
 #include <arrow/csv/api.h>
+#include <arrow/ipc/api.h>
 #include <memory>
 
 #ifdef BUILD_CYLON_PARQUET
@@ -56,6 +57,37 @@ arrow::Result<std::shared_ptr<arrow::Table>> read_csv(const std::shared_ptr<Cylo
   return (*reader)->Read();
 }
 
+arrow::Status WriteIPC(const std::shared_ptr<arrow::Table> &table, const std::string &path) {
+  ARROW_ASSIGN_OR_RAISE(auto sink, arrow::io::FileOutputStream::Open(path))
+  ARROW_ASSIGN_OR_RAISE(auto writer, arrow::ipc::MakeFileWriter(sink, table->schema()))
+  ARROW_RETURN_NOT_OK(writer->WriteTable(*table));
+  ARROW_RETURN_NOT_OK(writer->Close());
+  return sink->Close();
+}
+
+arrow::Result<std::shared_ptr<arrow::Table>> ReadIPC(const std::string &path,
+                                                     bool memory_map,
+                                                     arrow::MemoryPool *pool) {
+  std::shared_ptr<arrow::io::RandomAccessFile> file;
+  if (memory_map) {
+    ARROW_ASSIGN_OR_RAISE(file, arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ))
+  } else {
+    ARROW_ASSIGN_OR_RAISE(file, arrow::io::ReadableFile::Open(path, pool))
+  }
+
+  auto options = arrow::ipc::IpcReadOptions::Defaults();
+  options.memory_pool = pool;
+  ARROW_ASSIGN_OR_RAISE(auto reader, arrow::ipc::RecordBatchFileReader::Open(file, options))
+
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  batches.reserve(reader->num_record_batches());
+  for (int i = 0; i < reader->num_record_batches(); i++) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i))
+    batches.push_back(std::move(batch));
+  }
+  return arrow::Table::FromRecordBatches(reader->schema(), std::move(batches));
+}
+
 #ifdef BUILD_CYLON_PARQUET
 // Read Parquet
 arrow::Result<std::shared_ptr<arrow::Table>> ReadParquet(const std::shared_ptr<cylon::CylonContext> &ctx,
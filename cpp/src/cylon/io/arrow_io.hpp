@@ -33,6 +33,26 @@ arrow::Result<std::shared_ptr<arrow::Table>> read_csv(const std::shared_ptr<Cylo
                                                       const std::string &path,
                                                       cylon::io::config::CSVReadOptions options = cylon::io::config::CSVReadOptions());
 
+/**
+ * Writes a table to an Arrow IPC file
+ * @param table
+ * @param path
+ * @return
+ */
+arrow::Status WriteIPC(const std::shared_ptr<arrow::Table> &table, const std::string &path);
+
+/**
+ * Reads an Arrow IPC file
+ * @param path
+ * @param memory_map if true, the file is memory mapped and the table is paged in on demand. Else the
+ * file is read into buffers allocated from pool
+ * @param pool
+ * @return
+ */
+arrow::Result<std::shared_ptr<arrow::Table>> ReadIPC(const std::string &path,
+                                                     bool memory_map = true,
+                                                     arrow::MemoryPool *pool = arrow::default_memory_pool());
+
 #ifdef BUILD_CYLON_PARQUET
 arrow::Result<std::shared_ptr<arrow::Table>> ReadParquet(const std::shared_ptr<cylon::CylonContext> &ctx,
                                                          const std::string &path);
@@ -13,8 +13,11 @@
  */
 
 #include <glog/logging.h>
+#include <limits>
+
 #include <cylon/join/hash_join.hpp>
 #include <cylon/arrow/arrow_comparator.hpp>
+#include <cylon/util/parallel.hpp>
 
 namespace cylon {
 namespace join {
@@ -143,15 +146,29 @@ inline void calculate_metadata(cylon::join::config::JoinType join_type, int64_t
   }
 }
 
+/**
+ * Composite hash of the key columns of a table. Uses the precomputed row hashes, if any.
+ */
+static Status make_row_index_hash(const std::shared_ptr<arrow::Table> &table,
+                                  const std::vector<int> &cols,
+                                  const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+                                  std::unique_ptr<TableRowIndexHash> *hash) {
+  if (row_hashes == nullptr) {
+    return TableRowIndexHash::Make(table, cols, hash);
+  }
+  if ((int64_t) row_hashes->size() != table->num_rows()) {
+    return {Code::Invalid, "number of row hashes should be equal to the number of rows"};
+  }
+  *hash = std::make_unique<TableRowIndexHash>(row_hashes);
+  return Status::OK();
+}
+
 Status multi_index_hash_join(const std::shared_ptr<arrow::Table> &ltab,
                              const std::shared_ptr<arrow::Table> &rtab,
                              const config::JoinConfig &config,
+                             const std::array<std::shared_ptr<std::vector<uint32_t>>, 2> &row_hashes,
                              std::shared_ptr<arrow::Table> *joined_table,
                              arrow::MemoryPool *memory_pool) {
-  if (ltab->column(0)->num_chunks() > 1 || rtab->column(0)->num_chunks() > 1) {
-    return {Code::Invalid, "left or right table has chunked arrays"};
-  }
-
   // 2 element arrays containing [left, right] info
   const std::array<const std::shared_ptr<arrow::Table> *, 2> tabs{&ltab, &rtab};
   const std::array<const std::vector<int> *, 2>
@@ -178,12 +195,13 @@ Status multi_index_hash_join(const std::shared_ptr<arrow::Table> &ltab,
   const int64_t probe_size = (*tabs[!build_idx])->num_rows();
 
   // populate left hash table
-  std::unique_ptr<DualTableRowIndexHash> hash;
-  RETURN_CYLON_STATUS_IF_FAILED (DualTableRowIndexHash::Make(*tabs[build_idx],
-                                                             *tabs[!build_idx],
-                                                             *col_indices[build_idx],
-                                                             *col_indices[!build_idx],
-                                                             &hash));
+  std::unique_ptr<TableRowIndexHash> build_hash, probe_hash;
+  RETURN_CYLON_STATUS_IF_FAILED(make_row_index_hash(*tabs[build_idx], *col_indices[build_idx],
+                                                    row_hashes[build_idx], &build_hash));
+  RETURN_CYLON_STATUS_IF_FAILED(make_row_index_hash(*tabs[!build_idx], *col_indices[!build_idx],
+                                                    row_hashes[!build_idx], &probe_hash));
+  const auto hash = std::make_unique<DualTableRowIndexHash>(std::move(build_hash),
+                                                            std::move(probe_hash));
 
   std::unique_ptr<DualTableRowIndexEqualTo> equal_to;
   RETURN_CYLON_STATUS_IF_FAILED(DualTableRowIndexEqualTo::Make(*tabs[build_idx],
@@ -213,11 +231,12 @@ Status multi_index_hash_join(const std::shared_ptr<arrow::Table> &ltab,
                                  config.GetRightTableSuffix(), joined_table, memory_pool);
 }
 
-Status ArrayIndexHashJoin(const std::shared_ptr<arrow::Array> &left_idx_col,
-                          const std::shared_ptr<arrow::Array> &right_idx_col,
-                          config::JoinType join_type,
-                          std::vector<int64_t> &left_table_indices,
-                          std::vector<int64_t> &right_table_indices) {
+static Status array_index_hash_join(const std::shared_ptr<arrow::Array> &left_idx_col,
+                                    const std::shared_ptr<arrow::Array> &right_idx_col,
+                                    config::JoinType join_type,
+                                    const std::array<std::shared_ptr<std::vector<uint32_t>>, 2> &row_hashes,
+                                    std::vector<int64_t> &left_table_indices,
+                                    std::vector<int64_t> &right_table_indices) {
   if (left_idx_col->type_id() != right_idx_col->type_id()) {
     return {Code::Invalid, "left and right index array types are not equal"};
   }
@@ -243,17 +262,26 @@ Status ArrayIndexHashJoin(const std::shared_ptr<arrow::Array> &left_idx_col,
   const int64_t build_size = (*arrays[build_idx])->length();
   const int64_t probe_size = (*arrays[!build_idx])->length();
 
-  // precalculate hashes
+  // precalculate hashes, unless they are given
   std::unique_ptr<HashPartitionKernel> hash_kernel;
   RETURN_CYLON_STATUS_IF_FAILED(CreateHashPartitionKernel(left_idx_col->type(), &hash_kernel));
-  std::array<std::vector<uint32_t>, 2>
-      hashes{std::vector<uint32_t>(build_size, 0),
-             std::vector<uint32_t>(probe_size, 0)};
-  hash_kernel->UpdateHash(*arrays[build_idx], hashes[0]); // calc hashes of left array
-  hash_kernel->UpdateHash(*arrays[!build_idx], hashes[1]); // calc hashes of right array
-
-  const auto &hash = [&hashes](const int64_t idx) -> uint32_t { // hash lambda
-    return hashes[cylon::util::CheckBit(idx)][cylon::util::ClearBit(idx)];
+  std::array<std::shared_ptr<std::vector<uint32_t>>, 2>
+      hashes{row_hashes[build_idx], row_hashes[!build_idx]};
+  const std::array<int64_t, 2> sizes{build_size, probe_size};
+  for (int i = 0; i < 2; i++) {
+    if (hashes[i] == nullptr) {
+      hashes[i] = std::make_shared<std::vector<uint32_t>>(sizes[i], 0);
+      // calc hashes of build (0) and probe (1) arrays
+      RETURN_CYLON_STATUS_IF_FAILED(hash_kernel->UpdateHash(*arrays[i == 0 ? build_idx : !build_idx],
+                                                            *hashes[i]));
+    } else if ((int64_t) hashes[i]->size() != sizes[i]) {
+      return {Code::Invalid, "number of row hashes should be equal to the number of rows"};
+    }
+  }
+  const std::array<const uint32_t *, 2> hash_values{hashes[0]->data(), hashes[1]->data()};
+
+  const auto &hash = [&hash_values](const int64_t idx) -> uint32_t { // hash lambda
+    return hash_values[cylon::util::CheckBit(idx)][cylon::util::ClearBit(idx)];
   };
 
   // comparator
@@ -278,52 +306,364 @@ Status ArrayIndexHashJoin(const std::shared_ptr<arrow::Array> &left_idx_col,
   for (int64_t i = 0; i < build_size; i++) {
     hash_map.emplace(i, i);
   }
-  hashes[0].clear(); // hashes of the building array are no longer needed
   // probe
-
   do_probe(join_type, hash_map, build_size, probe_size, *row_indices[build_idx],
            *row_indices[!build_idx]);
-  hashes[1].clear();
 
   return Status::OK();
 }
 
+Status ArrayIndexHashJoin(const std::shared_ptr<arrow::Array> &left_idx_col,
+                          const std::shared_ptr<arrow::Array> &right_idx_col,
+                          config::JoinType join_type,
+                          std::vector<int64_t> &left_table_indices,
+                          std::vector<int64_t> &right_table_indices) {
+  return array_index_hash_join(left_idx_col, right_idx_col, join_type, {nullptr, nullptr},
+                               left_table_indices, right_table_indices);
+}
+
+/**
+ * hash of a row index in the partitioned hash join. Build table rows are plain indices and probe
+ * table rows have the most significant bit set (same encoding as DualTableRowIndexHash)
+ */
+class PartitionedRowIndexHash {
+ public:
+  PartitionedRowIndexHash(const TableRowIndexHash *build_hash, const TableRowIndexHash *probe_hash)
+      : hashes({build_hash, probe_hash}) {}
+
+  size_t operator()(const int64_t &idx) const {
+    return (*hashes[cylon::util::CheckBit(idx)])(cylon::util::ClearBit(idx));
+  }
+
+ private:
+  std::array<const TableRowIndexHash *, 2> hashes;
+};
+
+// upper bound for the number of radix bits used to partition the tables
+static constexpr int kMaxRadixBits = 12;
+// approximate footprint of a node in std::unordered_multimap<int64_t, int64_t>
+static constexpr int64_t kHashMapNodeBytes = 32;
+
+/**
+ * picks the number of radix bits such that a build partition (keys + hash map) fits in the cache,
+ * while producing enough partitions to keep all threads busy
+ */
+static int calculate_radix_bits(const std::shared_ptr<arrow::Table> &build_tab,
+                                const std::vector<int> &build_cols,
+                                int num_threads) {
+  const auto &elems_and_bytes = cylon::util::GetBytesAndElements(build_tab, build_cols);
+  const int64_t num_rows = build_tab->num_rows();
+  const int64_t total_bytes = elems_and_bytes[1] + num_rows * kHashMapNodeBytes;
+
+  uint64_t num_partitions = cylon::util::GetNumberSplitsToFitInCache(
+      total_bytes, (int) std::min<int64_t>(num_rows, std::numeric_limits<int>::max()), 1);
+  // a few partitions per thread helps balance skewed partitions
+  num_partitions = std::max<uint64_t>(num_partitions, 4 * (uint64_t) num_threads);
+
+  int bits = 0;
+  while (bits < kMaxRadixBits && (uint64_t(1) << bits) < num_partitions) {
+    bits++;
+  }
+  return bits;
+}
+
+/**
+ * stable scatter of row indices [0, num_rows) into 2^radix_bits partitions based on the upper bits
+ * of the row hashes. Indices within a partition remain in ascending order.
+ * @param hash
+ * @param num_rows
+ * @param radix_bits
+ * @param num_threads
+ * @param indices partitioned row indices
+ * @param offsets partition p occupies [offsets[p], offsets[p + 1]) of indices
+ */
+static Status radix_partition(const TableRowIndexHash &hash, int64_t num_rows, int radix_bits,
+                              int num_threads, std::vector<int64_t> &indices,
+                              std::vector<int64_t> &offsets) {
+  const int64_t num_partitions = int64_t(1) << radix_bits;
+  const int shift = 32 - radix_bits;
+  const auto &partition_of = [&](int64_t i) -> int64_t {
+    return radix_bits == 0 ? 0 : static_cast<uint32_t>(hash(i)) >> shift;
+  };
+
+  // every thread handles a contiguous range of rows
+  const int64_t num_chunks = std::max<int64_t>(1, std::min<int64_t>(num_threads, num_rows));
+  const int64_t chunk_size = (num_rows + num_chunks - 1) / num_chunks;
+  std::vector<std::vector<int64_t>> histograms(num_chunks, std::vector<int64_t>(num_partitions, 0));
+
+  RETURN_CYLON_STATUS_IF_FAILED(cylon::util::ParallelFor(num_threads, num_chunks, [&](int64_t c) {
+    auto &hist = histograms[c];
+    const int64_t end = std::min(num_rows, (c + 1) * chunk_size);
+    for (int64_t i = c * chunk_size; i < end; i++) {
+      hist[partition_of(i)]++;
+    }
+    return Status::OK();
+  }));
+
+  // partition-major prefix sum keeps the scatter stable
+  offsets.assign(num_partitions + 1, 0);
+  int64_t acc = 0;
+  for (int64_t p = 0; p < num_partitions; p++) {
+    offsets[p] = acc;
+    for (int64_t c = 0; c < num_chunks; c++) {
+      const int64_t cnt = histograms[c][p];
+      histograms[c][p] = acc; // histogram now holds the write position of the chunk
+      acc += cnt;
+    }
+  }
+  offsets[num_partitions] = acc;
+
+  indices.resize(num_rows);
+  return cylon::util::ParallelFor(num_threads, num_chunks, [&](int64_t c) {
+    auto &pos = histograms[c];
+    const int64_t end = std::min(num_rows, (c + 1) * chunk_size);
+    for (int64_t i = c * chunk_size; i < end; i++) {
+      indices[pos[partition_of(i)]++] = i;
+    }
+    return Status::OK();
+  });
+}
+
+static Status partitioned_hash_join(const std::shared_ptr<arrow::Table> &ltab,
+                                    const std::shared_ptr<arrow::Table> &rtab,
+                                    const config::JoinConfig &config,
+                                    const std::array<std::shared_ptr<std::vector<uint32_t>>, 2> &row_hashes,
+                                    std::shared_ptr<arrow::Table> *joined_table,
+                                    arrow::MemoryPool *memory_pool) {
+  const int num_threads = cylon::util::GetNumThreads(config.GetNumThreads());
+  const auto join_type = config.GetType();
+
+  // 2 element arrays containing [left, right] info
+  const std::array<const std::shared_ptr<arrow::Table> *, 2> tabs{&ltab, &rtab};
+  const std::array<const std::vector<int> *, 2>
+      col_indices{&config.GetLeftColumnIdx(), &config.GetRightColumnIdx()};
+  std::array<std::vector<int64_t>, 2> row_indices{std::vector<int64_t>{}, std::vector<int64_t>{}};
+
+  int64_t init_vec_size = 0;
+  // if 0: build from left and probe from right; else: build from right and probe from left
+  bool build_idx = false;
+  calculate_metadata(join_type, ltab->num_rows(), rtab->num_rows(), &build_idx, &init_vec_size);
+
+  const auto &build_tab = *tabs[build_idx];
+  const auto &probe_tab = *tabs[!build_idx];
+  const int64_t build_size = build_tab->num_rows();
+  const int64_t probe_size = probe_tab->num_rows();
+
+  // precalculate composite hashes of both tables, unless they are given
+  std::unique_ptr<TableRowIndexHash> build_hash, probe_hash;
+  RETURN_CYLON_STATUS_IF_FAILED(make_row_index_hash(build_tab, *col_indices[build_idx],
+                                                    row_hashes[build_idx], &build_hash));
+  RETURN_CYLON_STATUS_IF_FAILED(make_row_index_hash(probe_tab, *col_indices[!build_idx],
+                                                    row_hashes[!build_idx], &probe_hash));
+
+  std::unique_ptr<DualTableRowIndexEqualTo> equal_to;
+  RETURN_CYLON_STATUS_IF_FAILED(DualTableRowIndexEqualTo::Make(build_tab, probe_tab,
+                                                               *col_indices[build_idx],
+                                                               *col_indices[!build_idx],
+                                                               &equal_to));
+
+  // radix partition both tables with the same hash bits
+  const int radix_bits = calculate_radix_bits(build_tab, *col_indices[build_idx], num_threads);
+  const int64_t num_partitions = int64_t(1) << radix_bits;
+
+  std::vector<int64_t> build_rows, build_offsets, probe_rows, probe_offsets;
+  if (build_size > 0) {
+    RETURN_CYLON_STATUS_IF_FAILED(radix_partition(*build_hash, build_size, radix_bits, num_threads,
+                                                  build_rows, build_offsets));
+  } else {
+    build_offsets.assign(num_partitions + 1, 0);
+  }
+  if (probe_size > 0) {
+    RETURN_CYLON_STATUS_IF_FAILED(radix_partition(*probe_hash, probe_size, radix_bits, num_threads,
+                                                  probe_rows, probe_offsets));
+  } else {
+    probe_offsets.assign(num_partitions + 1, 0);
+  }
+
+  using PartitionHashMMap = typename std::unordered_multimap<int64_t, int64_t,
+                                                             PartitionedRowIndexHash,
+                                                             DualTableRowIndexEqualTo>;
+  const PartitionedRowIndexHash hash(build_hash.get(), probe_hash.get());
+
+  // number of output rows of each probe row. every probe row belongs to exactly one partition,
+  // hence threads never write to the same element
+  std::vector<int64_t> probe_counts(probe_size, 0);
+  // build rows that found a match (only used for full outer joins)
+  std::vector<uint8_t> build_matched(join_type == config::FULL_OUTER ? build_size : 0, 0);
+  // (build, probe) pairs of each partition, in ascending probe row order
+  std::vector<std::array<std::vector<int64_t>, 2>> partition_results(num_partitions);
+  const bool fill_probe = join_type == config::LEFT || join_type == config::RIGHT;
+
+  // build and probe each partition independently
+  RETURN_CYLON_STATUS_IF_FAILED(cylon::util::ParallelFor(num_threads, num_partitions, [&](int64_t p) {
+    const int64_t b_start = build_offsets[p], b_end = build_offsets[p + 1];
+    const int64_t p_start = probe_offsets[p], p_end = probe_offsets[p + 1];
+    auto &build_out = partition_results[p][0];
+    auto &probe_out = partition_results[p][1];
+
+    if (b_start == b_end) { // empty build partition, only the unmatched rows would be emitted
+      if (fill_probe) {
+        build_out.assign(p_end - p_start, -1);
+        probe_out.assign(probe_rows.begin() + p_start, probe_rows.begin() + p_end);
+        for (int64_t k = p_start; k < p_end; k++) {
+          probe_counts[probe_rows[k]] = 1;
+        }
+      }
+      return Status::OK();
+    }
+
+    PartitionHashMMap hash_map((size_t) (b_end - b_start), hash, *equal_to);
+    for (int64_t k = b_start; k < b_end; k++) {
+      hash_map.emplace(build_rows[k], build_rows[k]);
+    }
+
+    build_out.reserve(p_end - p_start);
+    probe_out.reserve(p_end - p_start);
+    for (int64_t k = p_start; k < p_end; k++) {
+      const int64_t i = probe_rows[k];
+      const auto &range = hash_map.equal_range(cylon::util::SetBit(i));
+      int64_t matches = 0;
+      for (auto it = range.first; it != range.second; it++, matches++) {
+        build_out.push_back(it->second);
+        probe_out.push_back(i);
+        if (join_type == config::FULL_OUTER) {
+          build_matched[it->second] = 1;
+        }
+      }
+      if (matches == 0 && fill_probe) {
+        build_out.push_back(-1);
+        probe_out.push_back(i);
+        matches = 1;
+      }
+      probe_counts[i] = matches;
+    }
+    return Status::OK();
+  }));
+
+  // exclusive scan of the counts gives the position of each probe row in the output, which
+  // arranges the results in the same order as the single threaded hash join
+  int64_t num_matched = 0;
+  for (int64_t i = 0; i < probe_size; i++) {
+    const int64_t cnt = probe_counts[i];
+    probe_counts[i] = num_matched;
+    num_matched += cnt;
+  }
+
+  int64_t num_build_unmatched = 0, num_probe_unmatched = 0;
+  if (join_type == config::FULL_OUTER) {
+    num_build_unmatched = build_size - std::count(build_matched.begin(), build_matched.end(), 1);
+    // in full outer joins, unmatched probe rows have zero output rows
+    for (int64_t i = 0; i < probe_size; i++) {
+      num_probe_unmatched += (i + 1 < probe_size ? probe_counts[i + 1] : num_matched)
+          == probe_counts[i];
+    }
+  }
+
+  auto &build_out = row_indices[build_idx];
+  auto &probe_out = row_indices[!build_idx];
+  const int64_t total = num_matched + num_build_unmatched + num_probe_unmatched;
+  build_out.resize(total);
+  probe_out.resize(total);
+
+  RETURN_CYLON_STATUS_IF_FAILED(cylon::util::ParallelFor(num_threads, num_partitions, [&](int64_t p) {
+    auto &res = partition_results[p];
+    int64_t prev = -1, pos = 0;
+    for (size_t k = 0; k < res[1].size(); k++) {
+      const int64_t i = res[1][k];
+      if (i != prev) {
+        pos = probe_counts[i];
+        prev = i;
+      }
+      build_out[pos] = res[0][k];
+      probe_out[pos] = i;
+      pos++;
+    }
+    res[0].clear();
+    res[0].shrink_to_fit();
+    res[1].clear();
+    res[1].shrink_to_fit();
+    return Status::OK();
+  }));
+
+  if (join_type == config::FULL_OUTER) {
+    int64_t pos = num_matched;
+    for (int64_t b = 0; b < build_size; b++) {
+      if (!build_matched[b]) {
+        build_out[pos] = b;
+        probe_out[pos] = -1;
+        pos++;
+      }
+    }
+    for (int64_t i = 0; i < probe_size; i++) {
+      if ((i + 1 < probe_size ? probe_counts[i + 1] : num_matched) == probe_counts[i]) {
+        build_out[pos] = -1;
+        probe_out[pos] = i;
+        pos++;
+      }
+    }
+  }
+
+  return util::build_final_table(row_indices[0], row_indices[1],
+                                 ltab, rtab, config.GetLeftTableSuffix(),
+                                 config.GetRightTableSuffix(), joined_table, memory_pool);
+}
+
+Status PartitionedHashJoin(const std::shared_ptr<arrow::Table> &ltab,
+                           const std::shared_ptr<arrow::Table> &rtab,
+                           const config::JoinConfig &config,
+                           std::shared_ptr<arrow::Table> *joined_table,
+                           arrow::MemoryPool *memory_pool) {
+  return partitioned_hash_join(ltab, rtab, config, {nullptr, nullptr}, joined_table, memory_pool);
+}
+
 Status HashJoin(const std::shared_ptr<arrow::Table> &ltab,
                 const std::shared_ptr<arrow::Table> &rtab,
                 const config::JoinConfig &config,
                 std::shared_ptr<arrow::Table> *joined_table,
                 arrow::MemoryPool *memory_pool) {
+  return HashJoin(ltab, rtab, config, nullptr, nullptr, joined_table, memory_pool);
+}
+
+Status HashJoin(const std::shared_ptr<arrow::Table> &ltab,
+                const std::shared_ptr<arrow::Table> &rtab,
+                const config::JoinConfig &config,
+                const std::shared_ptr<std::vector<uint32_t>> &left_hashes,
+                const std::shared_ptr<std::vector<uint32_t>> &right_hashes,
+                std::shared_ptr<arrow::Table> *joined_table,
+                arrow::MemoryPool *memory_pool) {
   if (config.GetLeftColumnIdx().size() != config.GetRightColumnIdx().size()) {
     return {Code::Invalid, "left and right index vector sizes should be the same"};
   }
+  const std::array<std::shared_ptr<std::vector<uint32_t>>, 2> row_hashes{left_hashes, right_hashes};
 
-  // let's first combine chunks in both tables
-  std::shared_ptr<arrow::Table> c_ltab(ltab);
-  COMBINE_CHUNKS_RETURN_CYLON_STATUS(c_ltab, memory_pool);
-
-  std::shared_ptr<arrow::Table> c_rtab(rtab);
-  COMBINE_CHUNKS_RETURN_CYLON_STATUS(c_rtab, memory_pool);
+  // chunked columns are hashed, compared and copied in place, without combining the chunks
+  if (cylon::util::GetNumThreads(config.GetNumThreads()) > 1) {
+    return partitioned_hash_join(ltab, rtab, config, row_hashes, joined_table, memory_pool);
+  }
 
-  if (config.GetLeftColumnIdx().size() == 1) {
+  if (config.GetLeftColumnIdx().size() == 1
+      && !cylon::util::CheckArrowTableContainsChunks(ltab, config.GetLeftColumnIdx())
+      && !cylon::util::CheckArrowTableContainsChunks(rtab, config.GetRightColumnIdx())) {
     int left_idx = config.GetLeftColumnIdx()[0];
     int right_idx = config.GetRightColumnIdx()[0];
 
     std::vector<int64_t> left_indices, right_indices;
 
     RETURN_CYLON_STATUS_IF_FAILED(
-        ArrayIndexHashJoin(cylon::util::GetChunkOrEmptyArray(c_ltab->column(left_idx), 0),
-                           cylon::util::GetChunkOrEmptyArray(c_rtab->column(right_idx), 0),
-                           config.GetType(),
-                           left_indices,
-                           right_indices));
-
-    return util::build_final_table(left_indices, right_indices, c_ltab, c_rtab,
+        array_index_hash_join(cylon::util::GetChunkOrEmptyArray(ltab->column(left_idx), 0),
+                              cylon::util::GetChunkOrEmptyArray(rtab->column(right_idx), 0),
+                              config.GetType(),
+                              row_hashes,
+                              left_indices,
+                              right_indices));
+
+    return util::build_final_table(left_indices, right_indices, ltab, rtab,
                                    config.GetLeftTableSuffix(), config.GetRightTableSuffix(),
                                    joined_table, memory_pool);
   } else {
-    return multi_index_hash_join(c_ltab, c_rtab, config, joined_table, memory_pool);
+    return multi_index_hash_join(ltab, rtab, config, row_hashes, joined_table, memory_pool);
   }
 }
 
 }
-}
\ No newline at end of file
+}
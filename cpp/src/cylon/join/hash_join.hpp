@@ -41,6 +41,23 @@ Status ArrayIndexHashJoin(const std::shared_ptr<arrow::Array> &left_idx_col,
                                  std::vector<int64_t> &left_table_indices,
                                  std::vector<int64_t> &right_table_indices);
 
+/**
+ * Multi-threaded hash join of two tables. Both tables are radix partitioned on the upper bits of
+ * the key hashes, such that every build partition fits in the cache. Threads then build and probe
+ * partitions independently. The output is identical to the single threaded hash join.
+ * @param ltab
+ * @param rtab
+ * @param config (config.GetNumThreads() is used as the number of threads)
+ * @param joined_table
+ * @param memory_pool
+ * @return
+ */
+Status PartitionedHashJoin(const std::shared_ptr<arrow::Table> &ltab,
+                           const std::shared_ptr<arrow::Table> &rtab,
+                           const config::JoinConfig &config,
+                           std::shared_ptr<arrow::Table> *joined_table,
+                           arrow::MemoryPool *memory_pool);
+
 /**
  * Performs hash joins on two tables
  * @param ltab
@@ -56,6 +73,27 @@ Status HashJoin(const std::shared_ptr<arrow::Table> &ltab,
                        std::shared_ptr<arrow::Table> *joined_table,
                        arrow::MemoryPool *memory_pool);
 
+/**
+ * Performs hash joins on two tables, with precomputed row hashes of the join columns (HashRows),
+ * ie. the hashes that a hash shuffle carried along with the rows. The hash tables use them instead
+ * of hashing the rows again.
+ * @param ltab
+ * @param rtab
+ * @param config
+ * @param left_hashes hashes of the left table rows, or nullptr to compute them
+ * @param right_hashes hashes of the right table rows, or nullptr to compute them
+ * @param joined_table
+ * @param memory_pool
+ * @return
+ */
+Status HashJoin(const std::shared_ptr<arrow::Table> &ltab,
+                const std::shared_ptr<arrow::Table> &rtab,
+                const config::JoinConfig &config,
+                const std::shared_ptr<std::vector<uint32_t>> &left_hashes,
+                const std::shared_ptr<std::vector<uint32_t>> &right_hashes,
+                std::shared_ptr<arrow::Table> *joined_table,
+                arrow::MemoryPool *memory_pool);
+
 }
 }
 
@@ -18,6 +18,7 @@
 
 #include <cylon/join/join.hpp>
 #include <cylon/join/join_utils.hpp>
+#include <cylon/join/join_planner.hpp>
 #include <cylon/join/hash_join.hpp>
 #include <cylon/join/sort_join.hpp>
 #include <cylon/arrow/arrow_kernels.hpp>
@@ -69,6 +70,13 @@ Status JoinTables(const std::shared_ptr<arrow::Table> &left_tab,
     return {Code::Invalid, "left and right index sizes are not equal"};
   }
 
+  if (join_config.GetAlgorithm() == config::AUTO) {
+    JoinPlan plan;
+    RETURN_CYLON_STATUS_IF_FAILED(PlanJoin(left_tab, right_tab, join_config, &plan));
+    return JoinTables(left_tab, right_tab, join_config.WithAlgorithm(plan.algorithm), joined_table,
+                      memory_pool);
+  }
+
   if (join_config.GetAlgorithm() == config::HASH) {
     // hash joins
     return HashJoin(left_tab, right_tab, join_config, joined_table, memory_pool);
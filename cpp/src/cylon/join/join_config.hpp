@@ -25,8 +25,23 @@ namespace config {
 enum JoinType {
   INNER, LEFT, RIGHT, FULL_OUTER
 };
+/**
+ * AUTO picks SORT or HASH from sampled statistics of the key columns (see join/join_planner.hpp).
+ * In a distributed join, it also decides between shuffling both tables and broadcasting the
+ * smaller one.
+ */
 enum JoinAlgorithm {
-  SORT, HASH
+  SORT, HASH, AUTO
+};
+
+/**
+ * Hint for DistributedJoin to replicate one table to all workers and join it with the local
+ * partition of the other table, instead of shuffling both tables. The left table can be broadcast
+ * for INNER and RIGHT joins, and the right table for INNER and LEFT joins. Ignored when the world
+ * size is 1.
+ */
+enum BroadcastHint {
+  BROADCAST_NONE, BROADCAST_LEFT_TABLE, BROADCAST_RIGHT_TABLE
 };
 
 class JoinConfig {
@@ -183,12 +198,55 @@ class JoinConfig {
     return left_column_idx.size() > 1 || right_column_idx.size() > 1;
   }
 
+  /**
+   * Number of threads used by the local hash join. With more than 1 thread, the hash join builds
+   * and probes radix partitions of both tables in parallel. The result is identical to the single
+   * threaded hash join. A value <= 0 uses all hardware threads.
+   * @param threads
+   * @return
+   */
+  JoinConfig &SetNumThreads(int threads) {
+    num_threads = threads;
+    return *this;
+  }
+
+  int GetNumThreads() const {
+    return num_threads;
+  }
+
+  /**
+   * Broadcast a table in DistributedJoin, regardless of the table sizes
+   * @param hint
+   * @return
+   */
+  JoinConfig &SetBroadcastHint(BroadcastHint hint) {
+    broadcast_hint = hint;
+    return *this;
+  }
+
+  BroadcastHint GetBroadcastHint() const {
+    return broadcast_hint;
+  }
+
+  /**
+   * Copy of this config with a different algorithm
+   * @param join_algorithm
+   * @return
+   */
+  JoinConfig WithAlgorithm(JoinAlgorithm join_algorithm) const {
+    JoinConfig config(*this);
+    config.algorithm = join_algorithm;
+    return config;
+  }
+
 private:
   JoinType type;
   JoinAlgorithm algorithm;
   const std::vector<int> left_column_idx, right_column_idx;
   const std::string left_table_suffix;
   const std::string right_table_suffix;
+  int num_threads = 1;
+  BroadcastHint broadcast_hint = BROADCAST_NONE;
 };
 }  // namespace util
 }  // namespace join
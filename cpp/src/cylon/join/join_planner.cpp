@@ -0,0 +1,272 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+
+#include <arrow/compute/api.h>
+
+#include <cylon/join/join_planner.hpp>
+#include <cylon/arrow/arrow_comparator.hpp>
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/table.hpp>
+#include <cylon/util/arrow_utils.hpp>
+#include <cylon/util/macros.hpp>
+
+namespace cylon {
+namespace join {
+
+// keys are heavily duplicated if less than this fraction of the rows are distinct
+static constexpr double kLowCardinalityRatio = 0.01;
+// tables are of comparable sizes if the larger one has at most this many times the rows
+static constexpr int64_t kComparableSizeRatio = 4;
+
+static const char *AlgorithmName(config::JoinAlgorithm algorithm) {
+  switch (algorithm) {
+    case config::SORT: return "SORT";
+    case config::HASH: return "HASH";
+    case config::AUTO: return "AUTO";
+  }
+  return "";
+}
+
+static const char *DistributionName(JoinDistribution distribution) {
+  switch (distribution) {
+    case SHUFFLE: return "SHUFFLE";
+    case BROADCAST_LEFT: return "BROADCAST_LEFT";
+    case BROADCAST_RIGHT: return "BROADCAST_RIGHT";
+  }
+  return "";
+}
+
+Status SampleKeyStats(const std::shared_ptr<arrow::Table> &table,
+                      const std::vector<int> &key_columns,
+                      KeyStats *stats,
+                      int64_t sample_size) {
+  std::vector<int> all_columns(table->num_columns());
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+
+  stats->rows = table->num_rows();
+  stats->bytes = util::GetBytesAndElements(table, all_columns)[1];
+  stats->distinct = 0;
+  stats->sorted = key_columns.size() == 1;
+  if (stats->rows == 0) {
+    return Status::OK();
+  }
+
+  // evenly spaced rows, in ascending order
+  const int64_t n = std::min(stats->rows, sample_size);
+  arrow::Int64Builder builder;
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.Reserve(n));
+  for (int64_t i = 0; i < n; i++) {
+    builder.UnsafeAppend(i * stats->rows / n);
+  }
+  CYLON_ASSIGN_OR_RAISE(auto indices, builder.Finish())
+
+  std::vector<std::shared_ptr<arrow::Array>> sample;
+  sample.reserve(key_columns.size());
+  for (int col: key_columns) {
+    CYLON_ASSIGN_OR_RAISE(auto taken, arrow::compute::Take(table->column(col), indices))
+    const auto &chunks = taken.chunked_array()->chunks();
+    if (chunks.size() == 1) {
+      sample.push_back(chunks[0]);
+    } else {
+      CYLON_ASSIGN_OR_RAISE(auto combined, arrow::Concatenate(chunks))
+      sample.push_back(std::move(combined));
+    }
+  }
+
+  std::unique_ptr<TableRowIndexHash> hash;
+  RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(sample, &hash));
+  std::unordered_map<size_t, int64_t> counts;
+  counts.reserve(n);
+  for (int64_t i = 0; i < n; i++) {
+    counts[(*hash)(i)]++;
+  }
+  int64_t f1 = 0;
+  for (const auto &c: counts) {
+    f1 += c.second == 1;
+  }
+  const auto d = static_cast<int64_t>(counts.size());
+  const auto estimate = static_cast<int64_t>(
+      std::sqrt(static_cast<double>(stats->rows) / n) * f1 + static_cast<double>(d - f1));
+  stats->distinct = std::min(stats->rows, std::max(d, estimate));
+
+  if (stats->sorted) {
+    std::unique_ptr<ArrayIndexComparator> comp;
+    RETURN_CYLON_STATUS_IF_FAILED(CreateArrayIndexComparator(sample[0], &comp));
+    for (int64_t i = 0; i + 1 < n && stats->sorted; i++) {
+      stats->sorted = comp->compare(i, i + 1) <= 0;
+    }
+  }
+  return Status::OK();
+}
+
+config::JoinAlgorithm ChooseJoinAlgorithm(const KeyStats &left, const KeyStats &right) {
+  if (left.sorted && right.sorted) {
+    return config::SORT;
+  }
+
+  const int64_t min_rows = std::min(left.rows, right.rows);
+  const int64_t max_rows = std::max(left.rows, right.rows);
+  const bool low_cardinality = left.distinct < kLowCardinalityRatio * left.rows
+      && right.distinct < kLowCardinalityRatio * right.rows;
+  if (low_cardinality && max_rows <= kComparableSizeRatio * min_rows) {
+    return config::SORT;
+  }
+  return config::HASH;
+}
+
+Status PlanJoin(const std::shared_ptr<arrow::Table> &left,
+                const std::shared_ptr<arrow::Table> &right,
+                const config::JoinConfig &join_config,
+                JoinPlan *plan) {
+  KeyStats left_stats, right_stats;
+  RETURN_CYLON_STATUS_IF_FAILED(SampleKeyStats(left, join_config.GetLeftColumnIdx(), &left_stats));
+  RETURN_CYLON_STATUS_IF_FAILED(SampleKeyStats(right, join_config.GetRightColumnIdx(), &right_stats));
+
+  plan->algorithm = ChooseJoinAlgorithm(left_stats, right_stats);
+  plan->distribution = SHUFFLE;
+
+  LOG(INFO) << "Join plan: " << AlgorithmName(plan->algorithm)
+            << " left [rows " << left_stats.rows << " distinct " << left_stats.distinct
+            << " sorted " << left_stats.sorted << "]"
+            << " right [rows " << right_stats.rows << " distinct " << right_stats.distinct
+            << " sorted " << right_stats.sorted << "]";
+  return Status::OK();
+}
+
+/**
+ * Picks the table to broadcast, if any
+ * @param check_cost broadcast only if it moves fewer bytes than the shuffle
+ */
+static JoinDistribution ChooseDistribution(config::JoinType type, int64_t left_bytes,
+                                           int64_t right_bytes, int world_size,
+                                           int64_t max_broadcast_bytes, bool check_cost) {
+  const bool can_broadcast_left = type == config::INNER || type == config::RIGHT;
+  const bool can_broadcast_right = type == config::INNER || type == config::LEFT;
+
+  JoinDistribution candidate;
+  int64_t bytes;
+  if (can_broadcast_right && (right_bytes < left_bytes || !can_broadcast_left)) {
+    candidate = BROADCAST_RIGHT;
+    bytes = right_bytes;
+  } else if (can_broadcast_left) {
+    candidate = BROADCAST_LEFT;
+    bytes = left_bytes;
+  } else {
+    return SHUFFLE;
+  }
+
+  if (bytes > max_broadcast_bytes
+      || (check_cost && bytes * world_size >= left_bytes + right_bytes)) {
+    return SHUFFLE;
+  }
+  return candidate;
+}
+
+static Status FollowBroadcastHint(const config::JoinConfig &join_config,
+                                  JoinDistribution *distribution) {
+  const auto type = join_config.GetType();
+  switch (join_config.GetBroadcastHint()) {
+    case config::BROADCAST_NONE:break;
+    case config::BROADCAST_LEFT_TABLE:
+      if (type != config::INNER && type != config::RIGHT) {
+        return {Code::Invalid, "left table can be broadcast only in inner and right joins"};
+      }
+      *distribution = BROADCAST_LEFT;
+      break;
+    case config::BROADCAST_RIGHT_TABLE:
+      if (type != config::INNER && type != config::LEFT) {
+        return {Code::Invalid, "right table can be broadcast only in inner and left joins"};
+      }
+      *distribution = BROADCAST_RIGHT;
+      break;
+  }
+  return Status::OK();
+}
+
+Status PlanDistributedJoin(const std::shared_ptr<Table> &left,
+                           const std::shared_ptr<Table> &right,
+                           const config::JoinConfig &join_config,
+                           JoinPlan *plan) {
+  const auto &ctx = left->GetContext();
+  const bool is_auto = join_config.GetAlgorithm() == config::AUTO;
+  const auto &threshold_config = ctx->GetConfig(kBroadcastJoinThresholdConfig);
+  const bool has_threshold = !threshold_config.empty();
+  const bool has_hint = join_config.GetBroadcastHint() != config::BROADCAST_NONE;
+
+  plan->algorithm = join_config.GetAlgorithm();
+  plan->distribution = SHUFFLE;
+  RETURN_CYLON_STATUS_IF_FAILED(FollowBroadcastHint(join_config, &plan->distribution));
+  if (!is_auto && (has_hint || !has_threshold)) {
+    // no stats needed
+    return Status::OK();
+  }
+
+  KeyStats left_stats, right_stats;
+  if (is_auto) {
+    RETURN_CYLON_STATUS_IF_FAILED(SampleKeyStats(left->get_table(), join_config.GetLeftColumnIdx(),
+                                                 &left_stats));
+    RETURN_CYLON_STATUS_IF_FAILED(SampleKeyStats(right->get_table(),
+                                                 join_config.GetRightColumnIdx(), &right_stats));
+  } else {
+    std::vector<int> left_columns(left->Columns()), right_columns(right->Columns());
+    std::iota(left_columns.begin(), left_columns.end(), 0);
+    std::iota(right_columns.begin(), right_columns.end(), 0);
+    left_stats.bytes = util::GetBytesAndElements(left->get_table(), left_columns)[1];
+    right_stats.bytes = util::GetBytesAndElements(right->get_table(), right_columns)[1];
+  }
+
+  // global stats. summing up the distinct estimates overestimates the distinct keys, when the same
+  // key is in more than one worker
+  arrow::Int64Builder builder(ToArrowPool(ctx));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.AppendValues(
+      {left_stats.rows, left_stats.bytes, left_stats.distinct,
+       right_stats.rows, right_stats.bytes, right_stats.distinct}));
+  CYLON_ASSIGN_OR_RAISE(auto local, builder.Finish())
+  std::shared_ptr<Column> global;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->AllReduce(Column::Make(std::move(local)),
+                                                                  net::SUM, &global));
+  const auto &sums = std::static_pointer_cast<arrow::Int64Array>(global->data());
+  left_stats = {sums->Value(0), sums->Value(1), sums->Value(2), false};
+  right_stats = {sums->Value(3), sums->Value(4), sums->Value(5), false};
+
+  if (is_auto) {
+    plan->algorithm = ChooseJoinAlgorithm(left_stats, right_stats);
+  }
+  if (!has_hint) {
+    const int64_t max_broadcast_bytes = has_threshold ? std::stoll(threshold_config)
+                                                      : kBroadcastJoinMaxBytes;
+    plan->distribution = ChooseDistribution(join_config.GetType(), left_stats.bytes,
+                                            right_stats.bytes, ctx->GetWorldSize(),
+                                            max_broadcast_bytes, /*check_cost=*/is_auto);
+  }
+
+  LOG_IF(INFO, is_auto && ctx->GetRank() == 0) << "Distributed join plan: "
+                                               << AlgorithmName(plan->algorithm) << " "
+                                               << DistributionName(plan->distribution)
+                                               << " left [rows " << left_stats.rows
+                                               << " bytes " << left_stats.bytes
+                                               << " distinct " << left_stats.distinct << "]"
+                                               << " right [rows " << right_stats.rows
+                                               << " bytes " << right_stats.bytes
+                                               << " distinct " << right_stats.distinct << "]";
+  return Status::OK();
+}
+
+}  // namespace join
+}  // namespace cylon
@@ -0,0 +1,143 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_JOIN_JOIN_PLANNER_HPP_
+#define CYLON_CPP_SRC_CYLON_JOIN_JOIN_PLANNER_HPP_
+
+#include <arrow/api.h>
+
+#include <cylon/join/join_config.hpp>
+#include <cylon/status.hpp>
+
+namespace cylon {
+class Table;
+
+namespace join {
+
+/**
+ * Number of rows sampled from each table to compute the KeyStats
+ */
+constexpr int64_t kKeyStatsSampleSize = 4096;
+
+/**
+ * Largest (global) size of a table that AUTO joins broadcast, unless kBroadcastJoinThresholdConfig
+ * is set
+ */
+constexpr int64_t kBroadcastJoinMaxBytes = 64LL * 1024 * 1024;
+
+/**
+ * Config key (in CylonContext) for the size threshold (in bytes) of broadcast joins. If set, every
+ * DistributedJoin broadcasts the smaller table (that can be broadcast for the join type) when its
+ * global size is at most this many bytes. It also replaces kBroadcastJoinMaxBytes for AUTO joins.
+ * Must be the same in all workers.
+ */
+constexpr const char *kBroadcastJoinThresholdConfig = "broadcast_join_threshold_bytes";
+
+/**
+ * Cheap statistics of the key columns of a table, computed from an evenly spaced sample of rows
+ */
+struct KeyStats {
+  int64_t rows = 0;
+  // size of the table (all columns)
+  int64_t bytes = 0;
+  // estimated number of distinct keys
+  int64_t distinct = 0;
+  // the sampled keys are in ascending order (single key column only)
+  bool sorted = false;
+};
+
+/**
+ * Computes the KeyStats of a table. Distinct keys are estimated from the key hashes of the sample
+ * using the GEE estimator (Charikar et al.), sqrt(rows/n) * f1 + (d - f1), where n is the sample
+ * size, d the number of distinct sampled keys, and f1 the number of keys seen exactly once.
+ * @param table
+ * @param key_columns
+ * @param stats
+ * @param sample_size
+ * @return
+ */
+Status SampleKeyStats(const std::shared_ptr<arrow::Table> &table,
+                      const std::vector<int> &key_columns,
+                      KeyStats *stats,
+                      int64_t sample_size = kKeyStatsSampleSize);
+
+enum JoinDistribution {
+  // hash shuffle both tables
+  SHUFFLE,
+  // replicate the left table to all workers, and join with the local partition of the right
+  BROADCAST_LEFT,
+  // replicate the right table to all workers, and join with the local partition of the left
+  BROADCAST_RIGHT
+};
+
+struct JoinPlan {
+  config::JoinAlgorithm algorithm = config::HASH;
+  JoinDistribution distribution = SHUFFLE;
+};
+
+/**
+ * Picks the local join algorithm.
+ *  - SORT, if both tables are sorted on a single key column
+ *  - SORT, if the keys of both tables are heavily duplicated (< 1% distinct) and the tables are of
+ *  comparable sizes, as sort join emits the runs of equal keys without chaining in a hash table
+ *  - HASH otherwise
+ * @param left
+ * @param right
+ * @return
+ */
+config::JoinAlgorithm ChooseJoinAlgorithm(const KeyStats &left, const KeyStats &right);
+
+/**
+ * Plans a local join with AUTO algorithm
+ * @param left
+ * @param right
+ * @param join_config
+ * @param plan
+ * @return
+ */
+Status PlanJoin(const std::shared_ptr<arrow::Table> &left,
+                const std::shared_ptr<arrow::Table> &right,
+                const config::JoinConfig &join_config,
+                JoinPlan *plan);
+
+/**
+ * Plans a distributed join. This is a collective operation, unless the algorithm is SORT/HASH and
+ * the config has a broadcast hint, or kBroadcastJoinThresholdConfig is not set.
+ *
+ * The broadcast hint of the config is followed if set. It is invalid to broadcast a table whose
+ * unmatched rows are kept by the join type.
+ *
+ * Otherwise, the sizes (and for AUTO, the KeyStats) of all workers are summed up, and the smaller
+ * table (in bytes) S is broadcast instead of shuffling both tables L and R, if
+ *  - the join type keeps the unmatched rows of the other table only (INNER, or LEFT/RIGHT joins
+ *  broadcasting the right/left table),
+ *  - S <= kBroadcastJoinThresholdConfig (or kBroadcastJoinMaxBytes for AUTO), and
+ *  - for AUTO, S * world_size < L + R, ie. replicating S moves fewer bytes than shuffling both.
+ * The AUTO algorithm is chosen as in ChooseJoinAlgorithm, but ignoring sortedness, as neither a
+ * shuffled nor a gathered table retains the order. AUTO decisions are logged.
+ * @param left
+ * @param right
+ * @param join_config
+ * @param plan
+ * @return
+ */
+Status PlanDistributedJoin(const std::shared_ptr<Table> &left,
+                           const std::shared_ptr<Table> &right,
+                           const config::JoinConfig &join_config,
+                           JoinPlan *plan);
+
+}  // namespace join
+}  // namespace cylon
+
+#endif //CYLON_CPP_SRC_CYLON_JOIN_JOIN_PLANNER_HPP_
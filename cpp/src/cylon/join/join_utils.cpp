@@ -94,11 +94,11 @@ Status build_final_table_inplace_index(size_t left_inplace_column, size_t right_
     std::shared_ptr<arrow::Array> destination_col_array;
     if (i == left_inplace_column) {
       RETURN_CYLON_STATUS_IF_ARROW_FAILED(cylon::util::copy_array_by_indices(
-          left_indices, cylon::util::GetChunkOrEmptyArray(ca, 0), &destination_col_array,
+          left_indices, ca, &destination_col_array,
           memory_pool));
     } else {
       RETURN_CYLON_STATUS_IF_ARROW_FAILED(cylon::util::copy_array_by_indices(
-          indices_indexed, cylon::util::GetChunkOrEmptyArray(ca, 0), &destination_col_array,
+          indices_indexed, ca, &destination_col_array,
           memory_pool));
     }
     data_arrays.push_back(destination_col_array);
@@ -121,11 +121,11 @@ Status build_final_table_inplace_index(size_t left_inplace_column, size_t right_
     std::shared_ptr<arrow::Array> destination_col_array;
     if (i == right_inplace_column) {
       RETURN_CYLON_STATUS_IF_ARROW_FAILED(cylon::util::copy_array_by_indices(
-          right_indices, cylon::util::GetChunkOrEmptyArray(ca, 0), &destination_col_array,
+          right_indices, ca, &destination_col_array,
           memory_pool));
     } else {
       RETURN_CYLON_STATUS_IF_ARROW_FAILED(cylon::util::copy_array_by_indices(
-          indices_indexed, cylon::util::GetChunkOrEmptyArray(ca, 0), &destination_col_array,
+          indices_indexed, ca, &destination_col_array,
           memory_pool));
     }
 
@@ -153,7 +153,7 @@ Status build_final_table(const std::vector<int64_t> &left_indices,
     std::shared_ptr<arrow::Array> destination_col_array;
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(
         cylon::util::copy_array_by_indices(left_indices,
-                                           cylon::util::GetChunkOrEmptyArray(column, 0),
+                                           column,
                                            &destination_col_array,
                                            memory_pool));
     data_arrays.push_back(destination_col_array);
@@ -164,7 +164,7 @@ Status build_final_table(const std::vector<int64_t> &left_indices,
     std::shared_ptr<arrow::Array> destination_col_array;
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(
         cylon::util::copy_array_by_indices(right_indices,
-                                           cylon::util::GetChunkOrEmptyArray(column, 0),
+                                           column,
                                            &destination_col_array,
                                            memory_pool));
     data_arrays.push_back(destination_col_array);
@@ -438,6 +438,14 @@ Status MapToGroupKernel::Map(const arrow::ArrayVector &arrays,
                              std::shared_ptr<arrow::Array> *local_group_ids,
                              std::shared_ptr<arrow::Array> *local_group_indices,
                              int64_t *local_num_groups) const {
+  return Map(arrays, nullptr, local_group_ids, local_group_indices, local_num_groups);
+}
+
+Status MapToGroupKernel::Map(const arrow::ArrayVector &arrays,
+                             const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+                             std::shared_ptr<arrow::Array> *local_group_ids,
+                             std::shared_ptr<arrow::Array> *local_group_indices,
+                             int64_t *local_num_groups) const {
   const int64_t num_rows = arrays[0]->length();
   if (std::any_of(arrays.begin() + 1, arrays.end(),
                   [&](const auto &arr) { return arr->length() != num_rows; })) {
@@ -456,7 +464,14 @@ Status MapToGroupKernel::Map(const arrow::ArrayVector &arrays,
   RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexEqualTo::Make(arrays, &comp));
 
   std::unique_ptr<TableRowIndexHash> hash;
-  RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(arrays, &hash));
+  if (row_hashes != nullptr) {
+    if ((int64_t) row_hashes->size() != num_rows) {
+      return {Code::Invalid, "number of row hashes should be equal to the number of rows"};
+    }
+    hash = std::make_unique<TableRowIndexHash>(row_hashes);
+  } else {
+    RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(arrays, &hash));
+  }
 
   ska::bytell_hash_map<int64_t, int64_t, TableRowIndexHash, TableRowIndexEqualTo>
       hash_map(num_rows, *hash, *comp);
@@ -766,7 +781,9 @@ Status DistAggregate(const std::shared_ptr<CylonContext> &ctx,
   std::iota(shuffle_keys.begin(), shuffle_keys.end(), 0);
   // shuffle and update
   RETURN_CYLON_STATUS_IF_FAILED(Shuffle(shuffle_table, shuffle_keys, shuffle_table));
-  const auto &shuffled_atable = shuffle_table->get_table();
+  // the shuffle returns a chunk per received table
+  auto shuffled_atable = shuffle_table->get_table();
+  COMBINE_CHUNKS_RETURN_CYLON_STATUS(shuffled_atable, pool);
 
   // make output schema
   std::shared_ptr<arrow::Schema> out_schema;
@@ -879,7 +896,8 @@ Status DistAggregateSingleStage(const std::shared_ptr<CylonContext> &ctx,
   std::shared_ptr<Table> shuffled_table;
   RETURN_CYLON_STATUS_IF_FAILED(ShuffleTable(ctx, atable, key_cols, agg_kernels,
                                              &shuffled_table, &new_key_cols, &new_agg_kernels));
-  const auto &shuffled_atable = shuffled_table->get_table();
+  auto shuffled_atable = shuffled_table->get_table();
+  COMBINE_CHUNKS_RETURN_CYLON_STATUS(shuffled_atable, pool);
   const auto &shuffled_schema = atable->schema();
 
   // make output schema
@@ -40,6 +40,22 @@ struct MapToGroupKernel {
              std::shared_ptr<arrow::Array> *local_group_indices,
              int64_t *local_num_groups) const;
 
+  /**
+   * Same as Map, with precomputed row hashes of the arrays (HashRows), which the hash map uses
+   * instead of hashing the rows again
+   * @param arrays
+   * @param row_hashes
+   * @param local_group_ids
+   * @param local_group_indices
+   * @param local_num_groups
+   * @return
+   */
+  Status Map(const arrow::ArrayVector &arrays,
+             const std::shared_ptr<std::vector<uint32_t>> &row_hashes,
+             std::shared_ptr<arrow::Array> *local_group_ids,
+             std::shared_ptr<arrow::Array> *local_group_indices,
+             int64_t *local_num_groups) const;
+
  private:
   arrow::MemoryPool *pool_;
 };
@@ -38,20 +38,26 @@ namespace cylon {
     virtual Status Allocate(int64_t length, std::shared_ptr<Buffer> *buffer) = 0;
   };
 
+  /**
+   * Buffer owning a heap allocated array
+   */
   class DefaultBuffer : public Buffer {
    public:
     int64_t GetLength() const override {
       return length;
     }
     uint8_t * GetByteBuffer() override {
-      return buf;
+      return buf.get();
     }
     DefaultBuffer(uint8_t *buf, int64_t length) : buf(buf), length(length) {}
    private:
-    uint8_t *buf;
+    std::unique_ptr<uint8_t[]> buf;
     int64_t length;
   };
 
+  /**
+   * Allocates a new array for every buffer. Use cylon::PooledArrowAllocator to reuse the buffers
+   */
   class DefaultAllocator : public Allocator {
    public:
     cylon::Status Allocate(int64_t length, std::shared_ptr<Buffer> *buffer) override {
@@ -18,15 +18,35 @@
 #include <vector>
 #include <memory>
 #include <cstring>
+#include <cstdint>
+#include <limits>
 #include <cylon/net/cylon_request.hpp>
 #include <cylon/net/buffer.hpp>
 
 namespace cylon {
 
-#define CYLON_CHANNEL_HEADER_SIZE 8
+// the header of a message: the 64-bit length (2 ints), the finish flag, and upto 6 ints of the
+// request header
+#define CYLON_CHANNEL_HEADER_SIZE 9
+#define CYLON_CHANNEL_HEADER_PREFIX 3
 #define CYLON_MSG_FIN 1
 #define CYLON_MSG_NOT_FIN 0
 
+/**
+ * Messages longer than this are sent as multiple chunks, as the transports count bytes in ints
+ */
+constexpr int64_t kChannelMaxChunkBytes = std::numeric_limits<int32_t>::max();
+
+inline void SetHeaderLength(int *header, int64_t length) {
+  header[0] = static_cast<int>(static_cast<uint64_t>(length) & 0xFFFFFFFFu);
+  header[1] = static_cast<int>(static_cast<uint64_t>(length) >> 32u);
+}
+
+inline int64_t GetHeaderLength(const int *header) {
+  return static_cast<int64_t>(static_cast<uint64_t>(static_cast<uint32_t>(header[0]))
+      | (static_cast<uint64_t>(static_cast<uint32_t>(header[1])) << 32u));
+}
+
 /**
  * When a send is complete, this callback is called by the channel, it is the responsibility
  * of the operations to register this callback
@@ -47,7 +67,7 @@ class ChannelReceiveCallback {
  public:
   virtual ~ChannelReceiveCallback() = default;
 
-  virtual void receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int length) = 0;
+  virtual void receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int64_t length) = 0;
 
   virtual void receivedHeader(int receiveId, int finished, int *header, int headerLength) = 0;
 };
@@ -97,7 +117,27 @@ class Channel {
    */
   virtual void close() = 0;
 
+  /**
+   * Messages longer than this are sent in chunks of this many bytes. Should be the same at the
+   * senders and receivers.
+   * @param bytes
+   */
+  void SetMaxChunkBytes(int64_t bytes) { max_chunk_bytes_ = bytes; }
+
+  /**
+   * Headers and messages upto this size are packed together into one network message (per
+   * target), instead of a header message and a data message each. 0 disables it. Channels that
+   * do not coalesce ignore it. Should be the same at the senders and receivers, and set before
+   * init.
+   * @param bytes
+   */
+  void SetEagerBytes(int64_t bytes) { eager_bytes_ = bytes; }
+
   virtual ~Channel() = default;
+
+ protected:
+  int64_t max_chunk_bytes_ = kChannelMaxChunkBytes;
+  int64_t eager_bytes_ = 0;
 };
 }  // namespace cylon
 
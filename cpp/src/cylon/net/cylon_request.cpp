@@ -24,13 +24,13 @@ cylon::CylonRequest::CylonRequest(int tgt) {
   target = tgt;
 }
 
-cylon::CylonRequest::CylonRequest(int tgt, const void *buf, int len) {
+cylon::CylonRequest::CylonRequest(int tgt, const void *buf, int64_t len) {
   target = tgt;
   buffer = buf;
   length = len;
 }
 
-cylon::CylonRequest::CylonRequest(int tgt, const void *buf, int len, int *head, int hLength) {
+cylon::CylonRequest::CylonRequest(int tgt, const void *buf, int64_t len, int *head, int hLength) {
   target = tgt;
   buffer = buf;
   length = len;
@@ -15,6 +15,7 @@
 #ifndef CYLON_TXREQUEST_H
 #define CYLON_TXREQUEST_H
 
+#include <cstdint>
 #include <iostream>
 
 namespace cylon {
@@ -22,14 +23,14 @@ class CylonRequest {
 
  public:
   const void *buffer{};
-  int length{};
+  int64_t length{};
   int target;
   int header[6] = {};
   int headerLength{};
 
-  CylonRequest(int tgt, const void *buf, int len);
+  CylonRequest(int tgt, const void *buf, int64_t len);
 
-  CylonRequest(int tgt, const void *buf, int len, int *head, int hLength);
+  CylonRequest(int tgt, const void *buf, int64_t len, int *head, int hLength);
 
   explicit CylonRequest(int tgt);
 
@@ -93,17 +93,20 @@ void GlooChannel::sendHeader(std::pair<const int, PendingSend> &x) const {
   assert(dest == r.target);
 
   // put the length to the buffer
-  pend_send.header_buf[0] = r.length;
-  pend_send.header_buf[1] = CYLON_MSG_NOT_FIN;
+  SetHeaderLength(pend_send.header_buf, r.length);
+  pend_send.header_buf[2] = CYLON_MSG_NOT_FIN;
 
   // copy the memory of the header
   if (r.headerLength > 0) {
-    memcpy(pend_send.header_buf + 2, r.header, r.headerLength * sizeof(int));
+    memcpy(pend_send.header_buf + CYLON_CHANNEL_HEADER_PREFIX, r.header,
+           r.headerLength * sizeof(int));
   }
 
-  // we have to add 2 to the header length
+  // we have to add the prefix to the header length. gloo buffers are sized in size_t, so the
+  // data is not chunked like in the MPI channel
   pend_send.request =
-      ctx_ptr->createUnboundBuffer(&pend_send.header_buf[0], (2 + r.headerLength) * sizeof(int));
+      ctx_ptr->createUnboundBuffer(&pend_send.header_buf[0],
+                                   (CYLON_CHANNEL_HEADER_PREFIX + r.headerLength) * sizeof(int));
   pend_send.request->send(dest, edge_);
   //DLOG(INFO) << "send header " << pend_send.header_buf[3] << " " << rank << "->" << dest;
   pend_send.status = SEND_LENGTH_POSTED;
@@ -112,10 +115,11 @@ void GlooChannel::sendHeader(std::pair<const int, PendingSend> &x) const {
 void GlooChannel::sendFinishHeader(std::pair<const int, PendingSend> &x) const {
   int dest = x.first;
   auto &pend_send = x.second;
-  // for the last header we always send only the first 2 integers
-  pend_send.header_buf[0] = 0;
-  pend_send.header_buf[1] = CYLON_MSG_FIN;
-  pend_send.request = ctx_ptr->createUnboundBuffer(pend_send.header_buf, 2 * sizeof(int));
+  // for the last header we always send only the prefix
+  SetHeaderLength(pend_send.header_buf, 0);
+  pend_send.header_buf[2] = CYLON_MSG_FIN;
+  pend_send.request = ctx_ptr->createUnboundBuffer(pend_send.header_buf,
+                                                   CYLON_CHANNEL_HEADER_PREFIX * sizeof(int));
   pend_send.request->send(dest, edge_);
   //DLOG(INFO) << "send finish " << pend_send.header_buf[3] << " " << rank << "->" << dest;
   pend_send.status = SEND_FINISH;
@@ -280,8 +284,8 @@ void GlooChannel::progressReceives() {
       if (flag) {
         pend_rec.request->waitRecv();
         // read the length from the header
-        int length = pend_rec.header_buf[0];
-        int finFlag = pend_rec.header_buf[1];
+        int64_t length = GetHeaderLength(pend_rec.header_buf);
+        int finFlag = pend_rec.header_buf[2];
         // check weather we are at the end
         if (finFlag != CYLON_MSG_FIN) {
           // malloc a buffer
@@ -294,9 +298,9 @@ void GlooChannel::progressReceives() {
           pend_rec.request->recv(pend_rec.recv_id, edge_);
           //DLOG(INFO) << "rcv data " << pend_rec.header_buf[3] << " " << src << "->" << rank;
           pend_rec.status = RECEIVE_POSTED;
-          // copy the count - 2 to the buffer
+          // copy the user header following the prefix to the buffer
           int *header = new int[6];
-          memcpy(header, &(x.second.header_buf[2]), 6 * sizeof(int));
+          memcpy(header, &(x.second.header_buf[CYLON_CHANNEL_HEADER_PREFIX]), 6 * sizeof(int));
           // notify the receiver
           rcv_fn->receivedHeader(src, CYLON_MSG_NOT_FIN, header, 6);
         } else {
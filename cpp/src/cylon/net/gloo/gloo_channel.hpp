@@ -44,7 +44,7 @@ enum ReceiveStatus {
  * Keep track about the length buffer to receive the length first
  */
 struct PendingSend {
-  //  we allow upto 8 ints for the header
+  //  we allow upto 6 ints for the user header
   int header_buf[CYLON_CHANNEL_HEADER_SIZE]{};
   std::queue<std::shared_ptr<CylonRequest>> pending_data;
   SendStatus status = SEND_INIT;
@@ -55,11 +55,11 @@ struct PendingSend {
 };
 
 struct PendingReceive {
-  // we allow upto 8 integer header
+  // we allow upto 6 integer user header
   int header_buf[CYLON_CHANNEL_HEADER_SIZE]{};
   int recv_id{};
   std::shared_ptr<Buffer> data{};
-  int length{};
+  int64_t length{};
   ReceiveStatus status = RECEIVE_INIT;
 
   std::unique_ptr<gloo::transport::UnboundBuffer> request;
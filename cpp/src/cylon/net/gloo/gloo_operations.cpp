@@ -30,11 +30,11 @@ void GlooTableAllgatherImpl::Init(int num_buffers) {
   CYLON_UNUSED(num_buffers);
 }
 
-Status GlooTableAllgatherImpl::AllgatherBufferSizes(const int32_t *send_data,
+Status GlooTableAllgatherImpl::AllgatherBufferSizes(const int64_t *send_data,
                                                     int num_buffers,
-                                                    int32_t *rcv_data) const {
+                                                    int64_t *rcv_data) const {
   gloo::AllgatherOptions opts(*ctx_ptr_);
-  opts.setInput(const_cast<int32_t *>(send_data), num_buffers);
+  opts.setInput(const_cast<int64_t *>(send_data), num_buffers);
   opts.setOutput(rcv_data, num_buffers * (*ctx_ptr_)->size);
 
   gloo::allgather(opts);
@@ -43,10 +43,10 @@ Status GlooTableAllgatherImpl::AllgatherBufferSizes(const int32_t *send_data,
 }
 Status GlooTableAllgatherImpl::IallgatherBufferData(int buf_idx,
                                                     const uint8_t *send_data,
-                                                    int32_t send_count,
+                                                    int64_t send_count,
                                                     uint8_t *recv_data,
-                                                    const std::vector<int32_t> &recv_count,
-                                                    const std::vector<int32_t> &displacements) {
+                                                    const std::vector<int64_t> &recv_count,
+                                                    const std::vector<int64_t> &displacements) {
   CYLON_UNUSED(buf_idx);
   CYLON_UNUSED(displacements);
 
@@ -67,12 +67,12 @@ void GlooTableGatherImpl::Init(int num_buffers) {
   CYLON_UNUSED(num_buffers);
 }
 
-Status GlooTableGatherImpl::GatherBufferSizes(const int32_t *send_data,
+Status GlooTableGatherImpl::GatherBufferSizes(const int64_t *send_data,
                                               int num_buffers,
-                                              int32_t *rcv_data,
-                                              int gather_root) const {
+                                              int64_t *rcv_data,
+                                              int gather_root) {
   gloo::GatherOptions opts(*ctx_ptr_);
-  opts.setInput(const_cast<int32_t *>(send_data), num_buffers);
+  opts.setInput(const_cast<int64_t *>(send_data), num_buffers);
 
   if (gather_root == (*ctx_ptr_)->rank) {
     opts.setOutput(rcv_data, num_buffers * (*ctx_ptr_)->size);
@@ -87,10 +87,10 @@ Status GlooTableGatherImpl::GatherBufferSizes(const int32_t *send_data,
 
 Status GlooTableGatherImpl::IgatherBufferData(int buf_idx,
                                               const uint8_t *send_data,
-                                              int32_t send_count,
+                                              int64_t send_count,
                                               uint8_t *recv_data,
-                                              const std::vector<int32_t> &recv_count,
-                                              const std::vector<int32_t> &displacements,
+                                              const std::vector<int64_t> &recv_count,
+                                              const std::vector<int64_t> &displacements,
                                               int gather_root) {
   CYLON_UNUSED(buf_idx);
   CYLON_UNUSED(displacements);
@@ -123,7 +123,7 @@ void GlooTableBcastImpl::Init(int32_t num_buffers) {
   CYLON_UNUSED(num_buffers);
 }
 
-Status GlooTableBcastImpl::BcastBufferSizes(int32_t *buffer,
+Status GlooTableBcastImpl::BcastBufferSizes(int64_t *buffer,
                                             int32_t count,
                                             int32_t bcast_root) const {
   gloo::BroadcastOptions opts(*ctx_ptr_);
@@ -140,7 +140,7 @@ Status GlooTableBcastImpl::BcastBufferSizes(int32_t *buffer,
 }
 
 Status GlooTableBcastImpl::BcastBufferData(uint8_t *buf_data,
-                                           int32_t count,
+                                           int64_t count,
                                            int32_t bcast_root) const {
   gloo::BroadcastOptions opts(*ctx_ptr_);
 
@@ -157,7 +157,7 @@ Status GlooTableBcastImpl::BcastBufferData(uint8_t *buf_data,
 
 Status GlooTableBcastImpl::IbcastBufferData(int32_t buf_idx,
                                             uint8_t *buf_data,
-                                            int32_t send_count,
+                                            int64_t send_count,
                                             int32_t bcast_root) {
   CYLON_UNUSED(buf_idx);
   return BcastBufferData(buf_data, send_count, bcast_root);
@@ -301,11 +301,11 @@ Status GlooAllReduceImpl::AllReduceBuffer(const void *send_buf, void *rcv_buf, i
   return {Code::NotImplemented, "allreduce not implemented for type"};
 }
 
-Status GlooAllgatherImpl::AllgatherBufferSize(const int32_t *send_data,
+Status GlooAllgatherImpl::AllgatherBufferSize(const int64_t *send_data,
                                               int32_t num_buffers,
-                                              int32_t *rcv_data) const {
+                                              int64_t *rcv_data) const {
   gloo::AllgatherOptions opts(*ctx_ptr_);
-  opts.setInput(const_cast<int32_t *>(send_data), num_buffers);
+  opts.setInput(const_cast<int64_t *>(send_data), num_buffers);
   opts.setOutput(rcv_data, num_buffers * (*ctx_ptr_)->size);
 
   gloo::allgather(opts);
@@ -315,10 +315,10 @@ Status GlooAllgatherImpl::AllgatherBufferSize(const int32_t *send_data,
 
 Status GlooAllgatherImpl::IallgatherBufferData(int32_t buf_idx,
                                                const uint8_t *send_data,
-                                               int32_t send_count,
+                                               int64_t send_count,
                                                uint8_t *recv_data,
-                                               const std::vector<int32_t> &recv_count,
-                                               const std::vector<int32_t> &displacements) {
+                                               const std::vector<int64_t> &recv_count,
+                                               const std::vector<int64_t> &displacements) {
   CYLON_UNUSED(buf_idx);
   CYLON_UNUSED(displacements);
 
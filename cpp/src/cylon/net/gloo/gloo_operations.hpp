@@ -29,17 +29,17 @@ class GlooTableAllgatherImpl : public TableAllgatherImpl {
 
   void Init(int num_buffers) override;
 
-  Status AllgatherBufferSizes(const int32_t *send_data,
+  Status AllgatherBufferSizes(const int64_t *send_data,
                               int num_buffers,
-                              int32_t *rcv_data) const override;
+                              int64_t *rcv_data) const override;
 
   // gloo doesn't have non-blocking collectives. So, do blocking call here!
   Status IallgatherBufferData(int buf_idx,
                               const uint8_t *send_data,
-                              int32_t send_count,
+                              int64_t send_count,
                               uint8_t *recv_data,
-                              const std::vector<int32_t> &recv_count,
-                              const std::vector<int32_t> &displacements) override;
+                              const std::vector<int64_t> &recv_count,
+                              const std::vector<int64_t> &displacements) override;
 
   Status WaitAll(int num_buffers) override;
 
@@ -53,17 +53,17 @@ class GlooTableGatherImpl : public TableGatherImpl {
       : ctx_ptr_(ctx_ptr) {}
 
   void Init(int num_buffers) override;
-  Status GatherBufferSizes(const int32_t *send_data,
+  Status GatherBufferSizes(const int64_t *send_data,
                            int num_buffers,
-                           int32_t *rcv_data,
-                           int gather_root) const override;
+                           int64_t *rcv_data,
+                           int gather_root) override;
 
   Status IgatherBufferData(int buf_idx,
                            const uint8_t *send_data,
-                           int32_t send_count,
+                           int64_t send_count,
                            uint8_t *recv_data,
-                           const std::vector<int32_t> &recv_count,
-                           const std::vector<int32_t> &displacements,
+                           const std::vector<int64_t> &recv_count,
+                           const std::vector<int64_t> &displacements,
                            int gather_root) override;
 
   Status WaitAll(int num_buffers) override;
@@ -79,13 +79,13 @@ class GlooTableBcastImpl : public TableBcastImpl {
 
   void Init(int32_t num_buffers) override;
 
-  Status BcastBufferSizes(int32_t *buffer, int32_t count, int32_t bcast_root) const override;
+  Status BcastBufferSizes(int64_t *buffer, int32_t count, int32_t bcast_root) const override;
 
-  Status BcastBufferData(uint8_t *buf_data, int32_t send_count, int32_t bcast_root) const override;
+  Status BcastBufferData(uint8_t *buf_data, int64_t send_count, int32_t bcast_root) const override;
 
   Status IbcastBufferData(int32_t buf_idx,
                           uint8_t *buf_data,
-                          int32_t send_count,
+                          int64_t send_count,
                           int32_t bcast_root) override;
 
   Status WaitAll(int32_t num_buffers) override;
@@ -111,15 +111,15 @@ class GlooAllgatherImpl : public AllGatherImpl {
   explicit GlooAllgatherImpl(const std::shared_ptr<gloo::Context> *ctx_ptr)
       : ctx_ptr_(ctx_ptr) {}
 
-  Status AllgatherBufferSize(const int32_t *send_data,
+  Status AllgatherBufferSize(const int64_t *send_data,
                              int32_t num_buffers,
-                             int32_t *rcv_data) const override;
+                             int64_t *rcv_data) const override;
   Status IallgatherBufferData(int32_t buf_idx,
                               const uint8_t *send_data,
-                              int32_t send_count,
+                              int64_t send_count,
                               uint8_t *recv_data,
-                              const std::vector<int32_t> &recv_count,
-                              const std::vector<int32_t> &displacements) override;
+                              const std::vector<int64_t> &recv_count,
+                              const std::vector<int64_t> &displacements) override;
   Status WaitAll() override;
 
  private:
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <memory>
 #include <utility>
+#include <algorithm>
 
 #include <cylon/status.hpp>
 #include <cylon/net/mpi/mpi_channel.hpp>
@@ -34,19 +35,26 @@ void MPIChannel::init(int ed, const std::vector<int> &receives, const std::vecto
   rcv_fn = rcv;
   send_comp_fn = send_fn;
   allocator = alloc;
+  if (eager_bytes_ > 0) {
+    // a packet should at least fit the header of a message
+    packetBytes = static_cast<int>(std::max<int64_t>(
+        std::min(eager_bytes_, max_chunk_bytes_),
+        (CYLON_EAGER_RECORD_PREFIX + CYLON_CHANNEL_HEADER_SIZE) * sizeof(int)));
+  }
   // we need to post the length buffers
   for (int source : receives) {
     auto *buf = new PendingReceive();
     buf->receiveId = source;
+    buf->packet.resize(packetBytes);
     pendingReceives.insert(std::make_pair(source, buf));
-    MPI_Irecv(buf->headerBuf, CYLON_CHANNEL_HEADER_SIZE, MPI_INT,
-              source, edge, comm_, &buf->request);
+    receiveHeader(buf);
     // set the flag to true so we can identify later which buffers are posted
     buf->status = RECEIVE_LENGTH_POSTED;
   }
 
   for (int target : sendIds) {
     sends[target] = new PendingSend();
+    sends[target]->packet.resize(packetBytes);
   }
   // get the rank
   MPI_Comm_rank(comm_, &rank);
@@ -80,15 +88,20 @@ void MPIChannel::progressReceives() {
       if (flag) {
         x.second->request = {};
         int count = 0;
+        if (packetBytes > 0) {
+          MPI_Get_count(&status, MPI_BYTE, &count);
+          receivedPacket(x, count);
+          continue;
+        }
         MPI_Get_count(&status, MPI_INT, &count);
         // read the length from the header
-        int length = x.second->headerBuf[0];
-        int finFlag = x.second->headerBuf[1];
+        int64_t length = GetHeaderLength(x.second->headerBuf);
+        int finFlag = x.second->headerBuf[2];
         // check weather we are at the end
         if (finFlag != CYLON_MSG_FIN) {
-          if (count > 8) {
-            LOG(FATAL) << "Un-expected number of bytes expected: 8 or less "
-                       << " received: " << count;
+          if (count > CYLON_CHANNEL_HEADER_SIZE) {
+            LOG(FATAL) << "Un-expected number of bytes expected: " << CYLON_CHANNEL_HEADER_SIZE
+                       << " or less received: " << count;
           }
           // malloc a buffer
           Status stat = allocator->Allocate(length, &x.second->data);
@@ -96,20 +109,23 @@ void MPIChannel::progressReceives() {
             LOG(FATAL) << "Failed to allocate buffer with length " << length;
           }
           x.second->length = length;
-          MPI_Irecv(x.second->data->GetByteBuffer(), length, MPI_BYTE, x.second->receiveId, edge,
-                    comm_, &(x.second->request));
+          x.second->receivedBytes = 0;
+          receiveChunk(x.second);
           x.second->status = RECEIVE_POSTED;
-          // copy the count - 2 to the buffer
+          // copy the user header following the prefix to the buffer
+          const int headerLength = count - CYLON_CHANNEL_HEADER_PREFIX;
           int *header = nullptr;
-          if (count > 2) {
-            header = new int[count - 2];
-            std::memcpy(header, &(x.second->headerBuf[2]), (count - 2) * sizeof(int));
+          if (headerLength > 0) {
+            header = new int[headerLength];
+            std::memcpy(header, &(x.second->headerBuf[CYLON_CHANNEL_HEADER_PREFIX]),
+                        headerLength * sizeof(int));
           }
           // notify the receiver
-          rcv_fn->receivedHeader(x.first, finFlag, header, count - 2);
+          rcv_fn->receivedHeader(x.first, finFlag, header, headerLength);
         } else {
-          if (count != 2) {
-            LOG(FATAL) << "Un-expected number of bytes expected: 2 " << " received: " << count;
+          if (count != CYLON_CHANNEL_HEADER_PREFIX) {
+            LOG(FATAL) << "Un-expected number of bytes expected: " << CYLON_CHANNEL_HEADER_PREFIX
+                       << " received: " << count;
           }
           // we are not expecting to receive any more
           x.second->status = RECEIVED_FIN;
@@ -122,16 +138,19 @@ void MPIChannel::progressReceives() {
       if (flag) {
         int count = 0;
         MPI_Get_count(&status, MPI_BYTE, &count);
-        if (count != x.second->length) {
-          LOG(FATAL) << "Un-expected number of bytes expected:" << x.second->length
+        if (count != x.second->chunkBytes) {
+          LOG(FATAL) << "Un-expected number of bytes expected:" << x.second->chunkBytes
                      << " received: " << count;
         }
 
         x.second->request = {};
-        // clear the array
-        std::fill_n(x.second->headerBuf, CYLON_CHANNEL_HEADER_SIZE, 0);
-        MPI_Irecv(x.second->headerBuf, CYLON_CHANNEL_HEADER_SIZE, MPI_INT,
-                  x.second->receiveId, edge, comm_, &(x.second->request));
+        x.second->receivedBytes += count;
+        // a large message arrives in chunks, post the receive for the next one
+        if (x.second->receivedBytes < x.second->length) {
+          receiveChunk(x.second);
+          continue;
+        }
+        receiveHeader(x.second);
         x.second->status = RECEIVE_LENGTH_POSTED;
         // call the back end
         rcv_fn->receivedData(x.first, x.second->data, x.second->length);
@@ -152,19 +171,30 @@ void MPIChannel::progressSends() {
       MPI_Test(&x.second->request, &flag, &status);
       if (flag) {
         x.second->request = {};
+        if (packetBytes > 0) {
+          packedSendsComplete(x.second);
+          // the packet ends with the header of a large message, if any
+          if (x.second->currentSend == nullptr) {
+            x.second->status = SEND_INIT;
+            sendPacket(x);
+            continue;
+          }
+        } else {
+          // we set to the current send and pop it
+          x.second->currentSend = x.second->pendingData.front();
+          x.second->pendingData.pop();
+        }
         // now post the actual send
-        auto &r = x.second->pendingData.front();
-        MPI_Isend(r->buffer, r->length, MPI_BYTE,
-                  r->target, edge, comm_, &(x.second->request));
+        x.second->sentBytes = 0;
+        sendChunk(x);
         x.second->status = SEND_POSTED;
-        x.second->pendingData.pop();
-        // we set to the current send and pop it
-        x.second->currentSend = r;
       }
     } else if (x.second->status == SEND_INIT) {
       x.second->request = {};
       // now post the actual send
-      if (!x.second->pendingData.empty()) {
+      if (packetBytes > 0) {
+        sendPacket(x);
+      } else if (!x.second->pendingData.empty()) {
         sendHeader(x);
       } else if (finishRequests.find(x.first) != finishRequests.end()) {
         // if there are finish requests lets send them
@@ -174,6 +204,18 @@ void MPIChannel::progressSends() {
       MPI_Test(&(x.second->request), &flag, &status);
       if (flag) {
         x.second->request = {};
+        // a large send is posted in chunks, post the next one
+        if (x.second->sentBytes < x.second->currentSend->length) {
+          sendChunk(x);
+          continue;
+        }
+        if (packetBytes > 0) {
+          send_comp_fn->sendComplete(x.second->currentSend);
+          x.second->currentSend = {};
+          x.second->status = SEND_INIT;
+          sendPacket(x);
+          continue;
+        }
         // if there are more data to post, post the length buffer now
         if (!x.second->pendingData.empty()) {
           sendHeader(x);
@@ -196,6 +238,8 @@ void MPIChannel::progressSends() {
       MPI_Test(&(x.second->request), &flag, &status);
       if (flag) {
         // LOG(INFO) << rank << " FINISHED send " << x.first;
+        // the finish request may be packed after other sends
+        packedSendsComplete(x.second);
         // we are going to send complete
         send_comp_fn->sendFinishComplete(finishRequests[x.first]);
         x.second->status = SEND_DONE;
@@ -210,28 +254,171 @@ void MPIChannel::progressSends() {
 void MPIChannel::sendHeader(const std::pair<const int, PendingSend *> &x) const {
   const auto &r = x.second->pendingData.front();
   // put the length to the buffer
-  x.second->headerBuf[0] = r->length;
-  x.second->headerBuf[1] = 0;
+  SetHeaderLength(x.second->headerBuf, r->length);
+  x.second->headerBuf[2] = CYLON_MSG_NOT_FIN;
 
   // copy the memory of the header
   if (r->headerLength > 0) {
-    memcpy(&(x.second->headerBuf[2]), &(r->header[0]), r->headerLength * sizeof(int));
+    memcpy(&(x.second->headerBuf[CYLON_CHANNEL_HEADER_PREFIX]), &(r->header[0]),
+           r->headerLength * sizeof(int));
   }
-  // we have to add 2 to the header length
-  MPI_Isend(&(x.second->headerBuf[0]), 2 + r->headerLength, MPI_INT,
+  // we have to add the prefix to the header length
+  MPI_Isend(&(x.second->headerBuf[0]), CYLON_CHANNEL_HEADER_PREFIX + r->headerLength, MPI_INT,
             x.first, edge, comm_, &(x.second->request));
   x.second->status = SEND_LENGTH_POSTED;
 }
 
 void MPIChannel::sendFinishHeader(const std::pair<const int, PendingSend *> &x) const {
-  // for the last header we always send only the first 2 integers
-  x.second->headerBuf[0] = 0;
-  x.second->headerBuf[1] = CYLON_MSG_FIN;
-  MPI_Isend(&(x.second->headerBuf[0]), 2, MPI_INT,
+  // for the last header we always send only the prefix
+  SetHeaderLength(x.second->headerBuf, 0);
+  x.second->headerBuf[2] = CYLON_MSG_FIN;
+  MPI_Isend(&(x.second->headerBuf[0]), CYLON_CHANNEL_HEADER_PREFIX, MPI_INT,
             x.first, edge, comm_, &(x.second->request));
   x.second->status = SEND_FINISH;
 }
 
+void MPIChannel::sendChunk(const std::pair<const int, PendingSend *> &x) const {
+  const auto &r = x.second->currentSend;
+  // an empty message is still sent as a single empty chunk
+  const auto bytes = static_cast<int>(std::min(r->length - x.second->sentBytes, max_chunk_bytes_));
+  MPI_Isend(static_cast<const uint8_t *>(r->buffer) + x.second->sentBytes, bytes, MPI_BYTE,
+            r->target, edge, comm_, &(x.second->request));
+  x.second->sentBytes += bytes;
+}
+
+void MPIChannel::receiveChunk(PendingReceive *receive) const {
+  receive->chunkBytes = static_cast<int>(std::min(receive->length - receive->receivedBytes,
+                                                  max_chunk_bytes_));
+  MPI_Irecv(receive->data->GetByteBuffer() + receive->receivedBytes, receive->chunkBytes,
+            MPI_BYTE, receive->receiveId, edge, comm_, &(receive->request));
+}
+
+void MPIChannel::receiveHeader(PendingReceive *receive) const {
+  if (packetBytes > 0) {
+    MPI_Irecv(receive->packet.data(), packetBytes, MPI_BYTE,
+              receive->receiveId, edge, comm_, &(receive->request));
+  } else {
+    // clear the array
+    std::fill_n(receive->headerBuf, CYLON_CHANNEL_HEADER_SIZE, 0);
+    MPI_Irecv(receive->headerBuf, CYLON_CHANNEL_HEADER_SIZE, MPI_INT,
+              receive->receiveId, edge, comm_, &(receive->request));
+  }
+}
+
+void MPIChannel::sendPacket(const std::pair<const int, PendingSend *> &x) {
+  auto *ps = x.second;
+  uint8_t *packet = ps->packet.data();
+  int64_t bytes = 0;
+  int record[CYLON_EAGER_RECORD_PREFIX];
+  while (!ps->pendingData.empty()) {
+    const auto &r = ps->pendingData.front();
+    const int64_t headerBytes = (CYLON_EAGER_RECORD_PREFIX + r->headerLength) * sizeof(int);
+    // a message that fits in a packet goes in the packet, otherwise only its header
+    const bool eager = headerBytes + r->length <= packetBytes;
+    if (bytes + headerBytes + (eager ? r->length : 0) > packetBytes) {
+      break;
+    }
+    SetHeaderLength(record, r->length);
+    record[2] = eager ? CYLON_MSG_EAGER : CYLON_MSG_NOT_FIN;
+    record[3] = r->headerLength;
+    std::memcpy(packet + bytes, record, sizeof(record));
+    if (r->headerLength > 0) {
+      std::memcpy(packet + bytes + sizeof(record), r->header, r->headerLength * sizeof(int));
+    }
+    bytes += headerBytes;
+    if (eager) {
+      if (r->length > 0) {
+        std::memcpy(packet + bytes, r->buffer, r->length);
+      }
+      bytes += r->length;
+      ps->packedSends.push_back(r);
+      ps->pendingData.pop();
+    } else {
+      // the payload follows the packet
+      ps->currentSend = r;
+      ps->pendingData.pop();
+      break;
+    }
+  }
+
+  SendStatus next = SEND_LENGTH_POSTED;
+  if (ps->currentSend == nullptr && ps->pendingData.empty()
+      && finishRequests.find(x.first) != finishRequests.end()
+      && bytes + static_cast<int64_t>(sizeof(record)) <= packetBytes) {
+    SetHeaderLength(record, 0);
+    record[2] = CYLON_MSG_FIN;
+    record[3] = 0;
+    std::memcpy(packet + bytes, record, sizeof(record));
+    bytes += sizeof(record);
+    next = SEND_FINISH;
+  }
+
+  if (bytes > 0) {
+    MPI_Isend(packet, static_cast<int>(bytes), MPI_BYTE, x.first, edge, comm_, &(ps->request));
+    ps->status = next;
+  }
+}
+
+void MPIChannel::receivedPacket(const std::pair<const int, PendingReceive *> &x, int bytes) {
+  auto *pr = x.second;
+  const uint8_t *packet = pr->packet.data();
+  int64_t offset = 0;
+  int record[CYLON_EAGER_RECORD_PREFIX];
+  while (offset < bytes) {
+    std::memcpy(record, packet + offset, sizeof(record));
+    offset += sizeof(record);
+    const int64_t length = GetHeaderLength(record);
+    const int msgFlag = record[2];
+    const int headerLength = record[3];
+
+    if (msgFlag == CYLON_MSG_FIN) {
+      // we are not expecting to receive any more
+      pr->status = RECEIVED_FIN;
+      // notify the receiver
+      rcv_fn->receivedHeader(x.first, CYLON_MSG_FIN, nullptr, 0);
+      return;
+    }
+
+    int *header = nullptr;
+    if (headerLength > 0) {
+      header = new int[headerLength];
+      std::memcpy(header, packet + offset, headerLength * sizeof(int));
+      offset += headerLength * sizeof(int);
+    }
+    // malloc a buffer
+    Status stat = allocator->Allocate(length, &pr->data);
+    if (!stat.is_ok()) {
+      LOG(FATAL) << "Failed to allocate buffer with length " << length;
+    }
+    // notify the receiver
+    rcv_fn->receivedHeader(x.first, CYLON_MSG_NOT_FIN, header, headerLength);
+
+    if (msgFlag == CYLON_MSG_EAGER) {
+      if (length > 0) {
+        std::memcpy(pr->data->GetByteBuffer(), packet + offset, length);
+      }
+      offset += length;
+      rcv_fn->receivedData(x.first, pr->data, length);
+    } else {
+      // the payload follows the packet
+      pr->length = length;
+      pr->receivedBytes = 0;
+      receiveChunk(pr);
+      pr->status = RECEIVE_POSTED;
+      return;
+    }
+  }
+  // all the messages of the packet are received, wait for the next one
+  receiveHeader(pr);
+}
+
+void MPIChannel::packedSendsComplete(PendingSend *send) {
+  for (auto &r : send->packedSends) {
+    send_comp_fn->sendComplete(std::move(r));
+  }
+  send->packedSends.clear();
+}
+
 void MPIChannel::close() {
   for (auto &pendingReceive : pendingReceives) {
     MPI_Cancel(&pendingReceive.second->request);
@@ -18,12 +18,18 @@
 #include <vector>
 #include <unordered_map>
 #include <queue>
+#include <cstdint>
 #include <mpi.h>
 
 #include <cylon/net/channel.hpp>
 #include <cylon/net/buffer.hpp>
 
 namespace cylon {
+// a message packed with its payload, in the eager packets
+#define CYLON_MSG_EAGER 2
+// the header of a message in an eager packet: the 64-bit length, the flag and the header length
+#define CYLON_EAGER_RECORD_PREFIX 4
+
 enum SendStatus {
   SEND_INIT = 0,
   SEND_LENGTH_POSTED = 1,
@@ -43,21 +49,32 @@ enum ReceiveStatus {
  * Keep track about the length buffer to receive the length first
  */
 struct PendingSend {
-  //  we allow upto 8 ints for the header
+  //  we allow upto 6 ints for the user header
   int headerBuf[CYLON_CHANNEL_HEADER_SIZE]{};
   std::queue<std::shared_ptr<CylonRequest>> pendingData;
   SendStatus status = SEND_INIT;
   MPI_Request request{};
   // the current send, if it is a actual send
   std::shared_ptr<CylonRequest> currentSend{};
+  // bytes of the current send posted so far, a large send is posted in chunks
+  int64_t sentBytes{};
+  // the eager packet, and the sends packed into it
+  std::vector<uint8_t> packet{};
+  std::vector<std::shared_ptr<CylonRequest>> packedSends{};
 };
 
 struct PendingReceive {
-  // we allow upto 8 integer header
+  // we allow upto 6 integer user header
   int headerBuf[CYLON_CHANNEL_HEADER_SIZE]{};
   int receiveId{};
   std::shared_ptr<Buffer> data{};
-  int length{};
+  int64_t length{};
+  // bytes received so far, a large message is received in chunks
+  int64_t receivedBytes{};
+  // bytes of the chunk currently posted
+  int chunkBytes{};
+  // the eager packet
+  std::vector<uint8_t> packet{};
   ReceiveStatus status = RECEIVE_INIT;
   MPI_Request request{};
 };
@@ -66,6 +83,11 @@ struct PendingReceive {
  * This class implements a MPI channel, when there is a message to be sent,
  * this channel sends a small message with the size of the next message. This allows the other side
  * to post the network buffer to receive the message
+ *
+ * With eager bytes set, the channel instead sends packets of upto that many bytes. A packet holds
+ * the headers of the pending messages of a target, followed by their payloads if they fit in a
+ * packet. A larger message ends the packet, and its payload is sent after it as before. So a
+ * shuffle of many small buffers takes a few messages per target, instead of two per buffer.
  */
 class MPIChannel : public Channel {
  public:
@@ -126,6 +148,8 @@ class MPIChannel : public Channel {
   // mpi rank
   int rank;
   MPI_Comm comm_;
+  // size of the eager packets, 0 if disabled
+  int packetBytes = 0;
 
   /**
    * Send finish request
@@ -138,6 +162,43 @@ class MPIChannel : public Channel {
    * @param x the target, pendingSend pair
    */
   void sendHeader(const std::pair<const int, PendingSend *> &x) const;
+
+  /**
+   * Post the next chunk of the current send
+   * @param x the target, pendingSend pair
+   */
+  void sendChunk(const std::pair<const int, PendingSend *> &x) const;
+
+  /**
+   * Post the receive for the next chunk of the message
+   * @param receive the pending receive
+   */
+  void receiveChunk(PendingReceive *receive) const;
+
+  /**
+   * Post the receive for the next header, or packet
+   * @param receive the pending receive
+   */
+  void receiveHeader(PendingReceive *receive) const;
+
+  /**
+   * Pack the pending messages and the finish request of a target into a packet, and send it
+   * @param x the target, pendingSend pair
+   */
+  void sendPacket(const std::pair<const int, PendingSend *> &x);
+
+  /**
+   * Unpack a received packet, and notify the receiver of the messages in it
+   * @param x the source, pendingReceive pair
+   * @param bytes the size of the packet
+   */
+  void receivedPacket(const std::pair<const int, PendingReceive *> &x, int bytes);
+
+  /**
+   * Notify the completion of the sends packed in a packet
+   * @param send
+   */
+  void packedSendsComplete(PendingSend *send);
 };
 }
 
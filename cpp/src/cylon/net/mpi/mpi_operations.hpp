@@ -15,6 +15,7 @@
 #ifndef CYLON_CPP_SRC_CYLON_NET_MPI_MPI_OPERATIONS_HPP_
 #define CYLON_CPP_SRC_CYLON_NET_MPI_MPI_OPERATIONS_HPP_
 
+#include <limits>
 #include <memory>
 #include <arrow/buffer.h>
 
@@ -34,6 +35,11 @@ MPI_Op GetMPIOp(cylon::net::ReduceOp reduce_op);
 
 MPI_Datatype GetMPIDataType(const std::shared_ptr<DataType> &data_type);
 
+/**
+ * MPI counts are int. Larger buffers are moved in pieces of upto this many bytes
+ */
+constexpr int64_t kMaxMpiCount = std::numeric_limits<int>::max();
+
 class MpiAllReduceImpl : public net::AllReduceImpl {
  public:
   explicit MpiAllReduceImpl(const MPI_Comm &comm);
@@ -73,17 +79,17 @@ class MpiTableGatherImpl : public net::TableGatherImpl {
                                                statuses_({}) {}
   void Init(int num_buffers) override;
 
-  Status GatherBufferSizes(const int32_t *send_data,
+  Status GatherBufferSizes(const int64_t *send_data,
                            int num_buffers,
-                           int32_t *rcv_data,
-                           int gather_root) const override;
+                           int64_t *rcv_data,
+                           int gather_root) override;
 
   Status IgatherBufferData(int buf_idx,
                            const uint8_t *send_data,
-                           int32_t send_count,
+                           int64_t send_count,
                            uint8_t *recv_data,
-                           const std::vector<int32_t> &recv_count,
-                           const std::vector<int32_t> &displacements,
+                           const std::vector<int64_t> &recv_count,
+                           const std::vector<int64_t> &displacements,
                            int gather_root) override;
 
   Status WaitAll(int num_buffers) override;
@@ -92,6 +98,12 @@ class MpiTableGatherImpl : public net::TableGatherImpl {
   MPI_Comm comm_;
   std::vector<MPI_Request> requests_;
   std::vector<MPI_Status> statuses_;
+  // int counts and displacements of the pending gathers
+  std::vector<std::vector<int>> recv_counts_;
+  std::vector<std::vector<int>> displacements_;
+  // buffer sizes of all the ranks, at every rank, to agree on gathering a buffer in pieces
+  std::vector<int64_t> all_buffer_sizes_;
+  int num_buffers_ = 0;
 };
 
 /**
@@ -110,9 +122,9 @@ cylon::Status Gather(const std::shared_ptr<cylon::TableSerializer>& serializer,
                      int gather_root,
                      bool gather_from_root,
                      const std::shared_ptr<cylon::Allocator>& allocator,
-                     std::vector<int32_t> & all_buffer_sizes,
+                     std::vector<int64_t> & all_buffer_sizes,
                      std::vector<std::shared_ptr<cylon::Buffer>> & received_buffers,
-                     std::vector<std::vector<int32_t>> & displacements,
+                     std::vector<std::vector<int64_t>> & displacements,
                      const std::shared_ptr<cylon::CylonContext> &ctx
 );
 
@@ -137,16 +149,16 @@ class MpiTableAllgatherImpl : public net::TableAllgatherImpl {
 
   void Init(int num_buffers) override;
 
-  Status AllgatherBufferSizes(const int32_t *send_data,
+  Status AllgatherBufferSizes(const int64_t *send_data,
                               int num_buffers,
-                              int32_t *rcv_data) const override;
+                              int64_t *rcv_data) const override;
 
   Status IallgatherBufferData(int buf_idx,
                               const uint8_t *send_data,
-                              int32_t send_count,
+                              int64_t send_count,
                               uint8_t *recv_data,
-                              const std::vector<int32_t> &recv_count,
-                              const std::vector<int32_t> &displacements) override;
+                              const std::vector<int64_t> &recv_count,
+                              const std::vector<int64_t> &displacements) override;
 
   Status WaitAll(int num_buffers) override;
 
@@ -154,6 +166,9 @@ class MpiTableAllgatherImpl : public net::TableAllgatherImpl {
   MPI_Comm comm_;
   std::vector<MPI_Request> requests_;
   std::vector<MPI_Status> statuses_;
+  // int counts and displacements of the pending allgathers
+  std::vector<std::vector<int>> recv_counts_;
+  std::vector<std::vector<int>> displacements_;
 };
 
 /**
@@ -170,9 +185,9 @@ class MpiTableAllgatherImpl : public net::TableAllgatherImpl {
  */
 cylon::Status AllGather(const std::shared_ptr<cylon::TableSerializer> &serializer,
                         const std::shared_ptr<cylon::Allocator> &allocator,
-                        std::vector<int32_t> &all_buffer_sizes,
+                        std::vector<int64_t> &all_buffer_sizes,
                         std::vector<std::shared_ptr<cylon::Buffer>> &received_buffers,
-                        std::vector<std::vector<int32_t>> &displacements,
+                        std::vector<std::vector<int64_t>> &displacements,
                         const std::shared_ptr<cylon::CylonContext> &ctx
 );
 
@@ -195,13 +210,13 @@ class MpiTableBcastImpl : public net::TableBcastImpl {
 
   void Init(int32_t num_buffers) override;
 
-  Status BcastBufferSizes(int32_t *buffer, int32_t count, int32_t bcast_root) const override;
+  Status BcastBufferSizes(int64_t *buffer, int32_t count, int32_t bcast_root) const override;
 
-  Status BcastBufferData(uint8_t *buf_data, int32_t send_count, int32_t bcast_root) const override;
+  Status BcastBufferData(uint8_t *buf_data, int64_t send_count, int32_t bcast_root) const override;
 
   Status IbcastBufferData(int32_t buf_idx,
                           uint8_t *buf_data,
-                          int32_t send_count,
+                          int64_t send_count,
                           int32_t bcast_root) override;
 
   Status WaitAll(int32_t num_buffers) override;
@@ -278,16 +293,16 @@ class MpiAllgatherImpl : public net::AllGatherImpl {
  public:
   explicit MpiAllgatherImpl(MPI_Comm comm);
 
-  Status AllgatherBufferSize(const int32_t *send_data,
+  Status AllgatherBufferSize(const int64_t *send_data,
                              int32_t num_buffers,
-                             int32_t *rcv_data) const override;
+                             int64_t *rcv_data) const override;
 
   Status IallgatherBufferData(int32_t buf_idx,
                               const uint8_t *send_data,
-                              int32_t send_count,
+                              int64_t send_count,
                               uint8_t *recv_data,
-                              const std::vector<int32_t> &recv_count,
-                              const std::vector<int32_t> &displacements) override;
+                              const std::vector<int64_t> &recv_count,
+                              const std::vector<int64_t> &displacements) override;
 
   Status WaitAll() override;
 
@@ -295,6 +310,8 @@ class MpiAllgatherImpl : public net::AllGatherImpl {
   MPI_Comm comm_;
   std::array<MPI_Request, 3> requests_;
   std::array<MPI_Status, 3> statuses_;
+  std::array<std::vector<int>, 3> recv_counts_;
+  std::array<std::vector<int>, 3> displacements_;
 };
 
 }
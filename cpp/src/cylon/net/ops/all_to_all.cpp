@@ -17,6 +17,7 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <string>
 
 #include <cylon/net/buffer.hpp>
 #include <cylon/net/ops/all_to_all.hpp>
@@ -31,6 +32,14 @@ AllToAll::AllToAll(const std::shared_ptr<cylon::CylonContext> &ctx, const std::v
   targets = tgts;
   edge = edge_id;
   channel = ctx->GetCommunicator()->CreateChannel();
+  const auto &chunk_bytes = ctx->GetConfig(kChannelMaxChunkBytesConfig);
+  if (!chunk_bytes.empty()) {
+    channel->SetMaxChunkBytes(std::stoll(chunk_bytes));
+  }
+  const auto &eager_bytes = ctx->GetConfig(kChannelEagerBytesConfig);
+  if (!eager_bytes.empty()) {
+    channel->SetEagerBytes(std::stoll(eager_bytes));
+  }
   channel->init(edge_id, srcs, tgts, this, this, alloc);
   callback = rcvCallback;
 
@@ -60,7 +69,7 @@ void AllToAll::close() {
   channel->close();
 }
 
-int AllToAll::insert(const void *buffer, int length, int target) {
+int AllToAll::insert(const void *buffer, int64_t length, int target) {
   if (finishFlag) {
     // we cannot accept further
     return -1;
@@ -74,7 +83,7 @@ int AllToAll::insert(const void *buffer, int length, int target) {
   return 1;
 }
 
-int AllToAll::insert(const void *buffer, int length, int target, int *header, int headerLength) {
+int AllToAll::insert(const void *buffer, int64_t length, int target, int *header, int headerLength) {
   if (finishFlag) {
     // we cannot accept further
     return -1;
@@ -128,19 +137,25 @@ bool AllToAll::isComplete() {
   }
   // progress the sends
   channel->progressSends();
-  // progress the receives
-  channel->progressReceives();
+  // progress the receives, unless the receiver applies backpressure
+  if (!receivesPaused) {
+    channel->progressReceives();
+  }
 
   return allQueuesEmpty && finishedTargets.size() == targets.size() &&
       finishedSources.size() == sources.size();
 }
 
+void AllToAll::pauseReceives(bool pause) {
+  receivesPaused = pause;
+}
+
 void AllToAll::finish() {
   // here we just set the finish flag to true, the is_complete method will use this flag
   finishFlag = true;
 }
 
-void AllToAll::receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int length) {
+void AllToAll::receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int64_t length) {
   // we just call the callback function of this
   callback->onReceive(receiveId, std::move(buffer), length);
 }
@@ -35,7 +35,7 @@ class ReceiveCallback {
    * @param length the length of the buffer
    * @return true if we accept this buffer
    */
-  virtual bool onReceive(int source, std::shared_ptr<Buffer> buffer, int length) = 0;
+  virtual bool onReceive(int source, std::shared_ptr<Buffer> buffer, int64_t length) = 0;
 
   /**
    * Receive the header, this happens before we receive the actual data
@@ -53,7 +53,7 @@ class ReceiveCallback {
    * @param length
    * @return
    */
-  virtual bool onSendComplete(int target, const void *buffer, int length) = 0;
+  virtual bool onSendComplete(int target, const void *buffer, int64_t length) = 0;
 };
 
 enum AllToAllSendStatus {
@@ -62,11 +62,23 @@ enum AllToAllSendStatus {
   ALL_TO_ALL_FINISHED
 };
 
+/**
+ * Context config for the size of the chunks large messages are sent in, defaults to
+ * kChannelMaxChunkBytes
+ */
+constexpr const char *kChannelMaxChunkBytesConfig = "channel_max_chunk_bytes";
+
+/**
+ * Context config for the size of the packets small messages are coalesced into (with their
+ * headers), by the channels that support it. Disabled by default.
+ */
+constexpr const char *kChannelEagerBytesConfig = "channel_eager_bytes";
+
 struct AllToAllSends {
   int target;
   std::queue<std::shared_ptr<CylonRequest>> requestQueue;
   std::queue<std::shared_ptr<CylonRequest>> pendingQueue;
-  int messageSizes{};
+  int64_t messageSizes{};
   AllToAllSendStatus sendStatus = ALL_TO_ALL_SENDING;
 
   AllToAllSends(int target) : target(target) {}
@@ -100,7 +112,7 @@ class AllToAll : public ChannelReceiveCallback, ChannelSendCallback {
    * @param target the target to send the message
    * @return true if the buffer is accepted
    */
-  int insert(const void *buffer, int length, int target, int *header, int headerLength);
+  int insert(const void *buffer, int64_t length, int target, int *header, int headerLength);
 
   /**
    * Insert a buffer to be sent, if the buffer is accepted return true
@@ -110,7 +122,7 @@ class AllToAll : public ChannelReceiveCallback, ChannelSendCallback {
    * @param target the target to send the message
    * @return true if the buffer is accepted
    */
-  int insert(const void *buffer, int length, int target);
+  int insert(const void *buffer, int64_t length, int target);
 
   /**
    * Check weather the operation is complete, this method needs to be called until the operation is complete
@@ -124,13 +136,20 @@ class AllToAll : public ChannelReceiveCallback, ChannelSendCallback {
    */
   void finish();
 
+  /**
+   * Backpressure: while paused, isComplete progresses the sends but not the receives, so that the
+   * sources hold back until the receiver has capacity again
+   * @param pause
+   */
+  void pauseReceives(bool pause);
+
   /**
    * We implement the receive complete callback from channel
    * @param receiveId
    * @param buffer
    * @param length
    */
-  void receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int length) override;
+  void receivedData(int receiveId, std::shared_ptr<Buffer> buffer, int64_t length) override;
 
   /**
    * We implement the send callback from channel
@@ -163,6 +182,7 @@ class AllToAll : public ChannelReceiveCallback, ChannelSendCallback {
   std::unordered_set<int> finishedSources;  // keep track of  the finished sources
   std::unordered_set<int> finishedTargets;  // keep track of  the finished targets
   bool finishFlag = false;
+  bool receivesPaused = false;
   std::unique_ptr<Channel> channel;             // the underlying channel
   ReceiveCallback *callback;    // after we receive a buffer we will call this function
   unsigned long thisNumTargets;            // number of targets in this process, 1 or 0
@@ -29,9 +29,9 @@ namespace net {
 Status TableAllgatherImpl::Execute(const std::shared_ptr<TableSerializer> &serializer,
                                    const std::shared_ptr<cylon::Allocator> &allocator,
                                    int world_size,
-                                   std::vector<int32_t> *all_buffer_sizes,
+                                   std::vector<int64_t> *all_buffer_sizes,
                                    std::vector<std::shared_ptr<Buffer>> *received_buffers,
-                                   std::vector<std::vector<int32_t>> *displacements) {
+                                   std::vector<std::vector<int64_t>> *displacements) {
   int num_buffers = serializer->getNumberOfBuffers();
 
   // initialize the impl
@@ -77,16 +77,15 @@ Status TableAllgatherImpl::Execute(const std::shared_ptr<Table> &table,
   std::shared_ptr<TableSerializer> serializer;
   RETURN_CYLON_STATUS_IF_FAILED(CylonTableSerializer::Make(table, &serializer));
   const auto &ctx = table->GetContext();
-  auto *pool = ToArrowPool(ctx);
 
-  const auto &allocator = std::make_shared<ArrowAllocator>(pool);
+  const auto &allocator = std::make_shared<PooledArrowAllocator>(ctx->GetBufferPool());
   std::vector<std::shared_ptr<Buffer>> receive_buffers;
 
-  std::vector<int32_t> buffer_sizes_per_table;
+  std::vector<int64_t> buffer_sizes_per_table;
   //  |b_0, ..., b_n-1|...|b_0, ..., b_n-1|
   //   <--- tbl_0 --->     <--- tbl_m --->
 
-  std::vector<std::vector<int32_t>> all_disps;
+  std::vector<std::vector<int64_t>> all_disps;
   //  |t_0, ..., t_m-1|...|t_0, ..., t_m-1|
   //   <--- buf_0 --->     <--- buf_n --->
 
@@ -112,9 +111,9 @@ Status TableGatherImpl::Execute(const std::shared_ptr<cylon::TableSerializer> &s
                                 int world_size,
                                 int gather_root,
                                 bool gather_from_root,
-                                std::vector<int32_t> *all_buffer_sizes,
+                                std::vector<int64_t> *all_buffer_sizes,
                                 std::vector<std::shared_ptr<cylon::Buffer>> *received_buffers,
-                                std::vector<std::vector<int32_t>> *displacements) {
+                                std::vector<std::vector<int64_t>> *displacements) {
   int num_buffers = serializer->getNumberOfBuffers();
 
   // init comp
@@ -122,7 +121,7 @@ Status TableGatherImpl::Execute(const std::shared_ptr<cylon::TableSerializer> &s
 
   bool is_root = gather_root == rank;
   // first gather table buffer sizes
-  std::vector<int32_t> local_buffer_sizes;
+  std::vector<int64_t> local_buffer_sizes;
   if (is_root && !gather_from_root) {
     local_buffer_sizes = serializer->getEmptyTableBufferSizes();
   } else {
@@ -137,7 +136,7 @@ Status TableGatherImpl::Execute(const std::shared_ptr<cylon::TableSerializer> &s
   RETURN_CYLON_STATUS_IF_FAILED(GatherBufferSizes(local_buffer_sizes.data(), num_buffers,
                                                   all_buffer_sizes->data(), gather_root));
 
-  std::vector<int32_t> total_buffer_sizes;
+  std::vector<int64_t> total_buffer_sizes;
   if (is_root) {
     total_buffer_sizes = totalBufferSizes(*all_buffer_sizes, num_buffers, world_size);
   }
@@ -185,16 +184,15 @@ Status TableGatherImpl::Execute(const std::shared_ptr<Table> &table,
   std::shared_ptr<TableSerializer> serializer;
   RETURN_CYLON_STATUS_IF_FAILED(CylonTableSerializer::Make(table, &serializer));
   const auto &ctx = table->GetContext();
-  auto *pool = ToArrowPool(ctx);
 
-  const auto &allocator = std::make_shared<ArrowAllocator>(pool);
+  const auto &allocator = std::make_shared<PooledArrowAllocator>(ctx->GetBufferPool());
   std::vector<std::shared_ptr<Buffer>> receive_buffers;
 
-  std::vector<int32_t> buffer_sizes_per_table;
+  std::vector<int64_t> buffer_sizes_per_table;
   //  |b_0, ..., b_n-1|...|b_0, ..., b_n-1|
   //   <--- tbl_0 --->     <--- tbl_m --->
 
-  std::vector<std::vector<int32_t>> all_disps;
+  std::vector<std::vector<int64_t>> all_disps;
   //  |t_0, ..., t_m-1|...|t_0, ..., t_m-1|
   //   <--- buf_0 --->     <--- buf_n --->
 
@@ -220,7 +218,7 @@ Status TableBcastImpl::Execute(const std::shared_ptr<TableSerializer> &serialize
                                std::vector<int32_t> *data_types) {
   bool is_root = rank == bcast_root;
   // first broadcast the number of buffers
-  int32_t num_buffers = 0;
+  int64_t num_buffers = 0;
   if (is_root) {
     num_buffers = serializer->getNumberOfBuffers();
   }
@@ -230,18 +228,22 @@ Status TableBcastImpl::Execute(const std::shared_ptr<TableSerializer> &serialize
   Init(num_buffers);
 
   // broadcast buffer sizes
-  std::vector<int32_t> buffer_sizes = is_root ? serializer->getBufferSizes()
-                                              : std::vector<int32_t>(num_buffers, 0);
+  std::vector<int64_t> buffer_sizes = is_root ? serializer->getBufferSizes()
+                                              : std::vector<int64_t>(num_buffers, 0);
   RETURN_CYLON_STATUS_IF_FAILED(BcastBufferSizes(buffer_sizes.data(), num_buffers, bcast_root));
 
   // broadcast data types
-  *data_types = is_root ? serializer->getDataTypes() : std::vector<int32_t>(num_buffers / 3, 0);
-  RETURN_CYLON_STATUS_IF_FAILED(BcastBufferSizes(data_types->data(), data_types->size(),
-                                                 bcast_root));
+  std::vector<int64_t> types(num_buffers / 3, 0);
+  if (is_root) {
+    const auto &root_types = serializer->getDataTypes();
+    std::copy(root_types.begin(), root_types.end(), types.begin());
+  }
+  RETURN_CYLON_STATUS_IF_FAILED(BcastBufferSizes(types.data(), types.size(), bcast_root));
+  data_types->assign(types.begin(), types.end());
 
   // if all buffer sizes are zero, there are zero rows in the table
   // no need to broadcast any buffers
-  if (std::all_of(buffer_sizes.begin(), buffer_sizes.end(), [](int32_t i) { return i == 0; })) {
+  if (std::all_of(buffer_sizes.begin(), buffer_sizes.end(), [](int64_t i) { return i == 0; })) {
     return cylon::Status::OK();
   }
 
@@ -275,7 +277,7 @@ Status BcastArrowSchema(TableBcastImpl &impl, std::shared_ptr<arrow::Schema> *sc
   }
 
   // bcast buffer size
-  int32_t buf_size = is_root ? (int32_t) buf->size() : 0;
+  int64_t buf_size = is_root ? buf->size() : 0;
   RETURN_CYLON_STATUS_IF_FAILED(impl.BcastBufferSizes(&buf_size, 1, bcast_root));
 
   if (!is_root) { // if not root, allocate a buffer for incoming data
@@ -312,7 +314,7 @@ Status TableBcastImpl::Execute(std::shared_ptr<Table> *table, int bcast_root,
   if (is_root) {
     RETURN_CYLON_STATUS_IF_FAILED(CylonTableSerializer::Make(*table, &serializer));
   }
-  const auto &allocator = std::make_shared<ArrowAllocator>(pool);
+  const auto &allocator = std::make_shared<PooledArrowAllocator>(ctx->GetBufferPool());
   std::vector<std::shared_ptr<Buffer>> receive_buffers;
   std::vector<int32_t> data_types;
 
@@ -393,7 +395,7 @@ Status AllReduceImpl::Execute(const std::shared_ptr<Scalar> &value,
   return Status::OK();
 }
 
-void prefix_sum(const std::vector<int32_t> &buff_sizes, std::vector<int32_t> *out) {
+void prefix_sum(const std::vector<int64_t> &buff_sizes, std::vector<int64_t> *out) {
   std::partial_sum(buff_sizes.begin(), buff_sizes.end() - 1, out->begin() + 1);
 }
 
@@ -415,10 +417,10 @@ Status AllGatherImpl::Execute(const std::shared_ptr<Column> &values,
 
   // |b_0, b_1, b_2|...|b_0, b_1, b_2|
   // <----col@0---->   <---col@n-1--->
-  std::vector<int32_t> all_buf_sizes(world_size * 3);
+  std::vector<int64_t> all_buf_sizes(world_size * 3);
   RETURN_CYLON_STATUS_IF_FAILED(AllgatherBufferSize(buf_sizes.data(), 3, all_buf_sizes.data()));
 
-  std::array<int32_t, 3> total_buf_sizes{};
+  std::array<int64_t, 3> total_buf_sizes{};
   for (int i = 0; i < world_size; i++) {
     total_buf_sizes[0] += all_buf_sizes[3 * i];
     total_buf_sizes[1] += all_buf_sizes[3 * i + 1];
@@ -427,7 +429,7 @@ Status AllGatherImpl::Execute(const std::shared_ptr<Column> &values,
 
   ArrowAllocator allocator(ToArrowPool(pool));
 
-  std::array<std::vector<int32_t>, 3> displacements{};
+  std::array<std::vector<int64_t>, 3> displacements{};
   std::array<std::shared_ptr<Buffer>, 3> received_bufs{};
   for (int i = 0; i < 3; i++) {
     RETURN_CYLON_STATUS_IF_FAILED(allocator.Allocate(total_buf_sizes[i], &received_bufs[i]));
@@ -443,13 +445,13 @@ Status AllGatherImpl::Execute(const std::shared_ptr<Column> &values,
                                                        receive_counts,
                                                        displacements[i]));
   }
-  WaitAll();
+  RETURN_CYLON_STATUS_IF_FAILED(WaitAll());
 
   output->resize(world_size);
   for (int i = 0; i < world_size; i++) {
-    std::array<int32_t, 3> sizes{all_buf_sizes[3 * i], all_buf_sizes[3 * i + 1],
+    std::array<int64_t, 3> sizes{all_buf_sizes[3 * i], all_buf_sizes[3 * i + 1],
                                  all_buf_sizes[3 * i + 2]};
-    std::array<int32_t, 3> offsets{displacements[0][i], displacements[1][i], displacements[2][i]};
+    std::array<int64_t, 3> offsets{displacements[0][i], displacements[1][i], displacements[2][i]};
     RETURN_CYLON_STATUS_IF_FAILED(DeserializeColumn(type,
                                                     received_bufs,
                                                     sizes,
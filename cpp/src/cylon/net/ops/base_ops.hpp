@@ -29,31 +29,36 @@ class Scalar;
 
 namespace net {
 
+/*
+ * Buffer sizes, counts and displacements of the collectives are in bytes and can exceed 2GB.
+ * Implementations over a backend that counts in int (MPI) move larger buffers in pieces.
+ */
+
 class TableAllgatherImpl {
  public:
   virtual ~TableAllgatherImpl() = default;
 
   virtual void Init(int32_t num_buffers) = 0;
 
-  virtual Status AllgatherBufferSizes(const int32_t *send_data,
+  virtual Status AllgatherBufferSizes(const int64_t *send_data,
                                       int32_t num_buffers,
-                                      int32_t *rcv_data) const = 0;
+                                      int64_t *rcv_data) const = 0;
 
   virtual Status IallgatherBufferData(int32_t buf_idx,
                                       const uint8_t *send_data,
-                                      int32_t send_count,
+                                      int64_t send_count,
                                       uint8_t *recv_data,
-                                      const std::vector<int32_t> &recv_count,
-                                      const std::vector<int32_t> &displacements) = 0;
+                                      const std::vector<int64_t> &recv_count,
+                                      const std::vector<int64_t> &displacements) = 0;
 
   virtual Status WaitAll(int32_t num_buffers) = 0;
 
   Status Execute(const std::shared_ptr<TableSerializer> &serializer,
                  const std::shared_ptr<cylon::Allocator> &allocator,
                  int32_t world_size,
-                 std::vector<int32_t> *all_buffer_sizes,
+                 std::vector<int64_t> *all_buffer_sizes,
                  std::vector<std::shared_ptr<Buffer>> *received_buffers,
-                 std::vector<std::vector<int32_t>> *displacements);
+                 std::vector<std::vector<int64_t>> *displacements);
 
   Status Execute(const std::shared_ptr<Table> &table,
                  std::vector<std::shared_ptr<Table>> *out);
@@ -65,17 +70,17 @@ class TableGatherImpl {
 
   virtual void Init(int32_t num_buffers) = 0;
 
-  virtual Status GatherBufferSizes(const int32_t *send_data,
+  virtual Status GatherBufferSizes(const int64_t *send_data,
                                    int32_t num_buffers,
-                                   int32_t *rcv_data,
-                                   int32_t gather_root) const = 0;
+                                   int64_t *rcv_data,
+                                   int32_t gather_root) = 0;
 
   virtual Status IgatherBufferData(int32_t buf_idx,
                                    const uint8_t *send_data,
-                                   int32_t send_count,
+                                   int64_t send_count,
                                    uint8_t *recv_data,
-                                   const std::vector<int32_t> &recv_count,
-                                   const std::vector<int32_t> &displacements,
+                                   const std::vector<int64_t> &recv_count,
+                                   const std::vector<int64_t> &displacements,
                                    int32_t gather_root) = 0;
 
   virtual Status WaitAll(int32_t num_buffers) = 0;
@@ -86,9 +91,9 @@ class TableGatherImpl {
                  int32_t world_size,
                  int32_t gather_root,
                  bool gather_from_root,
-                 std::vector<int32_t> *all_buffer_sizes,
+                 std::vector<int64_t> *all_buffer_sizes,
                  std::vector<std::shared_ptr<Buffer>> *received_buffers,
-                 std::vector<std::vector<int32_t>> *displacements);
+                 std::vector<std::vector<int64_t>> *displacements);
 
   Status Execute(const std::shared_ptr<Table> &table,
                  int32_t gather_root,
@@ -102,17 +107,17 @@ class TableBcastImpl {
 
   virtual void Init(int32_t num_buffers) = 0;
 
-  virtual Status BcastBufferSizes(int32_t *buffer,
+  virtual Status BcastBufferSizes(int64_t *buffer,
                                   int32_t count,
                                   int32_t bcast_root) const = 0;
 
   virtual Status BcastBufferData(uint8_t *buf_data,
-                                 int32_t send_count,
+                                 int64_t send_count,
                                  int32_t bcast_root) const = 0;
 
   virtual Status IbcastBufferData(int32_t buf_idx,
                                   uint8_t *buf_data,
-                                  int32_t send_count,
+                                  int64_t send_count,
                                   int32_t bcast_root) = 0;
 
   virtual Status WaitAll(int32_t num_buffers) = 0;
@@ -150,16 +155,16 @@ class AllGatherImpl {
  public:
   virtual ~AllGatherImpl() = default;
 
-  virtual Status AllgatherBufferSize(const int32_t *send_data,
+  virtual Status AllgatherBufferSize(const int64_t *send_data,
                                      int32_t num_buffers,
-                                     int32_t *rcv_data) const = 0;
+                                     int64_t *rcv_data) const = 0;
 
   virtual Status IallgatherBufferData(int32_t buf_idx,
                                       const uint8_t *send_data,
-                                      int32_t send_count,
+                                      int64_t send_count,
                                       uint8_t *recv_data,
-                                      const std::vector<int32_t> &recv_count,
-                                      const std::vector<int32_t> &displacements) = 0;
+                                      const std::vector<int64_t> &recv_count,
+                                      const std::vector<int64_t> &displacements) = 0;
 
   virtual Status WaitAll() = 0;
 
@@ -12,6 +12,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <algorithm>
 #include <arrow/result.h>
 #include <cylon/net/mpi/mpi_operations.hpp>
 #include <cylon/util/macros.hpp>
@@ -19,34 +20,42 @@
 cylon::mpi::MpiTableBcastImpl::MpiTableBcastImpl(MPI_Comm comm) : comm_(comm) {}
 
 void cylon::mpi::MpiTableBcastImpl::Init(int32_t num_buffers) {
-  requests_.resize(num_buffers);
+  // buffers broadcast in pieces complete without a request
+  requests_.assign(num_buffers, MPI_REQUEST_NULL);
   statuses_.resize(num_buffers);
 }
 
-cylon::Status cylon::mpi::MpiTableBcastImpl::BcastBufferSizes(int32_t *buffer,
+cylon::Status cylon::mpi::MpiTableBcastImpl::BcastBufferSizes(int64_t *buffer,
                                                               int32_t count,
                                                               int32_t bcast_root) const {
-  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Bcast(buffer, count, MPI_INT32_T, bcast_root, comm_));
+  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Bcast(buffer, count, MPI_INT64_T, bcast_root, comm_));
   return Status::OK();
 }
 
 cylon::Status cylon::mpi::MpiTableBcastImpl::BcastBufferData(uint8_t *buf_data,
-                                                             int32_t send_count,
+                                                             int64_t send_count,
                                                              int32_t bcast_root) const {
-  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Bcast(buf_data,
-                                              send_count,
-                                              MPI_UINT8_T,
-                                              bcast_root,
-                                              comm_));
+  // buffers larger than the int count are broadcast in pieces
+  for (int64_t offset = 0; offset < send_count; offset += kMaxMpiCount) {
+    RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Bcast(buf_data + offset,
+                                                static_cast<int>(std::min(kMaxMpiCount,
+                                                                          send_count - offset)),
+                                                MPI_UINT8_T,
+                                                bcast_root,
+                                                comm_));
+  }
   return Status::OK();
 }
 
 cylon::Status cylon::mpi::MpiTableBcastImpl::IbcastBufferData(int32_t buf_idx,
                                                               uint8_t *buf_data,
-                                                              int32_t send_count,
+                                                              int64_t send_count,
                                                               int32_t bcast_root) {
+  if (send_count > kMaxMpiCount) {
+    return BcastBufferData(buf_data, send_count, bcast_root);
+  }
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Ibcast(buf_data,
-                                               send_count,
+                                               static_cast<int>(send_count),
                                                MPI_UINT8_T,
                                                bcast_root,
                                                comm_,
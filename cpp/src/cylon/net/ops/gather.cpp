@@ -13,6 +13,8 @@
  */
 
 #include <mpi.h>
+#include <algorithm>
+#include <cstring>
 #include <numeric>
 #include <arrow/result.h>
 
@@ -25,34 +27,109 @@
 namespace cylon {
 namespace mpi {
 
-Status MpiTableGatherImpl::GatherBufferSizes(const int32_t *send_data,
+namespace {
+
+/**
+ * whether a buffer of these counts per rank can be received with int counts and displacements
+ */
+bool FitsMpiCounts(const std::vector<int64_t> &counts) {
+  return std::accumulate(counts.begin(), counts.end(), int64_t{0}) <= kMaxMpiCount;
+}
+
+/**
+ * Gathers a buffer too large for int counts in rounds. In each round, every rank sends the next
+ * piece of upto kMaxMpiCount / world_size bytes of its buffer. The pieces are received to a
+ * staging buffer and copied to their displacements in recv_data, if recv_data is not null.
+ * gatherv(send_data, send_count, staging, counts, displacements) runs a round.
+ */
+template<typename Gatherv>
+Status GatherInPieces(const uint8_t *send_data, int64_t send_count, uint8_t *recv_data,
+                      const std::vector<int64_t> &counts,
+                      const std::vector<int64_t> &displacements,
+                      Gatherv &&gatherv) {
+  const int world_size = static_cast<int>(counts.size());
+  const int64_t piece_size = kMaxMpiCount / world_size;
+  const int64_t max_count = *std::max_element(counts.begin(), counts.end());
+
+  std::unique_ptr<uint8_t[]> staging;
+  if (recv_data != nullptr) {
+    staging.reset(new uint8_t[std::min(max_count, piece_size) * world_size]);
+  }
+  std::vector<int> piece_counts(world_size, 0), piece_displacements(world_size, 0);
+  for (int64_t offset = 0; offset < max_count; offset += piece_size) {
+    for (int i = 0; i < world_size; i++) {
+      piece_counts[i] =
+          static_cast<int>(std::max<int64_t>(0, std::min(piece_size, counts[i] - offset)));
+    }
+    std::partial_sum(piece_counts.begin(), piece_counts.end() - 1,
+                     piece_displacements.begin() + 1);
+
+    const auto send_piece =
+        static_cast<int>(std::max<int64_t>(0, std::min(piece_size, send_count - offset)));
+    RETURN_CYLON_STATUS_IF_MPI_FAILED(gatherv(send_data + std::min(offset, send_count), send_piece,
+                                              staging.get(), piece_counts.data(),
+                                              piece_displacements.data()));
+    if (recv_data != nullptr) {
+      for (int i = 0; i < world_size; i++) {
+        std::memcpy(recv_data + displacements[i] + offset, staging.get() + piece_displacements[i],
+                    piece_counts[i]);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status MpiTableGatherImpl::GatherBufferSizes(const int64_t *send_data,
                                              int num_buffers,
-                                             int32_t *rcv_data,
-                                             int gather_root) const {
-  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Gather(send_data,
-                                               num_buffers,
-                                               MPI_INT32_T,
-                                               rcv_data,
-                                               num_buffers,
-                                               MPI_INT32_T,
-                                               gather_root,
-                                               comm_));
+                                             int64_t *rcv_data,
+                                             int gather_root) {
+  // the sizes are kept at every rank, so that all of them agree on gathering a buffer in pieces
+  int rank, world_size;
+  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Comm_rank(comm_, &rank));
+  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Comm_size(comm_, &world_size));
+  num_buffers_ = num_buffers;
+  all_buffer_sizes_.resize(num_buffers * world_size);
+  RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Allgather(send_data,
+                                                  num_buffers,
+                                                  MPI_INT64_T,
+                                                  all_buffer_sizes_.data(),
+                                                  num_buffers,
+                                                  MPI_INT64_T,
+                                                  comm_));
+  if (rank == gather_root) {
+    std::copy(all_buffer_sizes_.begin(), all_buffer_sizes_.end(), rcv_data);
+  }
   return Status::OK();
 }
 
 Status MpiTableGatherImpl::IgatherBufferData(int buf_idx,
                                              const uint8_t *send_data,
-                                             int32_t send_count,
+                                             int64_t send_count,
                                              uint8_t *recv_data,
-                                             const std::vector<int32_t> &recv_count,
-                                             const std::vector<int32_t> &displacements,
+                                             const std::vector<int64_t> &recv_count,
+                                             const std::vector<int64_t> &displacements,
                                              int gather_root) {
+  const int world_size = static_cast<int>(all_buffer_sizes_.size()) / num_buffers_;
+  const auto &counts = net::receiveCounts(all_buffer_sizes_, buf_idx, num_buffers_, world_size);
+  if (!FitsMpiCounts(counts)) {
+    return GatherInPieces(send_data, send_count, recv_data, counts, displacements,
+                          [&](const uint8_t *send, int count, uint8_t *recv,
+                              const int *recv_counts, const int *disps) {
+                            return MPI_Gatherv(send, count, MPI_UINT8_T, recv, recv_counts,
+                                               disps, MPI_UINT8_T, gather_root, comm_);
+                          });
+  }
+
+  recv_counts_[buf_idx].assign(recv_count.begin(), recv_count.end());
+  displacements_[buf_idx].assign(displacements.begin(), displacements.end());
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Igatherv(send_data,
-                                                 send_count,
+                                                 static_cast<int>(send_count),
                                                  MPI_UINT8_T,
                                                  recv_data,
-                                                 recv_count.data(),
-                                                 displacements.data(),
+                                                 recv_counts_[buf_idx].data(),
+                                                 displacements_[buf_idx].data(),
                                                  MPI_UINT8_T,
                                                  gather_root,
                                                  comm_,
@@ -68,17 +145,20 @@ Status MpiTableGatherImpl::WaitAll(int num_buffers) {
 }
 
 void MpiTableGatherImpl::Init(int num_buffers) {
-  requests_.resize(num_buffers);
+  // buffers gathered in pieces complete without a request
+  requests_.assign(num_buffers, MPI_REQUEST_NULL);
   statuses_.resize(num_buffers);
+  recv_counts_.resize(num_buffers);
+  displacements_.resize(num_buffers);
 }
 
 Status Gather(const std::shared_ptr<TableSerializer> &serializer,
               int gather_root,
               bool gather_from_root,
               const std::shared_ptr<Allocator> &allocator,
-              std::vector<int32_t> &all_buffer_sizes,
+              std::vector<int64_t> &all_buffer_sizes,
               std::vector<std::shared_ptr<Buffer>> &receive_buffers,
-              std::vector<std::vector<int32_t>> &displacements,
+              std::vector<std::vector<int64_t>> &displacements,
               const std::shared_ptr<CylonContext> &ctx) {
   auto comm = GetMpiComm(ctx);
   MpiTableGatherImpl impl(comm);
@@ -99,46 +179,54 @@ Status GatherArrowBuffer(const std::shared_ptr<arrow::Buffer> &buf,
                          std::vector<std::shared_ptr<arrow::Buffer>> &buffers) {
   auto comm = GetMpiComm(ctx);
 
-  std::vector<int32_t> all_buffer_sizes;
-  if (AmIRoot(gather_root, ctx)) {
-    all_buffer_sizes.resize(ctx->GetWorldSize(), 0);
-  }
-
-  int32_t size = static_cast<int32_t>(buf->size());
-  int status = MPI_Gather(&size,
-                          1,
-                          MPI_INT32_T,
-                          all_buffer_sizes.data(),
-                          1,
-                          MPI_INT32_T,
-                          gather_root,
-                          comm);
+  // the sizes are gathered to every rank, so that all of them agree on gathering in pieces
+  std::vector<int64_t> all_buffer_sizes(ctx->GetWorldSize(), 0);
+  int64_t size = buf->size();
+  int status = MPI_Allgather(&size,
+                             1,
+                             MPI_INT64_T,
+                             all_buffer_sizes.data(),
+                             1,
+                             MPI_INT64_T,
+                             comm);
   if (status != MPI_SUCCESS) {
-    return Status(Code::ExecutionError, "MPI_Gather failed when receiving buffer sizes!");
+    return Status(Code::ExecutionError, "MPI_Allgather failed when receiving buffer sizes!");
   }
 
-  CYLON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> all_buf, arrow::AllocateBuffer(0));
-  std::vector<int32_t> disps;
+  std::vector<int64_t> disps(ctx->GetWorldSize(), 0);
+  std::partial_sum(all_buffer_sizes.begin(), all_buffer_sizes.end() - 1, disps.begin() + 1);
 
+  CYLON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> all_buf, arrow::AllocateBuffer(0));
   if (AmIRoot(gather_root, ctx)) {
-    auto total_size = std::accumulate(all_buffer_sizes.begin(), all_buffer_sizes.end(), 0);
+    auto total_size = std::accumulate(all_buffer_sizes.begin(), all_buffer_sizes.end(),
+                                      int64_t{0});
     CYLON_ASSIGN_OR_RAISE(all_buf, arrow::AllocateBuffer(total_size));
-
-    disps.resize(ctx->GetWorldSize(), 0);
-    std::partial_sum(all_buffer_sizes.begin(), all_buffer_sizes.end() - 1, disps.begin() + 1);
   }
 
-  status = MPI_Gatherv(buf->data(),
-                       size,
-                       MPI_UINT8_T,
-                       (void *) all_buf->data(),
-                       all_buffer_sizes.data(),
-                       disps.data(),
-                       MPI_UINT8_T,
-                       gather_root,
-                       comm);
-  if (status != MPI_SUCCESS) {
-    return Status(Code::ExecutionError, "MPI_Gatherv failed when receiving buffers!");
+  if (FitsMpiCounts(all_buffer_sizes)) {
+    std::vector<int> counts(all_buffer_sizes.begin(), all_buffer_sizes.end());
+    std::vector<int> int_disps(disps.begin(), disps.end());
+    status = MPI_Gatherv(buf->data(),
+                         static_cast<int>(size),
+                         MPI_UINT8_T,
+                         (void *) all_buf->data(),
+                         counts.data(),
+                         int_disps.data(),
+                         MPI_UINT8_T,
+                         gather_root,
+                         comm);
+    if (status != MPI_SUCCESS) {
+      return Status(Code::ExecutionError, "MPI_Gatherv failed when receiving buffers!");
+    }
+  } else {
+    uint8_t *recv_data = AmIRoot(gather_root, ctx) ? all_buf->mutable_data() : nullptr;
+    RETURN_CYLON_STATUS_IF_FAILED(
+        GatherInPieces(buf->data(), size, recv_data, all_buffer_sizes, disps,
+                       [&](const uint8_t *send, int count, uint8_t *recv,
+                           const int *recv_counts, const int *piece_disps) {
+                         return MPI_Gatherv(send, count, MPI_UINT8_T, recv, recv_counts,
+                                            piece_disps, MPI_UINT8_T, gather_root, comm);
+                       }));
   }
 
   if (gather_root == ctx->GetRank()) {
@@ -151,31 +239,42 @@ Status GatherArrowBuffer(const std::shared_ptr<arrow::Buffer> &buf,
   return Status::OK();
 }
 
-Status MpiTableAllgatherImpl::AllgatherBufferSizes(const int32_t *send_data,
+Status MpiTableAllgatherImpl::AllgatherBufferSizes(const int64_t *send_data,
                                                    int num_buffers,
-                                                   int32_t *rcv_data) const {
+                                                   int64_t *rcv_data) const {
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Allgather(send_data,
                                                   num_buffers,
-                                                  MPI_INT32_T,
+                                                  MPI_INT64_T,
                                                   rcv_data,
                                                   num_buffers,
-                                                  MPI_INT32_T,
+                                                  MPI_INT64_T,
                                                   comm_));
   return Status::OK();
 }
 
 Status MpiTableAllgatherImpl::IallgatherBufferData(int buf_idx,
                                                    const uint8_t *send_data,
-                                                   int32_t send_count,
+                                                   int64_t send_count,
                                                    uint8_t *recv_data,
-                                                   const std::vector<int32_t> &recv_count,
-                                                   const std::vector<int32_t> &displacements) {
+                                                   const std::vector<int64_t> &recv_count,
+                                                   const std::vector<int64_t> &displacements) {
+  if (!FitsMpiCounts(recv_count)) {
+    return GatherInPieces(send_data, send_count, recv_data, recv_count, displacements,
+                          [&](const uint8_t *send, int count, uint8_t *recv,
+                              const int *recv_counts, const int *disps) {
+                            return MPI_Allgatherv(send, count, MPI_UINT8_T, recv, recv_counts,
+                                                  disps, MPI_UINT8_T, comm_);
+                          });
+  }
+
+  recv_counts_[buf_idx].assign(recv_count.begin(), recv_count.end());
+  displacements_[buf_idx].assign(displacements.begin(), displacements.end());
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Iallgatherv(send_data,
-                                                    send_count,
+                                                    static_cast<int>(send_count),
                                                     MPI_UINT8_T,
                                                     recv_data,
-                                                    recv_count.data(),
-                                                    displacements.data(),
+                                                    recv_counts_[buf_idx].data(),
+                                                    displacements_[buf_idx].data(),
                                                     MPI_UINT8_T,
                                                     comm_,
                                                     &requests_[buf_idx]));
@@ -193,15 +292,18 @@ MpiTableAllgatherImpl::MpiTableAllgatherImpl(MPI_Comm comm)
     : TableAllgatherImpl(), comm_(comm), requests_({}), statuses_({}) {}
 
 void MpiTableAllgatherImpl::Init(int num_buffers) {
-  requests_.resize(num_buffers);
+  // buffers gathered in pieces complete without a request
+  requests_.assign(num_buffers, MPI_REQUEST_NULL);
   statuses_.resize(num_buffers);
+  recv_counts_.resize(num_buffers);
+  displacements_.resize(num_buffers);
 }
 
 Status AllGather(const std::shared_ptr<TableSerializer> &serializer,
                  const std::shared_ptr<Allocator> &allocator,
-                 std::vector<int32_t> &all_buffer_sizes,
+                 std::vector<int64_t> &all_buffer_sizes,
                  std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                 std::vector<std::vector<int32_t>> &displacements,
+                 std::vector<std::vector<int64_t>> &displacements,
                  const std::shared_ptr<CylonContext> &ctx) {
   auto comm = GetMpiComm(ctx);
   MpiTableAllgatherImpl impl(comm);
@@ -214,37 +316,49 @@ Status AllGatherArrowBuffer(const std::shared_ptr<arrow::Buffer> &buf,
                             std::vector<std::shared_ptr<arrow::Buffer>> &buffers) {
   auto comm = GetMpiComm(ctx);
 
-  std::vector<int32_t> all_buffer_sizes(ctx->GetWorldSize(), 0);
-  int32_t size = static_cast<int32_t>(buf->size());
+  std::vector<int64_t> all_buffer_sizes(ctx->GetWorldSize(), 0);
+  int64_t size = buf->size();
 
   int status = MPI_Allgather(&size,
                              1,
-                             MPI_INT32_T,
+                             MPI_INT64_T,
                              all_buffer_sizes.data(),
                              1,
-                             MPI_INT32_T,
+                             MPI_INT64_T,
                              comm);
   if (status != MPI_SUCCESS) {
     return Status(Code::ExecutionError, "MPI_Allgather failed when receiving buffer sizes!");
   }
 
-  auto total_size = std::accumulate(all_buffer_sizes.begin(), all_buffer_sizes.end(), 0);
+  auto total_size = std::accumulate(all_buffer_sizes.begin(), all_buffer_sizes.end(), int64_t{0});
   CYLON_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Buffer> all_buf, arrow::AllocateBuffer(total_size));
 
-  std::vector<int32_t> disps(ctx->GetWorldSize(), 0);
+  std::vector<int64_t> disps(ctx->GetWorldSize(), 0);
   std::partial_sum(all_buffer_sizes.begin(), all_buffer_sizes.end() - 1, disps.begin() + 1);
 
-  status = MPI_Allgatherv(buf->data(),
-                          size,
-                          MPI_UINT8_T,
-                          (void *) all_buf->data(),
-                          all_buffer_sizes.data(),
-                          disps.data(),
-                          MPI_UINT8_T,
-                          comm);
-  if (status != MPI_SUCCESS) {
-    return Status(Code::ExecutionError,
-                  "MPI_Allgatherv failed when receiving buffers!");
+  if (FitsMpiCounts(all_buffer_sizes)) {
+    std::vector<int> counts(all_buffer_sizes.begin(), all_buffer_sizes.end());
+    std::vector<int> int_disps(disps.begin(), disps.end());
+    status = MPI_Allgatherv(buf->data(),
+                            static_cast<int>(size),
+                            MPI_UINT8_T,
+                            (void *) all_buf->data(),
+                            counts.data(),
+                            int_disps.data(),
+                            MPI_UINT8_T,
+                            comm);
+    if (status != MPI_SUCCESS) {
+      return Status(Code::ExecutionError,
+                    "MPI_Allgatherv failed when receiving buffers!");
+    }
+  } else {
+    RETURN_CYLON_STATUS_IF_FAILED(
+        GatherInPieces(buf->data(), size, all_buf->mutable_data(), all_buffer_sizes, disps,
+                       [&](const uint8_t *send, int count, uint8_t *recv,
+                           const int *recv_counts, const int *piece_disps) {
+                         return MPI_Allgatherv(send, count, MPI_UINT8_T, recv, recv_counts,
+                                               piece_disps, MPI_UINT8_T, comm);
+                       }));
   }
 
   buffers.resize(ctx->GetWorldSize());
@@ -259,31 +373,42 @@ MPI_Comm GetMpiComm(const std::shared_ptr<CylonContext> &ctx) {
   return std::static_pointer_cast<net::MPICommunicator>(ctx->GetCommunicator())->mpi_comm();
 }
 
-Status MpiAllgatherImpl::AllgatherBufferSize(const int32_t *send_data,
+Status MpiAllgatherImpl::AllgatherBufferSize(const int64_t *send_data,
                                              int32_t num_buffers,
-                                             int32_t *rcv_data) const {
+                                             int64_t *rcv_data) const {
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Allgather(send_data,
                                                   num_buffers,
-                                                  MPI_INT32_T,
+                                                  MPI_INT64_T,
                                                   rcv_data,
                                                   num_buffers,
-                                                  MPI_INT32_T,
+                                                  MPI_INT64_T,
                                                   comm_));
   return Status::OK();
 }
 
 Status MpiAllgatherImpl::IallgatherBufferData(int32_t buf_idx,
                                               const uint8_t *send_data,
-                                              int32_t send_count,
+                                              int64_t send_count,
                                               uint8_t *recv_data,
-                                              const std::vector<int32_t> &recv_count,
-                                              const std::vector<int32_t> &displacements) {
+                                              const std::vector<int64_t> &recv_count,
+                                              const std::vector<int64_t> &displacements) {
+  if (!FitsMpiCounts(recv_count)) {
+    return GatherInPieces(send_data, send_count, recv_data, recv_count, displacements,
+                          [&](const uint8_t *send, int count, uint8_t *recv,
+                              const int *recv_counts, const int *disps) {
+                            return MPI_Allgatherv(send, count, MPI_UINT8_T, recv, recv_counts,
+                                                  disps, MPI_UINT8_T, comm_);
+                          });
+  }
+
+  recv_counts_[buf_idx].assign(recv_count.begin(), recv_count.end());
+  displacements_[buf_idx].assign(displacements.begin(), displacements.end());
   RETURN_CYLON_STATUS_IF_MPI_FAILED(MPI_Iallgatherv(send_data,
-                                                    send_count,
+                                                    static_cast<int>(send_count),
                                                     MPI_UINT8_T,
                                                     recv_data,
-                                                    recv_count.data(),
-                                                    displacements.data(),
+                                                    recv_counts_[buf_idx].data(),
+                                                    displacements_[buf_idx].data(),
                                                     MPI_UINT8_T,
                                                     comm_,
                                                     &requests_[buf_idx]));
@@ -295,7 +420,10 @@ Status MpiAllgatherImpl::WaitAll() {
   return Status::OK();
 }
 
-MpiAllgatherImpl::MpiAllgatherImpl(MPI_Comm comm) : comm_(comm) {}
+MpiAllgatherImpl::MpiAllgatherImpl(MPI_Comm comm) : comm_(comm) {
+  // buffers gathered in pieces complete without a request
+  requests_.fill(MPI_REQUEST_NULL);
+}
 
 }
 }
\ No newline at end of file
@@ -49,7 +49,7 @@ public:
    * This method is symmetrical to getDataBuffers()
    * @return
    */
-  virtual const std::vector<int32_t>& getBufferSizes() = 0;
+  virtual const std::vector<int64_t>& getBufferSizes() = 0;
 
   /**
    * length of the buffer sizes
@@ -62,7 +62,7 @@ public:
    * This is used by the MPI gather root
    * @return
    */
-  virtual std::vector<int32_t> getEmptyTableBufferSizes() = 0;
+  virtual std::vector<int64_t> getEmptyTableBufferSizes() = 0;
 
   /**
    * Get data buffers starting from column 0 to the last column
@@ -114,7 +114,7 @@ class ColumnSerializer {
   *     - size of the column null mask buffer in bytes
   *     - size of the column offsets buffer in bytes
   */
-  virtual const std::array<int32_t, 3> &buffer_sizes() const = 0;
+  virtual const std::array<int64_t, 3> &buffer_sizes() const = 0;
 
   virtual int32_t getDataTypeId() const = 0;
 };
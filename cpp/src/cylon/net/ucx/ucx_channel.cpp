@@ -21,6 +21,7 @@
 
 #include <cylon/net/ucx/ucx_channel.hpp>
 #include <cylon/net/ucx/ucx_operations.hpp>
+#include <cylon/arrow/arrow_buffer.hpp>
 #include <cylon/util/macros.hpp>
 
 namespace cylon {
@@ -77,12 +78,38 @@ static unsigned long int getTag(int edge, int sender) {
   return (((unsigned long int) edge) << 32) + sender;
 }
 
+/**
+ * Pass the memory handle of a mapped buffer to a request, so that UCX does not register the buffer
+ * again. The memh request attribute is available from UCX 1.14
+ * @param [in] memh - Memory handle, nullptr if the buffer is not mapped
+ * @param [in,out] param - Request parameters
+ */
+static void setMemoryHandle(ucp_mem_h memh, ucp_request_param_t *param) {
+#if UCP_API_VERSION >= UCP_VERSION(1, 14)
+  if (memh != nullptr) {
+    param->op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+    param->memh = memh;
+  }
+#else
+  CYLON_UNUSED(memh);
+  CYLON_UNUSED(param);
+#endif
+}
+
 UCXChannel::UCXChannel(const net::UCXCommunicator *com) :
     rank(com->GetRank()),
     worldSize(com->GetWorldSize()),
     ucpRecvWorker(&(com->ucpRecvWorker)),
     ucpSendWorker(&(com->ucpSendWorker)),
-    endPointMap(com->endPointMap) {
+    endPointMap(com->endPointMap),
+    bufferPool(com->bufferPool) {
+}
+
+ucp_mem_h UCXChannel::getMemoryHandle(const void *buffer) const {
+  if (bufferPool == nullptr) {
+    return nullptr;
+  }
+  return static_cast<ucp_mem_h>(bufferPool->GetMemoryHandle(static_cast<const uint8_t *>(buffer)));
 }
 
 /**
@@ -92,12 +119,14 @@ UCXChannel::UCXChannel(const net::UCXCommunicator *com) :
  * @param [in] count - Size of the receiving data
  * @param [in] sender - MPI id of the sender
  * @param [out] ctx - ucx::ucxContext object, used for tracking the progress of the request
+ * @param [in] memh - Memory handle of the buffer, nullptr if it is not mapped
  * @return Cylon Status
  */
 Status UCXChannel::UCX_Irecv(void *buffer,
                             size_t count,
                             int sender,
-                            ucx::ucxContext* ctx) {
+                            ucx::ucxContext* ctx,
+                            ucp_mem_h memh) {
   // To hold the status of operations
   ucs_status_ptr_t status;
 
@@ -107,6 +136,7 @@ Status UCXChannel::UCX_Irecv(void *buffer,
       UCP_OP_ATTR_FLAG_NO_IMM_CMPL;
   recvParam.cb.recv = recvHandler;
   recvParam.user_data = ctx;
+  setMemoryHandle(memh, &recvParam);
 
   // Init completed
   ctx->completed = 0;
@@ -135,12 +165,14 @@ Status UCXChannel::UCX_Irecv(void *buffer,
  * @param [in] count - Size of the receiving data
  * @param [in] ep - Endpoint to send the data to
  * @param [out] ctx - Used for tracking the progress of the request
+ * @param [in] memh - Memory handle of the buffer, nullptr if it is not mapped
  * @return Cylon Status
  */
 Status UCXChannel::UCX_Isend(const void *buffer,
                            size_t count,
                            ucp_ep_h ep,
-                           ucx::ucxContext* ctx) const {
+                           ucx::ucxContext* ctx,
+                           ucp_mem_h memh) const {
   // To hold the status of operations
   ucs_status_ptr_t status;
 
@@ -151,6 +183,7 @@ Status UCXChannel::UCX_Isend(const void *buffer,
       UCP_OP_ATTR_FLAG_NO_IMM_CMPL;
   sendParam.cb.send = sendHandler;
   sendParam.user_data = ctx;
+  setMemoryHandle(memh, &sendParam);
 
   // Init completed
   ctx->completed = 0;
@@ -275,8 +308,8 @@ void UCXChannel::progressReceives() {
       if (x.second->context->completed == 1) {
         // Get data from the header
         // read the length from the header
-        int length = x.second->headerBuf[0];
-        int finFlag = x.second->headerBuf[1];
+        int64_t length = GetHeaderLength(x.second->headerBuf);
+        int finFlag = x.second->headerBuf[2];
 
         // Check weather we are at the end
         if (finFlag != CYLON_MSG_FIN) {
@@ -297,14 +330,16 @@ void UCXChannel::progressReceives() {
           x.second->context->completed = 0;
 
           // UCX receive
-          UCX_Irecv(x.second->data->GetByteBuffer(), length, x.first, x.second->context);
+          // pooled buffers are already mapped
+          UCX_Irecv(x.second->data->GetByteBuffer(), length, x.first, x.second->context,
+                    getMemoryHandle(x.second->data->GetByteBuffer()));
           // Set the flag to true so we can identify later which buffers are posted
           x.second->status = RECEIVE_POSTED;
 
-          // copy the count - 2 to the buffer
+          // copy the user header following the prefix to the buffer
           int *header = nullptr;
           header = new int[6];
-          memcpy(header, &(x.second->headerBuf[2]), 6 * sizeof(int));
+          memcpy(header, &(x.second->headerBuf[CYLON_CHANNEL_HEADER_PREFIX]), 6 * sizeof(int));
 
           // Notify the receiver that the destination received the header
           rcv_fn->receivedHeader(x.first, finFlag, header, 6);
@@ -364,7 +399,8 @@ void UCXChannel::progressSends() {
         UCX_Isend(r->buffer,
                   r->length,
                   endPointMap[x.first],
-                  x.second->context);
+                  x.second->context,
+                  getMemoryHandle(r->buffer));
 
         // Update status
         x.second->status = SEND_POSTED;
@@ -430,12 +466,12 @@ void UCXChannel::sendHeader(const std::pair<const int, PendingSend *> &x) const
   // Get the request
   std::shared_ptr<CylonRequest> r = x.second->pendingData.front();
   // Put the length to the buffer
-  x.second->headerBuf[0] = r->length;
-  x.second->headerBuf[1] = 0;
+  SetHeaderLength(x.second->headerBuf, r->length);
+  x.second->headerBuf[2] = CYLON_MSG_NOT_FIN;
 
   // Copy data from CylonRequest header to the PendingSend header
   if (r->headerLength > 0) {
-    memcpy(&(x.second->headerBuf[2]),
+    memcpy(&(x.second->headerBuf[CYLON_CHANNEL_HEADER_PREFIX]),
            &(r->header[0]),
            r->headerLength * sizeof(int));
   }
@@ -444,7 +480,7 @@ void UCXChannel::sendHeader(const std::pair<const int, PendingSend *> &x) const
   x.second->context =  new ucx::ucxContext();
   x.second->context->completed = 0;
   UCX_Isend(x.second->headerBuf,
-            (2 + r->headerLength) * sizeof(int),
+            (CYLON_CHANNEL_HEADER_PREFIX + r->headerLength) * sizeof(int),
             endPointMap.at(x.first),
             x.second->context);
   // Update status
@@ -456,14 +492,14 @@ void UCXChannel::sendHeader(const std::pair<const int, PendingSend *> &x) const
  * @param x the target, pendingSend pair
  */
 void UCXChannel::sendFinishHeader(const std::pair<const int, PendingSend *> &x) const {
-  // for the last header we always send only the first 2 integers
-  x.second->headerBuf[0] = 0;
-  x.second->headerBuf[1] = CYLON_MSG_FIN;
+  // for the last header we always send only the prefix
+  SetHeaderLength(x.second->headerBuf, 0);
+  x.second->headerBuf[2] = CYLON_MSG_FIN;
   delete x.second->context;
   x.second->context =  new ucx::ucxContext();
   x.second->context->completed = 0;
   UCX_Isend(x.second->headerBuf,
-            8 * sizeof(int),
+            CYLON_CHANNEL_HEADER_PREFIX * sizeof(int),
             endPointMap.at(x.first),
             x.second->context);
   x.second->status = SEND_FINISH;
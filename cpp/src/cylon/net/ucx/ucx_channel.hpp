@@ -26,10 +26,6 @@
 #include <cylon/net/buffer.hpp>
 #include <cylon/status.hpp>
 
-
-#define CYLON_CHANNEL_HEADER_SIZE 8
-#define CYLON_MSG_FIN 1
-
 namespace cylon {
 enum UCXSendStatus {
   SEND_INIT = 0,
@@ -50,7 +46,7 @@ enum UCXReceiveStatus {
  * Keep track about the length buffer to receive the length first
  */
 struct PendingSend {
-  //  we allow upto 8 ints for the header
+  //  we allow upto 6 ints for the user header
   int headerBuf[CYLON_CHANNEL_HEADER_SIZE]{};
   // segments of data to be sent
   std::queue<std::shared_ptr<CylonRequest>> pendingData{};
@@ -63,13 +59,13 @@ struct PendingSend {
 };
 
 struct PendingReceive {
-  // we allow upto 8 integer header
+  // we allow upto 6 integer user header
   int headerBuf[CYLON_CHANNEL_HEADER_SIZE]{};
   int receiveId{};
   // Buffers are untyped: they simply denote a physical memory
   // area regardless of its intended meaning or interpretation.
   std::shared_ptr<Buffer> data{};
-  int length{};
+  int64_t length{};
   UCXReceiveStatus status = RECEIVE_INIT;
   // UCX context - For tracking the progress of the message
   ucx::ucxContext *context;
@@ -157,6 +153,15 @@ class UCXChannel : public Channel {
   std::unordered_map<int, ucp_ep_h> endPointMap;
   // Tag mask used to match UCX send / receives
   ucp_tag_t tagMask = UINT64_MAX;
+  // Receive buffer pool of the communicator, to look up the memory handles of the pooled buffers
+  std::shared_ptr<BufferPool> bufferPool;
+
+  /**
+   * Memory handle of a buffer mapped with the UCP context
+   * @param [in] buffer - Pointer to the buffer
+   * @return the handle, nullptr if the buffer is not a mapped buffer pool block
+   */
+  ucp_mem_h getMemoryHandle(const void *buffer) const;
 
   /**
    * UCX Receive
@@ -165,12 +170,14 @@ class UCXChannel : public Channel {
    * @param [in] count - Size of the receiving data
    * @param [in] sender - MPI id of the sender
    * @param [out] ctx - ucx::ucxContext object, used for tracking the progress of the request
+   * @param [in] memh - Memory handle of the buffer, nullptr if it is not mapped
    * @return Cylon Status
    */
   Status UCX_Irecv(void *buffer,
                  size_t count,
                  int source,
-                 ucx::ucxContext* ctx);
+                 ucx::ucxContext* ctx,
+                 ucp_mem_h memh = nullptr);
 
   /**
    * UCX Send
@@ -180,12 +187,14 @@ class UCXChannel : public Channel {
    * @param [in] ep - Endpoint to send the data to
    * @param [out] request - UCX Context object
    *                        Used for tracking the progress of the request
+   * @param [in] memh - Memory handle of the buffer, nullptr if it is not mapped
    * @return Cylon Status
    */
   Status UCX_Isend(const void *buffer,
                  size_t  count,
                  ucp_ep_h ep,
-                 ucx::ucxContext* request) const;
+                 ucx::ucxContext* request,
+                 ucp_mem_h memh = nullptr) const;
 
   /**
    * Send finish request
@@ -18,9 +18,43 @@
 #include <cylon/net/ucx/ucx_communicator.hpp>
 #include <cylon/net/ucx/ucx_channel.hpp>
 #include <cylon/util/macros.hpp>
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/arrow/arrow_buffer.hpp>
 
 namespace cylon {
 namespace net {
+
+/**
+ * Maps the receive buffer pool blocks with the UCP context. The UCX channels pass the handles to
+ * the transfers of pooled buffers, so that they do not pay for the memory registration
+ */
+class UCXMemoryRegistrar : public MemoryRegistrar {
+ public:
+  explicit UCXMemoryRegistrar(ucp_context_h ucpContext) : ucpContext(ucpContext) {}
+
+  Status Register(uint8_t *address, int64_t length, void **handle) override {
+    ucp_mem_map_params_t params;
+    params.field_mask = UCP_MEM_MAP_PARAM_FIELD_ADDRESS | UCP_MEM_MAP_PARAM_FIELD_LENGTH;
+    params.address = address;
+    params.length = length;
+
+    ucp_mem_h memh;
+    ucs_status_t status = ucp_mem_map(ucpContext, &params, &memh);
+    if (status != UCS_OK) {
+      return {Code::ExecutionError, "ucp_mem_map failed: " + std::string(ucs_status_string(status))};
+    }
+    *handle = memh;
+    return Status::OK();
+  }
+
+  void Deregister(void *handle) override {
+    ucp_mem_unmap(ucpContext, static_cast<ucp_mem_h>(handle));
+  }
+
+ private:
+  ucp_context_h ucpContext;
+};
+
 void UCXConfig::DummyConfig(int dummy) {
   this->AddConfig("Dummy", &dummy);
 }
@@ -127,9 +161,18 @@ Status UCXCommunicator::Init(const std::shared_ptr<CommConfig> &config) {
   delete (ucpRecvWorkerAddr);
   delete (ucpSendWorkerAddr);
 
+  // keep the pooled receive buffers registered
+  bufferPool = (*ctx_ptr)->GetBufferPool();
+  bufferPool->SetRegistrar(std::make_shared<UCXMemoryRegistrar>(ucpContext));
+
   return Status::OK();
 }
 void UCXCommunicator::Finalize() {
+  // buffers can outlive the context. unmap them before cleaning up
+  if (bufferPool != nullptr) {
+    bufferPool->SetRegistrar(nullptr);
+    bufferPool.reset();
+  }
   ucp_cleanup(ucpContext);
   MPI_Finalize();
 }
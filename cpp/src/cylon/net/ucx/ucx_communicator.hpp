@@ -22,6 +22,8 @@
 #include <ucp/api/ucp.h>
 
 namespace cylon {
+class BufferPool;
+
 namespace net {
 
 class UCXConfig : public CommConfig {
@@ -73,6 +75,8 @@ class UCXCommunicator : public Communicator {
   std::unordered_map<int, ucp_ep_h> endPointMap;
   // UCP Context - Holds a UCP communication instance's global information.
   ucp_context_h ucpContext{};
+  // Receive buffer pool of the context. Its blocks are kept mapped with the UCP context
+  std::shared_ptr<BufferPool> bufferPool{};
 };
 
 }
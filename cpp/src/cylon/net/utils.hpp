@@ -29,18 +29,18 @@ namespace net {
     |b_0, ..., b_n-1|...|b_0, ..., b_n-1|
      <--- tbl_0 --->     <--- tbl_m --->
  */
-std::vector<int32_t> ReshapeDispToPerTable(const std::vector<std::vector<int32_t>> &all_disps);
+std::vector<int64_t> ReshapeDispToPerTable(const std::vector<std::vector<int64_t>> &all_disps);
 
-std::vector<int32_t> totalBufferSizes(const std::vector<int32_t> &all_buffer_sizes,
+std::vector<int64_t> totalBufferSizes(const std::vector<int64_t> &all_buffer_sizes,
                                       int num_buffers,
                                       int world_size);
 
-std::vector<int32_t> receiveCounts(const std::vector<int32_t> &all_buffer_sizes,
+std::vector<int64_t> receiveCounts(const std::vector<int64_t> &all_buffer_sizes,
                                    int receiveNo,
                                    int num_buffers,
                                    int world_size);
 
-std::vector<int32_t> displacementsPerBuffer(const std::vector<int32_t> &all_buffer_sizes,
+std::vector<int64_t> displacementsPerBuffer(const std::vector<int64_t> &all_buffer_sizes,
                                             int receiveNo,
                                             int num_buffers,
                                             int world_size);
@@ -65,9 +65,11 @@ Status JoinOperation(const std::shared_ptr <cylon::CylonContext> &ctx,
                      const std::shared_ptr <cylon::Table> &right,
                          const cylon::join::config::JoinConfig &join_config,
                          std::shared_ptr <cylon::Table> &out) {
+  // the join op streams the joined tables, followed by the unmatched rows of outer joins
+  std::vector<std::shared_ptr<cylon::Table>> joined;
   const cylon::ResultsCallback &callback = [&](int tag, const std::shared_ptr <cylon::Table> &table) {
     CYLON_UNUSED(tag);
-    out = table;
+    joined.push_back(table);
   };
 
   int left_splits = 1;
@@ -82,7 +84,11 @@ Status JoinOperation(const std::shared_ptr <cylon::CylonContext> &ctx,
   op.InsertTable(200, right);
   auto execution = op.GetExecution();
   execution->WaitForCompletion();
-  return cylon::Status::OK();
+  if (joined.size() == 1) {
+    out = joined[0];
+    return cylon::Status::OK();
+  }
+  return cylon::Merge(joined, out);
 }
 
 Status UnionOperation(const std::shared_ptr <cylon::CylonContext> &ctx,
@@ -29,6 +29,7 @@ cylon::AllToAllOp::AllToAllOp(const std::shared_ptr<CylonContext> &ctx,
     CYLON_UNUSED(source);
     auto tab = std::make_shared<cylon::Table>(this->ctx_, table);
     this->InsertToAllChildren(tag, tab);
+    this->received_ = true;
     return true;
   };
 
@@ -59,8 +60,20 @@ bool cylon::AllToAllOp::Execute(int tag, std::shared_ptr<Table> &table) {
 
 bool cylon::AllToAllOp::IsComplete() {
   //LOG(INFO) << "Calling shuffle progress";
+  // stop receiving while the children are at capacity
+  const bool children_have_capacity = this->ChildrenHaveCapacity();
+  this->all_to_all_->pauseReceives(!children_have_capacity);
   this->all_to_all_->isComplete();
-  return Op::IsComplete();
+  bool complete = Op::Progress(children_have_capacity);
+  if (this->received_) {
+    this->SetDidWork();
+    this->received_ = false;
+  }
+  return complete;
+}
+
+bool cylon::AllToAllOp::IsCommunicationOp() const {
+  return true;
 }
 
 bool cylon::AllToAllOp::Finalize() {
@@ -29,6 +29,8 @@ class AllToAllOp : public Op {
  private:
   cylon::ArrowAllToAll *all_to_all_{};
   bool finish_called_;
+  // set by the receive callback, so that the execution knows the op progressed
+  bool received_ = false;
   std::chrono::high_resolution_clock::time_point start;
   bool started_time = false;
   long exec_time = 0;
@@ -43,6 +45,8 @@ class AllToAllOp : public Op {
 
   bool IsComplete() override;
 
+  bool IsCommunicationOp() const override;
+
   bool Execute(int tag, std::shared_ptr<Table> &table) override;
 
   bool Finalize() override;
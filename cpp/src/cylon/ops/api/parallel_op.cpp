@@ -14,15 +14,44 @@
 
 #include <cylon/ops/api/parallel_op.hpp>
 
+#include <algorithm>
+#include <array>
+#include <numeric>
 #include <utility>
+#include <vector>
 
+#include <cylon/util/arrow_utils.hpp>
+
+
+namespace {
+// rows and bytes of a table
+std::array<int64_t, 2> TableSize(const std::shared_ptr<cylon::Table> &table) {
+  if (table == nullptr) {
+    return {0, 0};
+  }
+  const auto &atable = table->get_table();
+  std::vector<int> columns(atable->num_columns());
+  std::iota(columns.begin(), columns.end(), 0);
+  return {atable->num_rows(), cylon::util::GetBytesAndElements(atable, columns)[1]};
+}
+
+int64_t GetCapacityConfig(const std::shared_ptr<cylon::CylonContext> &ctx, const char *key) {
+  if (ctx == nullptr) {
+    return 0;
+  }
+  const auto &config = ctx->GetConfig(key);
+  return config.empty() ? 0 : std::stoll(config);
+}
+}  // namespace
 
 void cylon::Op::DrainQueueToChild(int queue, int child, int tag) {
+  std::lock_guard<std::mutex> lock(queues_mutex);
   const auto &q = this->queues.at(queue);
   const auto &c = this->children.at(child);
-  while (!q->empty()) {
-    c->InsertTable(tag, q->front());
-    q->pop();
+  child_tags[child].insert(tag);
+  while (!q->tables.empty()) {
+    c->InsertTable(tag, q->tables.front());
+    PopInput(q);
   }
 }
 
@@ -31,46 +60,143 @@ cylon::Op::Op(const std::shared_ptr<cylon::CylonContext> &ctx,
               int id,
               ResultsCallback callback,
               bool root_op)
-    : callback(std::move(callback)), all_parents_finalized(root_op), id(id), ctx_(ctx), schema(schema) {
+    : capacity_rows(GetCapacityConfig(ctx, kOpQueueRowsConfig)),
+      capacity_bytes(GetCapacityConfig(ctx, kOpQueueBytesConfig)),
+      callback(std::move(callback)), all_parents_finalized(root_op), id(id), ctx_(ctx), schema(schema) {
 }
 
 void cylon::Op::InsertTable(int tag, const std::shared_ptr<Table> &table) {
+  const auto &size = TableSize(table);
+  std::lock_guard<std::mutex> lock(queues_mutex);
   auto q_iter = queues.find(tag);
   if (q_iter == queues.end()) { // if tag not found -> create queue for tag
-    q_iter = queues.emplace(tag, new std::queue<std::shared_ptr<cylon::Table>>()).first;
+    q_iter = queues.emplace(tag, new InputQueue()).first;
   }
-  q_iter->second->push(table);
+  q_iter->second->tables.push(table);
+  q_iter->second->rows += size[0];
+  q_iter->second->bytes += size[1];
   this->inputs_count++;
+
+  metrics.tables++;
+  metrics.rows += size[0];
+  metrics.bytes += size[1];
+  metrics.max_rows = std::max(metrics.max_rows, metrics.rows);
+  metrics.max_bytes = std::max(metrics.max_bytes, metrics.bytes);
+}
+
+void cylon::Op::PopInput(InputQueue *queue) {
+  const auto &size = TableSize(queue->tables.front());
+  queue->tables.pop();
+  queue->rows -= size[0];
+  queue->bytes -= size[1];
+  this->inputs_count--;
+
+  metrics.tables--;
+  metrics.rows -= size[0];
+  metrics.bytes -= size[1];
+}
+
+void cylon::Op::SetQueueCapacity(int64_t rows, int64_t bytes) {
+  capacity_rows = rows;
+  capacity_bytes = bytes;
+}
+
+bool cylon::Op::IsQueueFull(int tag) {
+  const int64_t rows = capacity_rows, bytes = capacity_bytes;
+  if (rows <= 0 && bytes <= 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(queues_mutex);
+  auto q_iter = queues.find(tag);
+  if (q_iter == queues.end()) {
+    return false;
+  }
+  return (rows > 0 && q_iter->second->rows >= rows) || (bytes > 0 && q_iter->second->bytes >= bytes);
+}
+
+cylon::OpQueueMetrics cylon::Op::GetQueueMetrics() {
+  std::lock_guard<std::mutex> lock(queues_mutex);
+  auto res = metrics;
+  res.backpressure_count = backpressure_count;
+  return res;
+}
+
+bool cylon::Op::ChildrenHaveCapacity() {
+  for (const auto &child: child_tags) {
+    auto *c = this->children.at(child.first);
+    for (int tag: child.second) {
+      if (c->IsQueueFull(tag)) {
+        backpressure_count++;
+        return false;
+      }
+    }
+  }
+  return true;
 }
 
 bool cylon::Op::IsComplete() {
+  return this->Progress(this->finalized || this->ChildrenHaveCapacity());
+}
+
+bool cylon::Op::Progress(bool children_have_capacity) {
   this->did_work = false;
 
-  // first process this Op
-  if (!this->finalized && this->inputs_count > 0) {
-    for (auto const &q:this->queues) {
-      if (!q.second->empty()) {
-        bool done = this->Execute(q.first, q.second->front());
-        if (done) {
-          q.second->pop();
-          this->inputs_count--;
-          // todo instead of keeping in this queue, partially processed tables
-          //  can be added to a different queue
-          // todo check whether this is the best way to do this. But always
-          //  assume that the status of the
-          // partially processed tables will be kept by the Op implementation
-          // std::queue<std::pair<int, std::shared_ptr<cylon::Table>>> partially_processed_queue{};
-          this->did_work = true;
+  // first process this Op, unless the children can not take more tables
+  if (!this->finalized && children_have_capacity) {
+    // queues with inputs. The tables are executed without the lock, so that parents can insert tables
+    // meanwhile. Only this Op pops from the queues, so the fronts stay the same
+    std::vector<std::pair<int, InputQueue *>> ready;
+    {
+      std::lock_guard<std::mutex> lock(queues_mutex);
+      if (this->inputs_count > 0) {
+        for (auto const &q:this->queues) {
+          if (!q.second->tables.empty()) {
+            ready.emplace_back(q.first, q.second);
+          }
         }
       }
     }
+
+    for (auto const &q:ready) {
+      std::shared_ptr<Table> table;
+      {
+        std::lock_guard<std::mutex> lock(queues_mutex);
+        table = q.second->tables.front();
+      }
+      bool done = this->Execute(q.first, table);
+      std::lock_guard<std::mutex> lock(queues_mutex);
+      if (done) {
+        PopInput(q.second);
+        // todo instead of keeping in this queue, partially processed tables
+        //  can be added to a different queue
+        // todo check whether this is the best way to do this. But always
+        //  assume that the status of the
+        // partially processed tables will be kept by the Op implementation
+        // std::queue<std::pair<int, std::shared_ptr<cylon::Table>>> partially_processed_queue{};
+        this->did_work = true;
+      } else {
+        q.second->tables.front() = std::move(table);
+      }
+    }
   }
 
   // if no more inputs and all parents have finalized, try to finalize this op
-  // if finalizing this Op is successful report that to children
-  if (!this->finalized && this->inputs_count == 0 && this->all_parents_finalized) {
+  // if finalizing this Op is successful report that to children.
+  // all_parents_finalized should be read before the inputs, as parents insert their last tables
+  // before reporting their completion
+  if (!this->finalized && this->all_parents_finalized.load()) {
+    if (!this->parents_finalized_handled) {
+      this->OnParentsFinalized();
+      this->parents_finalized_handled = true;
+    }
+
+    bool no_inputs;
+    {
+      std::lock_guard<std::mutex> lock(queues_mutex);
+      no_inputs = this->inputs_count == 0;
+    }
     // try to finalize this Op
-    if (this->Finalize()) {
+    if (no_inputs && this->Finalize()) {
       for (const auto &child: children) {
         child.second->ReportParentCompleted();
       }
@@ -105,6 +231,7 @@ bool cylon::Op::TerminalCheck(int tag, std::shared_ptr<Table> &table) {
 void cylon::Op::InsertToAllChildren(int tag, std::shared_ptr<Table> &table) {
   if (!this->TerminalCheck(tag, table)) {
     for (auto const &child:this->children) {
+      child_tags[child.first].insert(tag);
       child.second->InsertTable(tag, table);
     }
   }
@@ -112,6 +239,7 @@ void cylon::Op::InsertToAllChildren(int tag, std::shared_ptr<Table> &table) {
 
 void cylon::Op::InsertToChild(int child, int tag, std::shared_ptr<Table> &table) {
   if (!this->TerminalCheck(tag, table)) {
+    child_tags[child].insert(tag);
     this->children.at(child)->InsertTable(tag, table);
   }
 }
@@ -121,17 +249,23 @@ void cylon::Op::IncrementParentsCount() {
 }
 
 void cylon::Op::ReportParentCompleted() {
-  this->finalized_parents++;
-  if (this->finalized_parents >= parents) {
+  if (++this->finalized_parents >= parents) {
     this->all_parents_finalized = true;
-    this->OnParentsFinalized();
   }
 }
 
+void cylon::Op::SetDidWork() {
+  this->did_work = true;
+}
+
 bool cylon::Op::DidSomeWork() const {
   return this->did_work;
 }
 
+bool cylon::Op::IsCommunicationOp() const {
+  return false;
+}
+
 int cylon::Op::GetId() const {
   return id;
 }
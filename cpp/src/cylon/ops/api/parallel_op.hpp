@@ -15,7 +15,10 @@
 #ifndef CYLON_SRC_CYLON_OPS_PARALLEL_OP_HPP_
 #define CYLON_SRC_CYLON_OPS_PARALLEL_OP_HPP_
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 #include <cylon/table.hpp>
 #include <cylon/ops/execution/execution.hpp>
 
@@ -29,23 +32,64 @@ namespace cylon {
 
 using ResultsCallback = std::function<void(int tag, const std::shared_ptr<Table> &table)>;
 
+/**
+ * CylonContext configs for the capacity of each input queue of the Ops, in rows and in bytes. A parent
+ * Op holds back while a queue it feeds is at capacity. Not set (or <= 0) is unbounded.
+ */
+constexpr const char *kOpQueueRowsConfig = "op_queue_rows";
+constexpr const char *kOpQueueBytesConfig = "op_queue_bytes";
+
+/**
+ * Depth of the input queues of an Op
+ */
+struct OpQueueMetrics {
+  // tables, rows and bytes in the input queues
+  int64_t tables = 0;
+  int64_t rows = 0;
+  int64_t bytes = 0;
+  // peak rows and bytes in the input queues
+  int64_t max_rows = 0;
+  int64_t max_bytes = 0;
+  // number of times the Op held back its inputs, because a queue of a child was at capacity
+  int64_t backpressure_count = 0;
+};
+
 class Op {
  private:
-  std::unordered_map<int, std::queue<std::shared_ptr<Table>> *> queues{};
+  // input queue of a tag, ie. an edge from a parent
+  struct InputQueue {
+    std::queue<std::shared_ptr<Table>> tables;
+    int64_t rows = 0;
+    int64_t bytes = 0;
+  };
+
+  std::unordered_map<int, InputQueue *> queues{};
 
   // this count should be increased when adding table to the queues,
   // and should be decrease when removing a table from the queue
   int inputs_count = 0;
+  // guards the queues, inputs_count and metrics. Parents may insert tables from other threads, while
+  // this Op is being progressed (ThreadPoolExecution)
+  std::mutex queues_mutex;
+  OpQueueMetrics metrics{};
+  std::atomic<int64_t> backpressure_count{0};
+  // capacity of each input queue, <= 0 is unbounded
+  std::atomic<int64_t> capacity_rows{0};
+  std::atomic<int64_t> capacity_bytes{0};
+
   std::unordered_map<int, Op *> children{};
+  // tags inserted to each child, ie. the input queues of the children fed by this Op
+  std::unordered_map<int, std::unordered_set<int>> child_tags{};
   ResultsCallback callback;
 //  std::function<int(int)> router;
 
   // capturing the parent status
   int32_t parents = 0;
-  int32_t finalized_parents = 0;
+  std::atomic<int32_t> finalized_parents{0};
 
   // finalize status
-  bool all_parents_finalized = false;
+  std::atomic<bool> all_parents_finalized{false};
+  bool parents_finalized_handled = false;
   bool finalized = false;
 
   // flag to indicate whether IsProgress actually did some work. This will be used in adaptive priority execution
@@ -59,6 +103,9 @@ class Op {
    */
   bool TerminalCheck(int tag, std::shared_ptr<Table> &table);
 
+  // pops the front table of a queue, requires the queues_mutex
+  void PopInput(InputQueue *queue);
+
  protected:
   int id;
   std::shared_ptr<cylon::CylonContext> ctx_;
@@ -70,10 +117,30 @@ class Op {
   void IncrementParentsCount();
 
   /**
-   * Parent Op will call this method to report it's completion to the child
+   * Parent Op will call this method to report it's completion to the child. It can be called from
+   * the thread of the parent, so OnParentsFinalized is called later, by IsComplete of this Op
    */
   void ReportParentCompleted();
 
+  /**
+   * Marks that this IsComplete call did some work, ex: when a communication Op received data
+   */
+  void SetDidWork();
+
+  /**
+   * Backpressure: true if none of the input queues of the children, that this Op has fed, are at
+   * capacity. The Op processes its inputs only when the children have capacity.
+   */
+  bool ChildrenHaveCapacity();
+
+  /**
+   * The body of IsComplete, for Ops that check the capacity of the children themselves, so that a
+   * backpressure is counted once per call
+   * @param children_have_capacity result of ChildrenHaveCapacity for this call
+   * @return true if this Op is finalized
+   */
+  bool Progress(bool children_have_capacity);
+
   /**
    * This function can be used if this Op is just a forwarding Op. todo this is a util, possible to move outside the class
    * @param queue queue Id
@@ -118,6 +185,23 @@ class Op {
    */
   void InsertTable(int tag, const std::shared_ptr<Table> &table);
 
+  /**
+   * Sets the capacity of each input queue of this Op, in rows and bytes (<= 0 is unbounded). The
+   * capacity is soft, a parent can exceed it by the tables of one Execute call. Defaults to the
+   * kOpQueueRowsConfig and kOpQueueBytesConfig of the context.
+   * @param rows
+   * @param bytes
+   */
+  void SetQueueCapacity(int64_t rows, int64_t bytes);
+
+  /**
+   * True if the input queue of the tag is at capacity
+   * @param tag
+   */
+  bool IsQueueFull(int tag);
+
+  OpQueueMetrics GetQueueMetrics();
+
   /**
    * This function defines the execution logic of this op. It can be either a computation or a communication
    * @param tag
@@ -139,12 +223,19 @@ class Op {
    * 5) If this Op is finalizable call Finalize()
    * 6) Call progress in Child Ops(Child branches)
    *
-   * This function can be overridden in child Ops, but it's mandatory to call Op::Progress in such cases
+   * This function can be overridden in child Ops, but it's mandatory to call Op::IsComplete or
+   * Op::Progress in such cases
    */
   virtual bool IsComplete();
 
   bool DidSomeWork() const;
 
+  /**
+   * Communication Ops are progressed by a single thread, the thread which waits for the execution.
+   * Other Ops can be progressed by any thread, but by one thread at a time.
+   */
+  virtual bool IsCommunicationOp() const;
+
   /**
    * This function will be called when no more inputs will be received to this Op, ie parents have been finalized
    */
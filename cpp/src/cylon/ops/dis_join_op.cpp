@@ -25,8 +25,8 @@ cylon::DisJoinOP::DisJoinOP(const std::shared_ptr<CylonContext> &ctx,
                             int id,
                             const ResultsCallback &callback,
                             const DisJoinOpConfig &config) : RootOp(ctx, left_schema, id, callback) {
-  auto execution = new ForkJoinExecution();
-  execution->AddLeft(this);
+  auto execution = ThreadPoolExecution::Make(ctx);
+  execution->AddOp(this);
   this->SetExecution(execution);
 
   const std::vector<int32_t> PARTITION_IDS = {LEFT_RELATION, RIGHT_RELATION};
@@ -39,35 +39,35 @@ cylon::DisJoinOP::DisJoinOP(const std::shared_ptr<CylonContext> &ctx,
   partition_op = new PartitionOp(ctx, left_schema, LEFT_RELATION, callback,
                                  {ctx->GetWorldSize(), {config.join_config.GetLeftColumnIdx()}});
   this->AddChild(partition_op);
-  execution->AddLeft(partition_op);
+  execution->AddOp(partition_op);
 
   shuffle_op = new AllToAllOp(ctx, left_schema, LEFT_RELATION, callback, {});
   partition_op->AddChild(shuffle_op);
-  execution->AddLeft(shuffle_op);
+  execution->AddOp(shuffle_op);
 
   split_op = new SplitOp(ctx, left_schema, LEFT_RELATION, callback, {config.GetLeftSplits(), {config.join_config.GetLeftColumnIdx()}});
   shuffle_op->AddChild(split_op);
-  execution->AddLeft(split_op);
+  execution->AddOp(split_op);
 
   // add join op
-  join_op = new JoinOp(ctx, left_schema, JOIN_OP_ID, callback, config.join_config);
+  join_op = new JoinOp(ctx, left_schema, right_schema, JOIN_OP_ID, callback, config.join_config);
   split_op->AddChild(join_op);
-  execution->AddFinal(join_op);
+  execution->AddOp(join_op);
 
 
   // build right sub tree
   partition_op = new PartitionOp(ctx, right_schema, RIGHT_RELATION, callback,
                                  {ctx->GetWorldSize(), {config.join_config.GetLeftColumnIdx()}});
   this->AddChild(partition_op);
-  execution->AddRight(partition_op);
+  execution->AddOp(partition_op);
 
   shuffle_op = new AllToAllOp(ctx, right_schema, RIGHT_RELATION, callback, {});
   partition_op->AddChild(shuffle_op);
-  execution->AddRight(shuffle_op);
+  execution->AddOp(shuffle_op);
 
   split_op = new SplitOp(ctx, right_schema, RIGHT_RELATION, callback, {config.GetRightSplits(), {config.join_config.GetRightColumnIdx()}});
   shuffle_op->AddChild(split_op);
-  execution->AddRight(split_op);
+  execution->AddOp(split_op);
 
   split_op->AddChild(join_op); // join_op is already initialized
 }
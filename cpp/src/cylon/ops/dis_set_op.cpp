@@ -25,8 +25,8 @@ cylon::DisSetOp::DisSetOp(const std::shared_ptr<CylonContext> &ctx,
                           const DisSetOpConfig &config,
                           cylon::kernel::SetOpType op_type)
     : RootOp(ctx, schema, id, callback) {
-  auto execution = new ForkJoinExecution();
-  execution->AddLeft(this);
+  auto execution = ThreadPoolExecution::Make(ctx);
+  execution->AddOp(this);
   this->SetExecution(execution);
 
   const int32_t UNION_OP_ID = 4;
@@ -43,15 +43,15 @@ cylon::DisSetOp::DisSetOp(const std::shared_ptr<CylonContext> &ctx,
   partition_op = new PartitionOp(ctx, schema, LEFT_RELATION, callback,
                                  {ctx->GetWorldSize(), part_cols});
   this->AddChild(partition_op);
-  execution->AddLeft(partition_op);
+  execution->AddOp(partition_op);
 
   shuffle_op = new AllToAllOp(ctx, schema, LEFT_RELATION, callback, {});
   partition_op->AddChild(shuffle_op);
-  execution->AddLeft(shuffle_op);
+  execution->AddOp(shuffle_op);
 
   split_op = new SplitOp(ctx, schema, LEFT_RELATION, callback, {config.GetLeftSplits(), {0}});
   shuffle_op->AddChild(split_op);
-  execution->AddLeft(split_op);
+  execution->AddOp(split_op);
 
   // add join op
   SetOpConfig set_config;
@@ -65,21 +65,21 @@ cylon::DisSetOp::DisSetOp(const std::shared_ptr<CylonContext> &ctx,
     LOG(FATAL) << "Unsupported optype " << op_type;
   }
   split_op->AddChild(set_op);
-  execution->AddFinal(set_op);
+  execution->AddOp(set_op);
 
   // build right sub tree
   partition_op = new PartitionOp(ctx, schema, RIGHT_RELATION, callback,
                                  {ctx->GetWorldSize(), part_cols});
   this->AddChild(partition_op);
-  execution->AddRight(partition_op);
+  execution->AddOp(partition_op);
 
   shuffle_op = new AllToAllOp(ctx, schema, RIGHT_RELATION, callback, {});
   partition_op->AddChild(shuffle_op);
-  execution->AddRight(shuffle_op);
+  execution->AddOp(shuffle_op);
 
   split_op = new SplitOp(ctx, schema, RIGHT_RELATION, callback, {config.GetRightSplits(), {0}});
   shuffle_op->AddChild(split_op);
-  execution->AddRight(split_op);
+  execution->AddOp(split_op);
 
   split_op->AddChild(set_op); // join_op is already initialized
 }
@@ -12,11 +12,18 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include <cylon/ops/execution/execution.hpp>
 #include <cylon/ops/api/parallel_op.hpp>
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/util/parallel.hpp>
 
 namespace cylon {
 
+static constexpr std::chrono::microseconds kMinBackoff{10};
+static constexpr std::chrono::microseconds kMaxBackoff{1000};
+
 bool RoundRobinExecution::IsComplete() {
   bool completed = ops[indices[current_index]]->IsComplete();
   if (completed) {
@@ -126,4 +133,182 @@ bool SequentialExecution::IsComplete() {
   return this->ops.empty();
 }
 
-}
\ No newline at end of file
+ThreadPoolExecution::ThreadPoolExecution(int num_threads) : num_threads_(std::max(1, num_threads)) {
+  for (int i = 0; i < num_threads_; i++) {
+    workers_.emplace_back(new Worker());
+  }
+}
+
+ThreadPoolExecution *ThreadPoolExecution::Make(const std::shared_ptr<CylonContext> &ctx) {
+  const auto &config = ctx->GetConfig(kOpThreadsConfig);
+  return new ThreadPoolExecution(config.empty() ? 1 : util::GetNumThreads(std::stoi(config)));
+}
+
+ThreadPoolExecution::~ThreadPoolExecution() {
+  Stop();
+  // NOTE: ops_[0] is the head op which holds this execution object.
+  // So, don't delete that!
+  for (size_t i = 1; i < ops_.size(); i++) {
+    delete ops_[i];
+  }
+}
+
+void ThreadPoolExecution::AddOp(cylon::Op *op) {
+  ops_.push_back(op);
+  if (op->IsCommunicationOp()) {
+    comm_ops_.push_back(op);
+  } else {
+    workers_[num_compute_ops_ % workers_.size()]->ops.push_back(op);
+    num_compute_ops_++;
+  }
+  remaining_++;
+}
+
+bool ThreadPoolExecution::IsComplete() {
+  if (!started_) {
+    Start();
+  }
+  ProgressCommunication();
+  if (remaining_.load() == 0) {
+    Stop();
+    return true;
+  }
+  return false;
+}
+
+void ThreadPoolExecution::WaitForCompletion() {
+  if (!started_) {
+    Start();
+  }
+  auto backoff = kMinBackoff;
+  while (remaining_.load() > 0) {
+    const auto epoch = Epoch();
+    if (ProgressCommunication()) {
+      backoff = kMinBackoff;
+    } else if (remaining_.load() > 0) {
+      Idle(epoch, backoff);
+    }
+  }
+  Stop();
+}
+
+void ThreadPoolExecution::Start() {
+  started_ = true;
+  for (int i = 0; i < num_threads_; i++) {
+    threads_.emplace_back(&ThreadPoolExecution::RunWorker, this, i);
+  }
+}
+
+void ThreadPoolExecution::Stop() {
+  stop_ = true;
+  Notify();
+  for (auto &t: threads_) {
+    t.join();
+  }
+  threads_.clear();
+}
+
+bool ThreadPoolExecution::ProgressCommunication() {
+  bool did_work = false;
+  for (auto it = comm_ops_.begin(); it != comm_ops_.end();) {
+    if ((*it)->IsComplete()) {
+      it = comm_ops_.erase(it);
+      remaining_--;
+      did_work = true;
+    } else {
+      did_work |= (*it)->DidSomeWork();
+      it++;
+    }
+  }
+  if (did_work) {
+    Notify();
+  }
+  return did_work;
+}
+
+void ThreadPoolExecution::RunWorker(size_t index) {
+  auto backoff = kMinBackoff;
+  // ops progressed without doing any work, since the epoch
+  size_t idle_ops = 0;
+  uint64_t epoch = Epoch();
+  while (!stop_.load()) {
+    Op *op = Take(index);
+    if (op == nullptr) {
+      Idle(epoch, backoff);
+      idle_ops = 0;
+      epoch = Epoch();
+      continue;
+    }
+
+    if (op->IsComplete()) {
+      remaining_--;
+    } else {
+      // once put back, the op can be taken by another worker
+      const bool did_work = op->DidSomeWork();
+      Put(index, op);
+      if (!did_work) {
+        // a pass over all the ops without any work
+        if (++idle_ops >= num_compute_ops_) {
+          Idle(epoch, backoff);
+          idle_ops = 0;
+          epoch = Epoch();
+        }
+        continue;
+      }
+    }
+    Notify();
+    backoff = kMinBackoff;
+    idle_ops = 0;
+    epoch = Epoch();
+  }
+}
+
+Op *ThreadPoolExecution::Take(size_t index) {
+  {
+    auto &worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (!worker.ops.empty()) {
+      Op *op = worker.ops.front();
+      worker.ops.pop_front();
+      return op;
+    }
+  }
+  // steal from the back of the other workers
+  for (size_t i = 1; i < workers_.size(); i++) {
+    auto &victim = *workers_[(index + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.ops.empty()) {
+      Op *op = victim.ops.back();
+      victim.ops.pop_back();
+      return op;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPoolExecution::Put(size_t index, Op *op) {
+  auto &worker = *workers_[index];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  worker.ops.push_back(op);
+}
+
+uint64_t ThreadPoolExecution::Epoch() {
+  std::lock_guard<std::mutex> lock(idle_mutex_);
+  return epoch_;
+}
+
+void ThreadPoolExecution::Idle(uint64_t epoch, std::chrono::microseconds &backoff) {
+  std::unique_lock<std::mutex> lock(idle_mutex_);
+  bool notified = idle_cv_.wait_for(lock, backoff, [&] { return epoch_ != epoch || stop_.load(); });
+  backoff = notified ? kMinBackoff : std::min(backoff * 2, kMaxBackoff);
+}
+
+void ThreadPoolExecution::Notify() {
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    epoch_++;
+  }
+  idle_cv_.notify_all();
+}
+
+}
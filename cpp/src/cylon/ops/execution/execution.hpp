@@ -15,6 +15,13 @@
 #ifndef CYLON_SRC_CYLON_OPS_EXECUTION_HPP_
 #define CYLON_SRC_CYLON_OPS_EXECUTION_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <queue>
 #include <cstdint>
@@ -23,6 +30,7 @@
 namespace cylon {
 
 class Op;
+class CylonContext;
 
 // todo keep these in a tree structure rather than adhoc vectors and attach it to cylon::Op::AddChild methods
 class Execution {
@@ -30,9 +38,9 @@ class Execution {
   virtual ~Execution() = default;
 
   virtual bool IsComplete() = 0;
-  void WaitForCompletion() {
+  virtual void WaitForCompletion() {
     while (!this->IsComplete()) {
-
+      std::this_thread::yield();
     }
   }
 };
@@ -95,6 +103,84 @@ class PriorityExecution : public Execution {
   bool IsComplete() override;
 };
 
+/**
+ * CylonContext config for the number of worker threads of a ThreadPoolExecution. Defaults to 1, and a
+ * value <= 0 uses all hardware threads.
+ */
+constexpr const char *kOpThreadsConfig = "op_threads";
+
+/**
+ * This execution progresses the Ops on a pool of worker threads, so that compute Ops (partition,
+ * split, join etc.) on different tables run concurrently. Each Op is progressed by one thread at a
+ * time: the Ops are kept in per worker queues, and idle workers steal Ops from the others.
+ *
+ * Communication Ops (Op::IsCommunicationOp) are progressed by the thread that waits for the
+ * execution (the thread that initialized the communicator), which drives the network.
+ *
+ * Threads that do not make progress back off, from yielding up to sleeping for kMaxBackoff, and are
+ * woken up when an Op did some work.
+ */
+class ThreadPoolExecution : public Execution {
+ public:
+  explicit ThreadPoolExecution(int num_threads = 1);
+
+  /**
+   * Execution with the number of threads of the kOpThreadsConfig of the context
+   */
+  static ThreadPoolExecution *Make(const std::shared_ptr<CylonContext> &ctx);
+
+  ~ThreadPoolExecution() override;
+
+  /**
+   * Adds an Op to be progressed. As in the other executions, the first Op is the head Op, which holds
+   * this execution, and the others are deleted with the execution.
+   */
+  void AddOp(Op *op);
+
+  /**
+   * Starts the workers, if they are not running, and progresses the communication Ops once
+   * @return true if all the Ops are complete
+   */
+  bool IsComplete() override;
+
+  void WaitForCompletion() override;
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Op *> ops;
+  };
+
+  void Start();
+  void Stop();
+  // progresses the communication Ops once, and returns true if any of them did some work
+  bool ProgressCommunication();
+  void RunWorker(size_t index);
+  Op *Take(size_t index);
+  void Put(size_t index, Op *op);
+  uint64_t Epoch();
+  // waits until there is a notification after epoch, or for backoff. Resets the backoff if notified
+  // and doubles it otherwise
+  void Idle(uint64_t epoch, std::chrono::microseconds &backoff);
+  void Notify();
+
+  int num_threads_;
+  std::vector<Op *> ops_;
+  std::vector<Op *> comm_ops_;
+  size_t num_compute_ops_ = 0;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  bool started_ = false;
+
+  // ops that are not complete
+  std::atomic<int64_t> remaining_{0};
+  std::atomic<bool> stop_{false};
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;
+  // increased on every notification, so that waiting threads do not miss work done before they wait
+  uint64_t epoch_ = 0;
+};
+
 /**
  * This execution performs a BFS over the Op graph
  */
@@ -19,17 +19,26 @@
 
 cylon::JoinOp::JoinOp(const std::shared_ptr<CylonContext> &ctx,
                       const std::shared_ptr<arrow::Schema> &schema,
+                      const std::shared_ptr<arrow::Schema> &right_schema,
                       int32_t id,
                       const ResultsCallback &callback,
                       const cylon::join::config::JoinConfig &config)
     : Op(ctx, schema, id, callback) {
   // initialize join kernel
-  join_kernel_ = new cylon::kernel::JoinKernel(ctx, schema, &config);
+  join_kernel_ = new cylon::kernel::JoinKernel(ctx, schema, right_schema, &config);
 }
 
 bool cylon::JoinOp::Execute(int tag, std::shared_ptr<Table> &table) {
-  // do join
-  join_kernel_->InsertTable(tag, table);
+  // do join, with the tables of the other relation received so far
+  std::shared_ptr<cylon::Table> joined;
+  const Status &status = join_kernel_->InsertTable(tag, table, &joined);
+  if (!status.is_ok()) {
+    // returning false would retry the same table forever
+    LOG(FATAL) << "join failed: " << status.get_msg();
+  }
+  if (joined != nullptr) {
+    this->InsertToAllChildren(0, joined);
+  }
   return true;
 }
 
@@ -41,7 +50,10 @@ bool cylon::JoinOp::Finalize() {
   auto t1 = std::chrono::high_resolution_clock::now();
   // return finalize join
   std::shared_ptr<cylon::Table> final_result;
-  this->join_kernel_->Finalize(final_result);
+  const Status &status = this->join_kernel_->Finalize(final_result);
+  if (!status.is_ok()) {
+    LOG(FATAL) << "join finalize failed: " << status.get_msg();
+  }
   this->InsertToAllChildren(0, final_result);
   auto t2 = std::chrono::high_resolution_clock::now();
   LOG(INFO) << "Join time : "
@@ -20,12 +20,18 @@
 
 namespace cylon {
 
+/**
+ * Joins the tables of the left (tag 100) and right (tag 200) relations as they arrive, and sends
+ * the joined tables to the children right away. The unmatched rows of outer joins are sent when
+ * the Op finalizes.
+ */
 class JoinOp : public Op {
  private:
   cylon::kernel::JoinKernel *join_kernel_;
  public:
   JoinOp(const std::shared_ptr<CylonContext> &ctx,
          const std::shared_ptr<arrow::Schema> &schema,
+         const std::shared_ptr<arrow::Schema> &right_schema,
          int32_t  id,
          const ResultsCallback &callback,
          const cylon::join::config::JoinConfig &config);
@@ -12,49 +12,185 @@
  * limitations under the License.
  */
 
-#include <glog/logging.h>
-
 #include <cylon/table.hpp>
+#include <cylon/arrow/arrow_comparator.hpp>
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/join/join_utils.hpp>
 #include <cylon/ops/kernels/join_kernel.hpp>
+#include <cylon/util/arrow_utils.hpp>
 
 namespace cylon {
 namespace kernel {
 
+namespace {
+// whether the unmatched rows of a relation (0: left, 1: right) are a part of the join
+bool KeepsUnmatched(join::config::JoinType type, int relation) {
+  switch (type) {
+    case join::config::LEFT:return relation == 0;
+    case join::config::RIGHT:return relation == 1;
+    case join::config::FULL_OUTER:return true;
+    default:return false;
+  }
+}
+
+Status ConcatTables(const std::shared_ptr<CylonContext> &ctx,
+                    const std::vector<std::shared_ptr<arrow::Table>> &tables,
+                    std::shared_ptr<Table> *out) {
+  if (tables.size() == 1) {
+    return Table::FromArrowTable(ctx, tables[0], *out);
+  }
+  CYLON_ASSIGN_OR_RAISE(auto concat_tables,
+                        arrow::ConcatenateTables(tables,
+                                                 arrow::ConcatenateTablesOptions::Defaults(),
+                                                 ToArrowPool(ctx)))
+  return Table::FromArrowTable(ctx, std::move(concat_tables), *out);
+}
+}  // namespace
+
 JoinKernel::JoinKernel(const std::shared_ptr<cylon::CylonContext> &ctx,
-                       const std::shared_ptr<arrow::Schema> &schema,
+                       const std::shared_ptr<arrow::Schema> &left_schema,
+                       const std::shared_ptr<arrow::Schema> &right_schema,
                        const cylon::join::config::JoinConfig *join_config)
-    : ctx(ctx), schema(schema), join_config(join_config) {}
+    : ctx(ctx), schemas{left_schema, right_schema}, join_config(join_config) {}
+
+Status JoinKernel::BuildJoined(int relation, const std::vector<int64_t> &own_indices,
+                               const std::vector<int64_t> &other_indices,
+                               const std::shared_ptr<arrow::Table> &own_table,
+                               const std::shared_ptr<arrow::Table> &other_table,
+                               std::shared_ptr<arrow::Table> *out) {
+  auto *pool = ToArrowPool(ctx);
+  if (relation == 0) {
+    return join::util::build_final_table(own_indices, other_indices, own_table, other_table,
+                                         join_config->GetLeftTableSuffix(),
+                                         join_config->GetRightTableSuffix(), out, pool);
+  }
+  return join::util::build_final_table(other_indices, own_indices, other_table, own_table,
+                                       join_config->GetLeftTableSuffix(),
+                                       join_config->GetRightTableSuffix(), out, pool);
+}
 
-void JoinKernel::InsertTable(int tag, const std::shared_ptr<cylon::Table> &table) {
+Status JoinKernel::InsertTable(int tag, const std::shared_ptr<cylon::Table> &table,
+                               std::shared_ptr<cylon::Table> *joined) {
+  int relation;
   if (tag == 100) {
-    left_tables.push(table->get_table());
+    relation = 0;
   } else if (tag == 200) {
-    right_tables.push(table->get_table());
+    relation = 1;
   } else {
-    LOG(FATAL) << "Un-recognized tag " << tag;
+    return {Code::Invalid, "Un-recognized tag " + std::to_string(tag)};
+  }
+  *joined = nullptr;
+
+  const auto &atable = table->get_table();
+  const int64_t num_rows = atable->num_rows();
+  if (num_rows == 0) {
+    return Status::OK();
+  }
+  const auto &columns = relation == 0 ? join_config->GetLeftColumnIdx()
+                                      : join_config->GetRightColumnIdx();
+  const auto &other_columns = relation == 0 ? join_config->GetRightColumnIdx()
+                                            : join_config->GetLeftColumnIdx();
+  auto &own = relations[relation];
+  auto &other = relations[1 - relation];
+  const bool keep_own = KeepsUnmatched(join_config->GetType(), relation);
+  const bool keep_other = KeepsUnmatched(join_config->GetType(), 1 - relation);
+
+  std::unique_ptr<TableRowIndexHash> hash;
+  RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(atable, columns, &hash));
+
+  // probe the tables of the other relation. Rows of this table are compared as t1, and the rows of
+  // the other table as t2 (with the most significant bit set)
+  const size_t num_other = other.tables.size();
+  std::vector<std::unique_ptr<DualTableRowIndexEqualTo>> equal_to(num_other);
+  std::vector<std::vector<int64_t>> own_indices(num_other), other_indices(num_other);
+  std::vector<bool> matched(keep_own ? num_rows : 0, false);
+  for (int64_t i = 0; i < num_rows; i++) {
+    const auto &range = other.index.equal_range(static_cast<uint32_t>((*hash)(i)));
+    for (auto it = range.first; it != range.second; it++) {
+      const int32_t t = it->second.first;
+      const int64_t row = it->second.second;
+      if (equal_to[t] == nullptr) {
+        RETURN_CYLON_STATUS_IF_FAILED(DualTableRowIndexEqualTo::Make(atable, other.tables[t], columns,
+                                                                     other_columns, &equal_to[t]));
+      }
+      if ((*equal_to[t])(i, util::SetBit(row))) {
+        own_indices[t].push_back(i);
+        other_indices[t].push_back(row);
+        if (keep_own) {
+          matched[i] = true;
+        }
+        if (keep_other) {
+          other.matched[t][row] = true;
+        }
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<arrow::Table>> joined_tables;
+  for (size_t t = 0; t < num_other; t++) {
+    if (!own_indices[t].empty()) {
+      std::shared_ptr<arrow::Table> out;
+      RETURN_CYLON_STATUS_IF_FAILED(BuildJoined(relation, own_indices[t], other_indices[t], atable,
+                                                other.tables[t], &out));
+      joined_tables.push_back(std::move(out));
+    }
+  }
+
+  // index this table for the tables of the other relation that arrive later
+  const auto table_id = static_cast<int32_t>(own.tables.size());
+  own.index.reserve(own.index.size() + num_rows);
+  for (int64_t i = 0; i < num_rows; i++) {
+    own.index.emplace(static_cast<uint32_t>((*hash)(i)), std::make_pair(table_id, i));
   }
+  own.tables.push_back(atable);
+  own.matched.push_back(std::move(matched));
+
+  if (joined_tables.empty()) {
+    return Status::OK();
+  }
+  return ConcatTables(ctx, joined_tables, joined);
 }
 
 cylon::Status JoinKernel::Finalize(std::shared_ptr<cylon::Table> &result) {
-  size_t kI = left_tables.size();
-  std::vector<std::shared_ptr<arrow::Table>> joined_tables;
   arrow::MemoryPool *kPool = cylon::ToArrowPool(this->ctx);
-  for (size_t i = 0; i < kI; i++) {
-    std::shared_ptr<arrow::Table> left_tab = left_tables.front();
-    std::shared_ptr<arrow::Table> right_tab = right_tables.front();
-    std::shared_ptr<arrow::Table> out;
-    RETURN_CYLON_STATUS_IF_FAILED(join::JoinTables(left_tab, right_tab, *join_config, &out, kPool));
-    left_tables.pop();
-    right_tables.pop();
-    joined_tables.push_back(out);
+  std::vector<std::shared_ptr<arrow::Table>> joined_tables;
+  for (int relation = 0; relation < 2; relation++) {
+    if (!KeepsUnmatched(join_config->GetType(), relation)) {
+      continue;
+    }
+    const auto &own = relations[relation];
+    std::shared_ptr<arrow::Table> empty_other;
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::CreateEmptyTable(schemas[1 - relation], &empty_other,
+                                                               kPool));
+    for (size_t t = 0; t < own.tables.size(); t++) {
+      std::vector<int64_t> own_indices;
+      for (size_t row = 0; row < own.matched[t].size(); row++) {
+        if (!own.matched[t][row]) {
+          own_indices.push_back(static_cast<int64_t>(row));
+        }
+      }
+      if (own_indices.empty()) {
+        continue;
+      }
+      const std::vector<int64_t> other_indices(own_indices.size(), -1);
+      std::shared_ptr<arrow::Table> out;
+      RETURN_CYLON_STATUS_IF_FAILED(BuildJoined(relation, own_indices, other_indices,
+                                                own.tables[t], empty_other, &out));
+      joined_tables.push_back(std::move(out));
+    }
+  }
+
+  // an empty table, with the schema of the join
+  if (joined_tables.empty()) {
+    std::shared_ptr<arrow::Table> empty_left, empty_right, out;
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::CreateEmptyTable(schemas[0], &empty_left, kPool));
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::CreateEmptyTable(schemas[1], &empty_right, kPool));
+    RETURN_CYLON_STATUS_IF_FAILED(BuildJoined(0, {}, {}, empty_left, empty_right, &out));
+    joined_tables.push_back(std::move(out));
   }
-  CYLON_ASSIGN_OR_RAISE(auto concat_tables,
-                        arrow::ConcatenateTables(joined_tables,
-                                                 arrow::ConcatenateTablesOptions::Defaults(),
-                                                 kPool));
 
-  return Table::FromArrowTable(ctx, std::move(concat_tables), result);
+  relations = {};
+  return ConcatTables(ctx, joined_tables, &result);
 }
 
 }  // namespace kernel
@@ -16,25 +16,67 @@
 #define CYLON_SRC_CYLON_OPS_KERNELS_JOIN_H_
 
 #include <arrow/api.h>
-#include <queue>
+#include <array>
+#include <unordered_map>
+#include <vector>
 
 #include <cylon/ctx/cylon_context.hpp>
+#include <cylon/join/join_config.hpp>
 
 namespace cylon {
 namespace kernel {
+
+/**
+ * Streaming (symmetric) hash join. Tables of both relations can arrive in any order. Each table
+ * probes the rows of the other relation that arrived so far, the matches are returned right away,
+ * and then the table is added to the hash index of its own relation. Rows that did not match, for
+ * left, right and full outer joins, are only known after both relations are complete, and they are
+ * returned by Finalize.
+ */
 class JoinKernel {
  private:
+  // tables and hash index of a relation
+  struct Relation {
+    std::vector<std::shared_ptr<arrow::Table>> tables;
+    // rows that matched a row of the other relation, only tracked if unmatched rows are returned
+    std::vector<std::vector<bool>> matched;
+    // row hash -> (table, row)
+    std::unordered_multimap<uint32_t, std::pair<int32_t, int64_t>> index;
+  };
+
   std::shared_ptr<CylonContext> ctx;
-  std::shared_ptr<arrow::Schema> schema;
+  std::array<std::shared_ptr<arrow::Schema>, 2> schemas;
   const cylon::join::config::JoinConfig *join_config;
-  std::queue<std::shared_ptr<arrow::Table>> left_tables{};
-  std::queue<std::shared_ptr<arrow::Table>> right_tables{};
+  std::array<Relation, 2> relations{};
+
+  // joined table of left and right rows, -1 for null rows
+  Status BuildJoined(int relation, const std::vector<int64_t> &own_indices,
+                     const std::vector<int64_t> &other_indices,
+                     const std::shared_ptr<arrow::Table> &own_table,
+                     const std::shared_ptr<arrow::Table> &other_table,
+                     std::shared_ptr<arrow::Table> *out);
 
  public:
   JoinKernel(const std::shared_ptr<cylon::CylonContext> &ctx,
-             const std::shared_ptr<arrow::Schema> &schema,
+             const std::shared_ptr<arrow::Schema> &left_schema,
+             const std::shared_ptr<arrow::Schema> &right_schema,
              const cylon::join::config::JoinConfig *join_config);
-  void InsertTable(int tag, const std::shared_ptr<cylon::Table> &table);
+
+  /**
+   * Joins a table of a relation with the tables of the other relation received so far
+   * @param tag 100 for the left relation and 200 for the right relation
+   * @param table
+   * @param joined the matching rows, or nullptr if there are none
+   * @return
+   */
+  Status InsertTable(int tag, const std::shared_ptr<cylon::Table> &table,
+                     std::shared_ptr<cylon::Table> *joined);
+
+  /**
+   * Rows of the outer relation(s) without a match. Empty for inner joins.
+   * @param result
+   * @return
+   */
   cylon::Status Finalize(std::shared_ptr<cylon::Table> &result);
 };
 }
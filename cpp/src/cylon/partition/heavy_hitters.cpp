@@ -0,0 +1,214 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glog/logging.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <set>
+
+#include <arrow/api.h>
+
+#include <cylon/partition/heavy_hitters.hpp>
+#include <cylon/column.hpp>
+#include <cylon/ctx/arrow_memory_pool_utils.hpp>
+#include <cylon/net/communicator.hpp>
+#include <cylon/util/macros.hpp>
+
+namespace cylon {
+
+/**
+ * Counts the hashes of evenly spaced rows
+ * @return number of sampled rows
+ */
+static int64_t SampleHashes(const std::vector<uint32_t> &hashes,
+                            std::unordered_map<uint32_t, int64_t> *counts) {
+  const auto rows = static_cast<int64_t>(hashes.size());
+  const int64_t n = std::min(rows, kHeavyHitterSampleSize);
+  counts->reserve(n);
+  for (int64_t i = 0; i < n; i++) {
+    (*counts)[hashes[i * rows / n]]++;
+  }
+  return n;
+}
+
+/**
+ * Adds the most frequent sampled hashes (seen more than once) to the candidates
+ */
+static void AddCandidates(const std::unordered_map<uint32_t, int64_t> &counts,
+                          std::set<uint32_t> *candidates) {
+  std::vector<std::pair<int64_t, uint32_t>> frequent;
+  for (const auto &c: counts) {
+    if (c.second > 1) {
+      frequent.emplace_back(c.second, c.first);
+    }
+  }
+  const size_t k = std::min(frequent.size(), kHeavyHitterCandidates);
+  std::partial_sort(frequent.begin(), frequent.begin() + k, frequent.end(),
+                    std::greater<std::pair<int64_t, uint32_t>>());
+  for (size_t i = 0; i < k; i++) {
+    candidates->insert(frequent[i].second);
+  }
+}
+
+static int64_t EstimateRows(const std::unordered_map<uint32_t, int64_t> &counts, uint32_t hash,
+                            int64_t rows, int64_t n) {
+  const auto &it = counts.find(hash);
+  return it == counts.end() ? 0 : it->second * rows / n;
+}
+
+Status FindJoinHeavyHitters(const std::shared_ptr<CylonContext> &ctx,
+                            const std::vector<uint32_t> &left_hashes,
+                            const std::vector<uint32_t> &right_hashes,
+                            bool can_split_left,
+                            bool can_split_right,
+                            HeavyHitters *heavy_hitters) {
+  heavy_hitters->clear();
+  if (!can_split_left && !can_split_right) {
+    return Status::OK();
+  }
+  const auto left_rows = static_cast<int64_t>(left_hashes.size());
+  const auto right_rows = static_cast<int64_t>(right_hashes.size());
+
+  std::unordered_map<uint32_t, int64_t> left_counts, right_counts;
+  const int64_t left_n = SampleHashes(left_hashes, &left_counts);
+  const int64_t right_n = SampleHashes(right_hashes, &right_counts);
+
+  std::set<uint32_t> candidates;
+  AddCandidates(left_counts, &candidates);
+  AddCandidates(right_counts, &candidates);
+
+  // proposal of this worker: |left rows, right rows|hash, est. left rows, est. right rows|...
+  arrow::Int64Builder builder(ToArrowPool(ctx));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.Reserve(2 + 3 * candidates.size()));
+  builder.UnsafeAppend(left_rows);
+  builder.UnsafeAppend(right_rows);
+  for (uint32_t hash: candidates) {
+    builder.UnsafeAppend(hash);
+    builder.UnsafeAppend(EstimateRows(left_counts, hash, left_rows, left_n));
+    builder.UnsafeAppend(EstimateRows(right_counts, hash, right_rows, right_n));
+  }
+  CYLON_ASSIGN_OR_RAISE(auto local, builder.Finish())
+
+  std::vector<std::shared_ptr<Column>> proposals;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->Allgather(Column::Make(std::move(local)),
+                                                                  &proposals));
+
+  // ordered, so that every worker visits the hashes in the same order
+  std::map<uint32_t, std::pair<int64_t, int64_t>> global_rows;
+  int64_t global_left_rows = 0, global_right_rows = 0;
+  for (const auto &proposal: proposals) {
+    const auto &values = std::static_pointer_cast<arrow::Int64Array>(proposal->data());
+    global_left_rows += values->Value(0);
+    global_right_rows += values->Value(1);
+    for (int64_t i = 2; i + 2 < values->length(); i += 3) {
+      auto &rows = global_rows[static_cast<uint32_t>(values->Value(i))];
+      rows.first += values->Value(i + 1);
+      rows.second += values->Value(i + 2);
+    }
+  }
+
+  const auto num_partitions = static_cast<uint32_t>(ctx->GetWorldSize());
+  const double avg_left_rows = std::max<double>(1, (double) global_left_rows / num_partitions);
+  const double avg_right_rows = std::max<double>(1, (double) global_right_rows / num_partitions);
+  for (const auto &g: global_rows) {
+    // number of average partitions worth of rows
+    const double left_share = g.second.first / avg_left_rows;
+    const double right_share = g.second.second / avg_right_rows;
+
+    const bool split_left = can_split_left && (!can_split_right || left_share >= right_share);
+    const double share = split_left ? left_share : right_share;
+    if (share <= kHeavyHitterRatio) {
+      continue;
+    }
+
+    const auto split = static_cast<uint32_t>(std::ceil(share / kHeavyHitterRatio));
+    heavy_hitters->emplace(g.first, HeavyHitter{g.first % num_partitions,
+                                                std::max(2u, std::min(split, num_partitions)),
+                                                split_left});
+  }
+
+  LOG_IF(INFO, ctx->GetRank() == 0 && !heavy_hitters->empty())
+  << "Skew-aware shuffle: " << heavy_hitters->size() << " heavy hitters of "
+  << global_rows.size() << " candidates";
+  return Status::OK();
+}
+
+SkewAwarePartitioner::SkewAwarePartitioner(std::vector<uint32_t> row_hashes,
+                                           const HeavyHitters &heavy_hitters,
+                                           bool left,
+                                           uint32_t num_partitions,
+                                           uint32_t rank)
+    : row_hashes_(std::move(row_hashes)),
+      heavy_hitters_(heavy_hitters),
+      left_(left),
+      num_partitions_(num_partitions),
+      rank_(rank) {}
+
+Status SkewAwarePartitioner::Partition(int64_t offset,
+                                       int64_t length,
+                                       std::vector<uint32_t> &target_partitions,
+                                       std::vector<uint32_t> &partition_hist,
+                                       std::vector<int64_t> &indices) {
+  if (offset < 0 || offset + length > (int64_t) row_hashes_.size()) {
+    return {Code::Invalid, "rows out of the range of the row hashes"};
+  }
+
+  target_partitions.clear();
+  target_partitions.reserve(length);
+  partition_hist.assign(num_partitions_, 0);
+  indices.clear();
+
+  auto emit = [&](uint32_t p) {
+    target_partitions.push_back(p);
+    partition_hist[p]++;
+  };
+
+  bool replicated = false;
+  for (int64_t i = 0; i < length; i++) {
+    const uint32_t hash = row_hashes_[offset + i];
+    const auto &it = heavy_hitters_.empty() ? heavy_hitters_.end() : heavy_hitters_.find(hash);
+    if (it == heavy_hitters_.end()) {
+      emit(hash % num_partitions_);
+      if (replicated) {
+        indices.push_back(i);
+      }
+    } else if (it->second.split_left == left_) {
+      const HeavyHitter &hh = it->second;
+      // workers start from different partitions, so that the first rows are not all sent to one
+      uint32_t &next = next_partition_.emplace(hash, rank_ % hh.num_partitions).first->second;
+      emit((hh.first_partition + next) % num_partitions_);
+      next = (next + 1) % hh.num_partitions;
+      if (replicated) {
+        indices.push_back(i);
+      }
+    } else {
+      const HeavyHitter &hh = it->second;
+      if (!replicated) {
+        replicated = true;
+        indices.resize(i);
+        std::iota(indices.begin(), indices.end(), 0);
+      }
+      for (uint32_t j = 0; j < hh.num_partitions; j++) {
+        emit((hh.first_partition + j) % num_partitions_);
+        indices.push_back(i);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace cylon
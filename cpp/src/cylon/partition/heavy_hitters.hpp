@@ -0,0 +1,130 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_PARTITION_HEAVY_HITTERS_HPP_
+#define CYLON_CPP_SRC_CYLON_PARTITION_HEAVY_HITTERS_HPP_
+
+#include <unordered_map>
+#include <vector>
+
+#include <cylon/ctx/cylon_context.hpp>
+#include <cylon/status.hpp>
+
+namespace cylon {
+
+/**
+ * Config key (in CylonContext) to enable ("true") the skew-aware shuffle of DistributedJoin.
+ * Must be the same in all workers.
+ */
+constexpr const char *kSkewAwareShuffleConfig = "skew_aware_shuffle";
+
+/**
+ * Number of row hashes sampled from each table in each worker to find the heavy hitters
+ */
+constexpr int64_t kHeavyHitterSampleSize = 4096;
+
+/**
+ * Number of most frequent sampled hashes of each table that a worker proposes as heavy hitters
+ */
+constexpr size_t kHeavyHitterCandidates = 32;
+
+/**
+ * A key hash is a heavy hitter if its (estimated, global) number of rows is more than this fraction
+ * of the average number of rows per partition
+ */
+constexpr double kHeavyHitterRatio = 0.5;
+
+/**
+ * Partitions that share the rows of a heavy-hitter key hash. These are num_partitions consecutive
+ * partitions (wrapping around) starting from the partition of the hash.
+ */
+struct HeavyHitter {
+  uint32_t first_partition;
+  uint32_t num_partitions;
+  // rows of the left table are split among the partitions and the rows of the right table are
+  // replicated to all of them, or the other way around
+  bool split_left;
+};
+
+using HeavyHitters = std::unordered_map<uint32_t, HeavyHitter>;
+
+/**
+ * Finds the heavy-hitter key hashes of a join. This is a collective operation.
+ *
+ * Each worker samples the row hashes of both tables and proposes its most frequent hashes, with
+ * their estimated row counts. The proposals of all workers are gathered and summed up, so that all
+ * workers arrive at the same heavy hitters. The table with the larger share of the rows of a heavy
+ * hitter (relative to its own average rows per partition) is split so that each partition gets at
+ * most kHeavyHitterRatio of the average, and the matching rows of the other table are replicated.
+ *
+ * Replicating a table duplicates its unmatched rows, so only a table whose unmatched rows are
+ * dropped by the join may be replicated, ie. split_left requires an inner or left join and
+ * !split_left an inner or right join.
+ * @param ctx
+ * @param left_hashes row hashes of the left table (HashRows)
+ * @param right_hashes row hashes of the right table
+ * @param can_split_left
+ * @param can_split_right
+ * @param heavy_hitters
+ * @return
+ */
+Status FindJoinHeavyHitters(const std::shared_ptr<CylonContext> &ctx,
+                            const std::vector<uint32_t> &left_hashes,
+                            const std::vector<uint32_t> &right_hashes,
+                            bool can_split_left,
+                            bool can_split_right,
+                            HeavyHitters *heavy_hitters);
+
+/**
+ * Maps the rows of one table of a join to partitions, using their hashes. Rows of a heavy hitter
+ * are distributed round robin among its partitions if the table is split, or replicated to all of
+ * them otherwise. Other rows go to hash % num_partitions.
+ */
+class SkewAwarePartitioner {
+ public:
+  SkewAwarePartitioner(std::vector<uint32_t> row_hashes,
+                       const HeavyHitters &heavy_hitters,
+                       bool left,
+                       uint32_t num_partitions,
+                       uint32_t rank);
+
+  /**
+   * Maps the rows [offset, offset + length) to partitions
+   * @param offset
+   * @param length
+   * @param target_partitions target partition of each output row
+   * @param partition_hist
+   * @param indices if some rows are replicated, the row (relative to offset) of each output row.
+   * empty otherwise, ie. the output rows are the input rows
+   * @return
+   */
+  Status Partition(int64_t offset,
+                   int64_t length,
+                   std::vector<uint32_t> &target_partitions,
+                   std::vector<uint32_t> &partition_hist,
+                   std::vector<int64_t> &indices);
+
+ private:
+  std::vector<uint32_t> row_hashes_;
+  const HeavyHitters &heavy_hitters_;
+  bool left_;
+  uint32_t num_partitions_;
+  uint32_t rank_;
+  // next partition (relative to first_partition) of each split heavy hitter
+  std::unordered_map<uint32_t, uint32_t> next_partition_;
+};
+
+}  // namespace cylon
+
+#endif //CYLON_CPP_SRC_CYLON_PARTITION_HEAVY_HITTERS_HPP_
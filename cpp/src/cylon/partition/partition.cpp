@@ -13,11 +13,11 @@
  */
 
 #include <glog/logging.h>
-#include <chrono>
 
 #include <cylon/arrow/arrow_kernels.hpp>
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
 #include <cylon/util/macros.hpp>
+#include <cylon/util/trace.hpp>
 #include <cylon/arrow/arrow_partition_kernels.hpp>
 #include <cylon/ops/kernels/partition.hpp>
 
@@ -28,9 +28,7 @@ static inline Status split_impl(const std::shared_ptr<Table> &table,
                                 const std::vector<uint32_t> &target_partitions,
                                 const std::vector<uint32_t> &partition_hist,
                                 std::vector<std::shared_ptr<arrow::Table>> &output) {
-#ifdef CYLON_DEBUG
-  auto t1 = std::chrono::high_resolution_clock::now();
-#endif
+  trace::Span span("partition.split");
   const std::shared_ptr<arrow::Table> &arrow_table = table->get_table();
   const auto& ctx = table->GetContext();
   arrow::MemoryPool *pool = cylon::ToArrowPool(ctx);
@@ -55,11 +53,6 @@ static inline Status split_impl(const std::shared_ptr<Table> &table,
     output.push_back(arrow::Table::Make(arrow_table->schema(), arr_vec));
   }
 
-#ifdef CYLON_DEBUG
-  auto t2 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Splitting table time : "
-            << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-#endif
   return Status::OK();
 }
 
@@ -95,9 +88,7 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
                            uint32_t num_partitions,
                            std::vector<uint32_t> &target_partitions,
                            std::vector<uint32_t> &partition_hist) {
-#ifdef CYLON_DEBUG
-  auto t1 = std::chrono::high_resolution_clock::now();
-#endif
+  trace::Span span("partition.hash");
   const std::shared_ptr<arrow::Table> &arrow_table = table->get_table();
   std::shared_ptr<arrow::ChunkedArray> idx_col = arrow_table->column(hash_column_idx);
 
@@ -111,10 +102,6 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
   partition_hist.resize(num_partitions, 0);
 
   const auto &status = kern->Partition(idx_col, num_partitions, target_partitions, partition_hist);
-#ifdef CYLON_DEBUG
-  auto t2 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Hash partition time : " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-#endif
   return status;
 }
 
@@ -123,9 +110,7 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
                            uint32_t num_partitions,
                            std::vector<uint32_t> &target_partitions,
                            std::vector<uint32_t> &partition_hist) {
-#ifdef CYLON_DEBUG
-  auto t1 = std::chrono::high_resolution_clock::now();
-#endif
+  trace::Span span("partition.hash");
   const std::shared_ptr<arrow::Table> &arrow_table = table->get_table();
 
   std::vector<std::unique_ptr<HashPartitionKernel>> partition_kernels;
@@ -145,16 +130,8 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
 
   // building hash without the last hash_column_idx
   for (size_t i = 0; i < hash_column_idx.size() - 1; i++) {
-#ifdef CYLON_DEBUG
-    auto t11 = std::chrono::high_resolution_clock::now();
-#endif
     RETURN_CYLON_STATUS_IF_FAILED(partition_kernels[i]->UpdateHash(arrow_table->column(hash_column_idx[i]),
                                                                    target_partitions));
-#ifdef CYLON_DEBUG
-    auto t12 = std::chrono::high_resolution_clock::now();
-    LOG(INFO) << "building hash (idx " << hash_column_idx[i] << ") time : "
-              << std::chrono::duration_cast<std::chrono::milliseconds>(t12 - t11).count();
-#endif
   }
 
   // build hash from the last hash_column_idx
@@ -162,13 +139,24 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
                                                            num_partitions,
                                                            target_partitions,
                                                            partition_hist);
-#ifdef CYLON_DEBUG
-  const auto &t2 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Partition time : " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-#endif
   return status;
 }
 
+Status HashRows(const std::shared_ptr<Table> &table,
+                const std::vector<int32_t> &hash_column_idx,
+                std::vector<uint32_t> &row_hashes) {
+  const std::shared_ptr<arrow::Table> &arrow_table = table->get_table();
+  row_hashes.assign(arrow_table->num_rows(), 0);
+
+  for (int i : hash_column_idx) {
+    const std::shared_ptr<arrow::ChunkedArray> &col = arrow_table->column(i);
+    std::unique_ptr<HashPartitionKernel> kern;
+    RETURN_CYLON_STATUS_IF_FAILED(CreateHashPartitionKernel(col->type(), &kern));
+    RETURN_CYLON_STATUS_IF_FAILED(kern->UpdateHash(col, row_hashes));
+  }
+  return Status::OK();
+}
+
 Status MapToSortPartitions(const std::shared_ptr<Table> &table,
                            int32_t column_idx,
                            uint32_t num_partitions,
@@ -177,9 +165,7 @@ Status MapToSortPartitions(const std::shared_ptr<Table> &table,
                            bool ascending,
                            uint64_t num_samples,
                            uint32_t num_bins) {
-#ifdef CYLON_DEBUG
-  auto t1 = std::chrono::high_resolution_clock::now();
-#endif
+  trace::Span span("partition.range");
   const auto &ctx = table->GetContext();
   const std::shared_ptr<arrow::Table> &arrow_table = table->get_table();
   std::shared_ptr<arrow::ChunkedArray> idx_col = arrow_table->column(column_idx);
@@ -197,10 +183,6 @@ Status MapToSortPartitions(const std::shared_ptr<Table> &table,
   partition_hist.resize(num_partitions, 0);
 
   const auto &status = kern->Partition(idx_col, num_partitions, target_partitions, partition_hist);
-#ifdef CYLON_DEBUG
-  auto t2 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Sort partition time : " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-#endif
   return status;
 }
 
@@ -41,6 +41,19 @@ Status MapToHashPartitions(const std::shared_ptr<Table> &table,
                            std::vector<uint32_t> &target_partitions,
                            std::vector<uint32_t> &partition_histogram);
 
+/**
+ * Computes the hash of each row over the hash columns (the hashes of TableRowIndexHash).
+ * MapToHashPartitions combines the columns the same way, and maps a row to the partition
+ * hash % num_partitions. Rows with equal keys get equal hashes, in every worker.
+ * @param table
+ * @param hash_column_idx
+ * @param row_hashes
+ * @return
+ */
+Status HashRows(const std::shared_ptr<Table> &table,
+                const std::vector<int32_t> &hash_column_idx,
+                std::vector<uint32_t> &row_hashes);
+
 /**
  * Sorted partitioning of the distributed table
  * @param table
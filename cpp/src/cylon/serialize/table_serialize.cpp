@@ -20,11 +20,12 @@
 
 #include "cylon/arrow/arrow_buffer.hpp"
 #include "cylon/arrow/arrow_types.hpp"
+#include "cylon/util/macros.hpp"
 
 namespace cylon {
 
 template<int buf_idx = 0>
-Status CollectBitmapInfo(const arrow::ArrayData &data, int32_t *buffer_sizes,
+Status CollectBitmapInfo(const arrow::ArrayData &data, int64_t *buffer_sizes,
                          const uint8_t **data_buffers,
                          arrow::BufferVector *bitmaps_with_offset,
                          arrow::MemoryPool *pool) {
@@ -35,7 +36,7 @@ Status CollectBitmapInfo(const arrow::ArrayData &data, int32_t *buffer_sizes,
   }
 
   // there are nulls
-  *buffer_sizes = (int32_t) arrow::BitUtil::BytesForBits(data.length);
+  *buffer_sizes = arrow::BitUtil::BytesForBits(data.length);
   if (data.offset == 0) { // no offset
     *data_buffers = data.buffers[buf_idx]->data();
   } else if (data.offset % CHAR_BIT == 0) { // offset is at a byte boundary
@@ -51,7 +52,7 @@ Status CollectBitmapInfo(const arrow::ArrayData &data, int32_t *buffer_sizes,
   return Status::OK();
 }
 
-Status CollectDataBuffer(const arrow::ArrayData &data, int32_t *buffer_sizes,
+Status CollectDataBuffer(const arrow::ArrayData &data, int64_t *buffer_sizes,
                          const uint8_t **data_buffers,
                          arrow::BufferVector *bitmaps_with_offset,
                          arrow::MemoryPool *pool) {
@@ -62,7 +63,7 @@ Status CollectDataBuffer(const arrow::ArrayData &data, int32_t *buffer_sizes,
 
   if (arrow::is_fixed_width(type->id())) {
     int byte_width = std::static_pointer_cast<arrow::FixedWidthType>(type)->bit_width() / CHAR_BIT;
-    *buffer_sizes = byte_width * (int) data.length;
+    *buffer_sizes = byte_width * data.length;
     *data_buffers = data.buffers[1]->data() + data.offset * byte_width;
     return Status::OK();
   }
@@ -76,8 +77,8 @@ Status CollectDataBuffer(const arrow::ArrayData &data, int32_t *buffer_sizes,
   }
 
   if (arrow::is_large_binary_like(type->id())) {
-    int start_offset = (int) data.GetValues<int64_t>(1)[0];
-    int end_offset = (int) data.GetValues<int64_t>(1)[data.length];
+    int64_t start_offset = data.GetValues<int64_t>(1)[0];
+    int64_t end_offset = data.GetValues<int64_t>(1)[data.length];
     *buffer_sizes = end_offset - start_offset;
     *data_buffers = data.buffers[2]->data() + start_offset;
     return Status::OK();
@@ -87,7 +88,7 @@ Status CollectDataBuffer(const arrow::ArrayData &data, int32_t *buffer_sizes,
 }
 
 Status CollectOffsetBuffer(const arrow::ArrayData &data,
-                           int32_t *buffer_sizes,
+                           int64_t *buffer_sizes,
                            const uint8_t **data_buffers) {
   const auto &type = data.type;
   if (arrow::is_fixed_width(type->id())) {
@@ -97,13 +98,13 @@ Status CollectOffsetBuffer(const arrow::ArrayData &data,
   }
 
   if (arrow::is_binary_like(type->id())) {
-    *buffer_sizes = (int) ((data.length + 1) * sizeof(int32_t));
+    *buffer_sizes = (data.length + 1) * static_cast<int64_t>(sizeof(int32_t));
     *data_buffers = reinterpret_cast<const uint8_t *>(data.GetValues<int32_t>(1));
     return Status::OK();
   }
 
   if (arrow::is_large_binary_like(type->id())) {
-    *buffer_sizes = (int) ((data.length + 1) * sizeof(int64_t));
+    *buffer_sizes = (data.length + 1) * static_cast<int64_t>(sizeof(int64_t));
     *data_buffers = reinterpret_cast<const uint8_t *>(data.GetValues<int64_t>(1));
     return Status::OK();
   }
@@ -121,7 +122,7 @@ Status CylonTableSerializer::Make(const std::shared_ptr<Table> &table,
   auto atable = table->get_table();
   auto pool = ToArrowPool(table->GetContext());
 
-  std::vector<int32_t> buffer_sizes(num_buffers, 0);
+  std::vector<int64_t> buffer_sizes(num_buffers, 0);
   std::vector<const uint8_t *> data_buffers(num_buffers, nullptr);
 
   if (table->Rows()) {
@@ -149,7 +150,7 @@ Status CylonTableSerializer::Make(const std::shared_ptr<Table> &table,
 }
 
 CylonTableSerializer::CylonTableSerializer(std::shared_ptr<arrow::Table> table,
-                                           std::vector<int32_t> buffer_sizes,
+                                           std::vector<int64_t> buffer_sizes,
                                            std::vector<const uint8_t *> data_buffers,
                                            arrow::BufferVector extra_buffers)
     : table_(std::move(table)),
@@ -171,16 +172,16 @@ std::vector<int32_t> CylonTableSerializer::getDataTypes() {
   return data_types;
 }
 
-std::vector<int32_t> CylonTableSerializer::getEmptyTableBufferSizes() {
-  return std::vector<int32_t>(num_buffers_, 0);
+std::vector<int64_t> CylonTableSerializer::getEmptyTableBufferSizes() {
+  return std::vector<int64_t>(num_buffers_, 0);
 }
 
 const arrow::BufferVector &CylonTableSerializer::extra_buffers() const {
   return extra_buffers_;
 }
 
-int32_t CalculateNumRows(const std::shared_ptr<arrow::DataType> &type,
-                         const std::array<int32_t, 3> &buffer_sizes) {
+int64_t CalculateNumRows(const std::shared_ptr<arrow::DataType> &type,
+                         const std::array<int64_t, 3> &buffer_sizes) {
   if (type->id() == arrow::Type::BOOL) {
     return -1; // bool arrays can not compute rows!
   }
@@ -192,18 +193,18 @@ int32_t CalculateNumRows(const std::shared_ptr<arrow::DataType> &type,
   }
 
   if (arrow::is_binary_like(type->id())) {
-    return int(buffer_sizes[1] / sizeof(int32_t)) - 1;
+    return static_cast<int64_t>(buffer_sizes[1] / sizeof(int32_t)) - 1;
   }
 
   if (arrow::is_large_binary_like(type->id())) {
-    return int(buffer_sizes[1] / sizeof(int64_t)) - 1;
+    return static_cast<int64_t>(buffer_sizes[1] / sizeof(int64_t)) - 1;
   }
 
   return -1;
 }
 
-int32_t CalculateNumRows(const std::shared_ptr<arrow::Schema> &schema,
-                         const std::vector<int32_t> &buffer_sizes) {
+int64_t CalculateNumRows(const std::shared_ptr<arrow::Schema> &schema,
+                         const std::vector<int64_t> &buffer_sizes) {
   assert((int) buffer_sizes.size() == schema->num_fields() * 3);
   for (int i = 0; i < schema->num_fields(); i++) {
     const auto &type = schema->field(i)->type();
@@ -218,11 +219,11 @@ int32_t CalculateNumRows(const std::shared_ptr<arrow::Schema> &schema,
     }
 
     if (arrow::is_binary_like(type->id())) {
-      return int(buffer_sizes[3 * i + 1] / sizeof(int32_t)) - 1;
+      return static_cast<int64_t>(buffer_sizes[3 * i + 1] / sizeof(int32_t)) - 1;
     }
 
     if (arrow::is_large_binary_like(type->id())) {
-      return int(buffer_sizes[3 * i + 1] / sizeof(int64_t)) - 1;
+      return static_cast<int64_t>(buffer_sizes[3 * i + 1] / sizeof(int64_t)) - 1;
     }
   }
 
@@ -273,7 +274,7 @@ std::shared_ptr<arrow::ArrayData> MakeArrayData(std::shared_ptr<arrow::DataType>
 }
 
 std::shared_ptr<arrow::Buffer> MakeArrowBuffer(const std::shared_ptr<Buffer> &buffer,
-                                               int32_t offset, int32_t size) {
+                                               int64_t offset, int64_t size) {
   const auto &arrow_buf = std::static_pointer_cast<ArrowBuffer>(buffer)->getBuf();
   // we need to slice the buffer here, rather than creating an arrow::Buffer from cylon::buffer data
   // pointer. Because we need to pass the ownership of the parent buffer to the slice. otherwise,
@@ -284,15 +285,15 @@ std::shared_ptr<arrow::Buffer> MakeArrowBuffer(const std::shared_ptr<Buffer> &bu
 Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
                         const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                        const std::vector<int32_t> &buffer_sizes,
-                        const std::vector<int32_t> &buffer_offsets,
+                        const std::vector<int64_t> &buffer_sizes,
+                        const std::vector<int64_t> &buffer_offsets,
                         std::shared_ptr<Table> *output) {
   assert(received_buffers.size() == buffer_sizes.size());
   assert(received_buffers.size() == buffer_offsets.size());
   assert(received_buffers.size() == (size_t) schema->num_fields() * 3);
 
   const int32_t num_cols = schema->num_fields();
-  const int32_t num_rows = CalculateNumRows(schema, buffer_sizes);
+  const int64_t num_rows = CalculateNumRows(schema, buffer_sizes);
   if (num_rows == -1) {
     return {Code::ExecutionError, "unable to calculate num rows for the buffers"};
   }
@@ -324,12 +325,12 @@ Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
 Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
                         const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                        const std::vector<int32_t> &buffer_sizes,
+                        const std::vector<int64_t> &buffer_sizes,
                         std::shared_ptr<Table> *output) {
   assert(received_buffers.size() == buffer_sizes.size());
   assert(received_buffers.size() == (size_t) schema->num_fields() * 3);
 
-  std::vector<int32_t> buffer_offsets(buffer_sizes.size(), 0);
+  std::vector<int64_t> buffer_offsets(buffer_sizes.size(), 0);
   return DeserializeTable(ctx, schema, received_buffers, buffer_sizes, buffer_offsets, output);
 }
 
@@ -337,9 +338,9 @@ Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
                         const std::vector<std::shared_ptr<Buffer>> &received_buffers,
                         std::shared_ptr<Table> *output) {
-  std::vector<int32_t> buffer_sizes(received_buffers.size());
+  std::vector<int64_t> buffer_sizes(received_buffers.size());
   for (size_t i = 0; i < received_buffers.size(); i++) {
-    buffer_sizes[i] = (int32_t) received_buffers[i]->GetLength();
+    buffer_sizes[i] = received_buffers[i]->GetLength();
   }
   return DeserializeTable(ctx, schema, received_buffers, buffer_sizes, output);
 }
@@ -348,8 +349,8 @@ Status DeserializeTables(const std::shared_ptr<CylonContext> &ctx,
                          const std::shared_ptr<arrow::Schema> &schema,
                          int num_tables,
                          const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                         const std::vector<int32_t> &buffer_sizes_per_table,
-                         const std::vector<int32_t> &buffer_offsets_per_table,
+                         const std::vector<int64_t> &buffer_sizes_per_table,
+                         const std::vector<int64_t> &buffer_offsets_per_table,
                          std::vector<std::shared_ptr<Table>> *output) {
   const int num_buffers = (int) schema->num_fields() * 3;
 
@@ -358,7 +359,7 @@ Status DeserializeTables(const std::shared_ptr<CylonContext> &ctx,
   assert((int) buffer_offsets_per_table.size() == num_tables * num_buffers);
 
   output->reserve(num_tables);
-  std::vector<int32_t> table_buffer_sizes(num_buffers, 0), table_buffer_offsets(num_buffers, 0);
+  std::vector<int64_t> table_buffer_sizes(num_buffers, 0), table_buffer_offsets(num_buffers, 0);
   for (int i = 0; i < num_tables; i++) {
     std::shared_ptr<Table> out;
     int offset = i * num_buffers;
@@ -379,7 +380,7 @@ Status DeserializeTables(const std::shared_ptr<CylonContext> &ctx,
 
 CylonColumnSerializer::CylonColumnSerializer(std::shared_ptr<arrow::Array> array,
                                              const std::array<const uint8_t *, 3> &data_bufs,
-                                             const std::array<int32_t, 3> &buf_sizes,
+                                             const std::array<int64_t, 3> &buf_sizes,
                                              arrow::BufferVector extra_buffers)
     : array_(std::move(array)),
       data_bufs_(data_bufs),
@@ -390,7 +391,7 @@ const std::array<const uint8_t *, 3> &CylonColumnSerializer::data_buffers() cons
   return data_bufs_;
 }
 
-const std::array<int32_t, 3> &CylonColumnSerializer::buffer_sizes() const {
+const std::array<int64_t, 3> &CylonColumnSerializer::buffer_sizes() const {
   return buf_sizes_;
 }
 
@@ -401,7 +402,7 @@ int32_t CylonColumnSerializer::getDataTypeId() const {
 Status CylonColumnSerializer::Make(const std::shared_ptr<arrow::Array> &column,
                                    std::shared_ptr<ColumnSerializer> *serializer,
                                    arrow::MemoryPool *pool) {
-  std::array<int32_t, 3> buffer_sizes{};
+  std::array<int64_t, 3> buffer_sizes{};
   std::array<const uint8_t *, 3> data_buffers{};
   // we can only send byte boundary buffers. If we encounter bitmaps that don't align to a byte
   // boundary, make a copy and keep it in this vector
@@ -441,14 +442,14 @@ Status CylonColumnSerializer::Make(const std::shared_ptr<Column> &column,
 
 Status DeserializeColumn(const std::shared_ptr<arrow::DataType> &data_type,
                          const std::array<std::shared_ptr<Buffer>, 3> &received_buffers,
-                         const std::array<int32_t, 3> &buffer_sizes,
-                         const std::array<int32_t, 3> &buffer_offsets,
+                         const std::array<int64_t, 3> &buffer_sizes,
+                         const std::array<int64_t, 3> &buffer_offsets,
                          std::shared_ptr<Column> *output) {
   if (data_type->id() == arrow::Type::BOOL) {
     return {Code::Invalid, "deserializing bool type column is not supported"};
   }
 
-  int num_rows = CalculateNumRows(data_type, buffer_sizes);
+  int64_t num_rows = CalculateNumRows(data_type, buffer_sizes);
   if (num_rows == -1) {
     return {Code::ExecutionError, "unable to calculate num rows for the buffers"};
   }
@@ -471,9 +472,9 @@ Status DeserializeColumn(const std::shared_ptr<arrow::DataType> &data_type,
 
 Status DeserializeColumn(const std::shared_ptr<arrow::DataType> &data_type,
                          const std::array<std::shared_ptr<Buffer>, 3> &received_buffers,
-                         const std::array<int32_t, 3> &buffer_sizes,
+                         const std::array<int64_t, 3> &buffer_sizes,
                          std::shared_ptr<Column> *output) {
-  return DeserializeColumn(data_type, received_buffers, buffer_sizes, std::array<int32_t, 3>{},
+  return DeserializeColumn(data_type, received_buffers, buffer_sizes, std::array<int64_t, 3>{},
                            output);
 }
 
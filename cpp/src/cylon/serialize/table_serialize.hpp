@@ -23,20 +23,20 @@ namespace cylon{
 class CylonTableSerializer : public TableSerializer {
  public:
   CylonTableSerializer(std::shared_ptr<arrow::Table> table,
-                       std::vector<int32_t> buffer_sizes,
+                       std::vector<int64_t> buffer_sizes,
                        std::vector<const uint8_t *> data_buffers,
                        arrow::BufferVector extra_buffers);
 
   static Status Make(const std::shared_ptr<Table> &table,
                      std::shared_ptr<TableSerializer> *serializer);
 
-  const std::vector<int32_t> &getBufferSizes() override {
+  const std::vector<int64_t> &getBufferSizes() override {
     return buffer_sizes_;
   }
   int getNumberOfBuffers() override {
     return num_buffers_;
   }
-  std::vector<int32_t> getEmptyTableBufferSizes() override;
+  std::vector<int64_t> getEmptyTableBufferSizes() override;
 
   const std::vector<const uint8_t *> &getDataBuffers() override {
     return data_buffers_;
@@ -50,7 +50,7 @@ class CylonTableSerializer : public TableSerializer {
 
   const std::shared_ptr<arrow::Table> table_;
   const int32_t num_buffers_;
-  const std::vector<int32_t> buffer_sizes_;
+  const std::vector<int64_t> buffer_sizes_;
   const std::vector<const uint8_t *> data_buffers_;
 
   // when there are boolean buffers with non-byte-boundary-offsets, we can not get a byte* to the
@@ -73,13 +73,13 @@ class CylonTableSerializer : public TableSerializer {
 Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
                         const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                        const std::vector<int32_t> &buffer_sizes,
-                        const std::vector<int32_t> &buffer_offsets,
+                        const std::vector<int64_t> &buffer_sizes,
+                        const std::vector<int64_t> &buffer_offsets,
                         std::shared_ptr<Table> *output);
 Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
                         const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                        const std::vector<int32_t> &buffer_sizes,
+                        const std::vector<int64_t> &buffer_sizes,
                         std::shared_ptr<Table> *output);
 Status DeserializeTable(const std::shared_ptr<CylonContext> &ctx,
                         const std::shared_ptr<arrow::Schema> &schema,
@@ -106,20 +106,20 @@ Status DeserializeTables(const std::shared_ptr<CylonContext> &ctx,
                          const std::shared_ptr<arrow::Schema> &schema,
                          int num_tables,
                          const std::vector<std::shared_ptr<Buffer>> &received_buffers,
-                         const std::vector<int32_t> &buffer_sizes_per_table,
-                         const std::vector<int32_t> &buffer_offsets_per_table,
+                         const std::vector<int64_t> &buffer_sizes_per_table,
+                         const std::vector<int64_t> &buffer_offsets_per_table,
                          std::vector<std::shared_ptr<Table>> *output);
 
 class CylonColumnSerializer : public ColumnSerializer {
  public:
   CylonColumnSerializer(std::shared_ptr<arrow::Array> array,
                         const std::array<const uint8_t *, 3> &data_bufs,
-                        const std::array<int32_t, 3> &buf_sizes,
+                        const std::array<int64_t, 3> &buf_sizes,
                         arrow::BufferVector extra_buffers);
 
   const std::array<const uint8_t *, 3> &data_buffers() const override;
 
-  const std::array<int32_t, 3> &buffer_sizes() const override;
+  const std::array<int64_t, 3> &buffer_sizes() const override;
 
   int32_t getDataTypeId() const override;
 
@@ -136,18 +136,18 @@ class CylonColumnSerializer : public ColumnSerializer {
  private:
   const std::shared_ptr<arrow::Array> array_;
   const std::array<const uint8_t *, 3> data_bufs_;
-  const std::array<int32_t, 3> buf_sizes_;
+  const std::array<int64_t, 3> buf_sizes_;
   const arrow::BufferVector extra_buffers_;
 };
 
 Status DeserializeColumn(const std::shared_ptr<arrow::DataType> &data_type,
                          const std::array<std::shared_ptr<Buffer>, 3> &received_buffers,
-                         const std::array<int32_t, 3> &buffer_sizes,
-                         const std::array<int32_t, 3> &buffer_offsets,
+                         const std::array<int64_t, 3> &buffer_sizes,
+                         const std::array<int64_t, 3> &buffer_offsets,
                          std::shared_ptr<Column> *output);
 Status DeserializeColumn(const std::shared_ptr<arrow::DataType> &data_type,
                          const std::array<std::shared_ptr<Buffer>, 3> &received_buffers,
-                         const std::array<int32_t, 3> &buffer_sizes,
+                         const std::array<int64_t, 3> &buffer_sizes,
                          std::shared_ptr<Column> *output);
 
 }
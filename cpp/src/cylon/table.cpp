@@ -16,9 +16,12 @@
 #include <arrow/compute/api.h>
 #include <arrow/table.h>
 
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <future>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <iostream>
 
@@ -27,14 +30,22 @@
 #include <cylon/arrow/arrow_all_to_all.hpp>
 #include <cylon/arrow/arrow_comparator.hpp>
 #include <cylon/arrow/arrow_types.hpp>
+#include <cylon/compute/predicate.hpp>
+#include <cylon/ctx/arena_memory_pool.hpp>
+#include <cylon/ctx/memory_tracker.hpp>
+#include <cylon/util/trace.hpp>
 #include <cylon/ctx/arrow_memory_pool_utils.hpp>
 #include <cylon/io/arrow_io.hpp>
+#include <cylon/join/hash_join.hpp>
 #include <cylon/join/join.hpp>
+#include <cylon/join/join_planner.hpp>
+#include <cylon/partition/heavy_hitters.hpp>
 #include <cylon/partition/partition.hpp>
 #include <cylon/table_api_extended.hpp>
 #include <cylon/thridparty/flat_hash_map/bytell_hash_map.hpp>
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/util/macros.hpp>
+#include <cylon/util/parallel.hpp>
 #include <cylon/util/to_string.hpp>
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/repartition.hpp>
@@ -220,29 +231,321 @@ static inline Status all_to_all_arrow_tables_preserve_order(const std::shared_pt
   return Status::OK();
 }
 
+// approximate size of a row batch that is partitioned and handed over to the all-to-all at a time.
+// can be overridden by the kShuffleBatchBytesConfig context config
+static constexpr int64_t kShuffleBatchBytes = 16 * 1024 * 1024;
+
+static int64_t GetShuffleBatchBytes(const std::shared_ptr<CylonContext> &ctx) {
+  const auto &config = ctx->GetConfig(kShuffleBatchBytesConfig);
+  return config.empty() ? kShuffleBatchBytes : std::max<int64_t>(1, std::stoll(config));
+}
+
+/**
+ * Maps the rows of a batch (starting at row offset of the table) to target partitions. It may
+ * replace the batch, ie. to replicate rows.
+ */
+using BatchPartitioner = std::function<Status(int64_t offset,
+                                              std::shared_ptr<Table> &batch,
+                                              std::vector<uint32_t> &target_partitions,
+                                              std::vector<uint32_t> &partition_hist)>;
+
+/**
+ * Shuffles a table in batches of rows. Each batch is partitioned and its partitions are handed
+ * over to the all-to-all straight away, so that partitioning the next batch overlaps with sending the
+ * previous ones, and only a batch worth of partitions is materialized at a time.
+ */
+static Status shuffle_table_in_batches(const std::shared_ptr<CylonContext> &ctx,
+                                       const std::shared_ptr<Table> &table,
+                                       const BatchPartitioner &partitioner,
+                                       std::shared_ptr<arrow::Table> &table_out) {
+  MemoryScope memory_scope(ctx, "shuffle");
+  trace::Span span("shuffle");
+  const int num_partitions = ctx->GetWorldSize(), rank = ctx->GetRank();
+  // released once the last batch has been sliced
+  std::shared_ptr<arrow::Table> arrow_table = table->get_table();
+  const std::shared_ptr<arrow::Schema> schema = arrow_table->schema();
+
+  std::vector<int> all_columns(arrow_table->num_columns());
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+  const int64_t num_rows = arrow_table->num_rows();
+  const int64_t num_bytes = util::GetBytesAndElements(arrow_table, all_columns)[1];
+  span.AddBytes(num_bytes);
+  const int64_t batch_bytes = GetShuffleBatchBytes(ctx);
+  const int64_t batch_rows = num_bytes <= batch_bytes ? num_rows : std::max<int64_t>(
+      1, (int64_t) ((double) num_rows * batch_bytes / num_bytes));
+
+  // we are going to free if retain is set to false
+  if (!table->IsRetain()) {
+    const_cast<std::shared_ptr<Table> &>(table).reset();
+  }
+
+  std::vector<std::shared_ptr<arrow::Table>> received_tables;
+  ArrowCallback arrow_callback =
+      [&received_tables](int source, const std::shared_ptr<arrow::Table> &table_, int reference) {
+        CYLON_UNUSED(source);
+        CYLON_UNUSED(reference);
+        received_tables.push_back(table_);
+        return true;
+      };
+
+  const auto &neighbours = ctx->GetNeighbours(true);
+  cylon::ArrowAllToAll all_to_all(ctx, neighbours, neighbours, ctx->GetNextSequence(),
+                                  arrow_callback, schema);
+
+  std::vector<uint32_t> target_partitions, partition_hist;
+  int64_t offset = 0;
+  // an empty table is sent as one empty batch
+  do {
+    auto batch = std::make_shared<Table>(ctx, arrow_table->Slice(offset, batch_rows));
+    if (offset + batch_rows >= num_rows) {
+      arrow_table.reset();
+    }
+    {
+      trace::Span partition_span("shuffle.partition");
+      RETURN_CYLON_STATUS_IF_FAILED(partitioner(offset, batch, target_partitions, partition_hist));
+    }
+
+    std::vector<std::shared_ptr<arrow::Table>> partitioned_tables;
+    RETURN_CYLON_STATUS_IF_FAILED(
+        Split(batch, num_partitions, target_partitions, partition_hist, partitioned_tables));
+
+    for (int i = 0; i < num_partitions; i++) {
+      if (i != rank) {
+        all_to_all.insert(partitioned_tables[i], i);
+      } else {
+        received_tables.push_back(partitioned_tables[i]);
+      }
+    }
+    // progress the sends of this batch, while the next one is being partitioned
+    all_to_all.isComplete();
+    offset += batch_rows;
+  } while (offset < num_rows);
+
+  // now complete the communication
+  {
+    trace::Span all_to_all_span("shuffle.all_to_all");
+    all_to_all.finish();
+    while (!all_to_all.isComplete()) {
+    }
+    all_to_all.close();
+  }
+
+  // a chunk per received table. consumers that need contiguous arrays combine them
+  CYLON_ASSIGN_OR_RAISE(table_out, arrow::ConcatenateTables(received_tables))
+  return Status::OK();
+}
+
+/**
+ * Hash shuffles a table in batches of rows
+ */
 template<typename T>
 // T is int32_t or const std::vector<int32_t>&
 static inline Status shuffle_table_by_hashing(const std::shared_ptr<CylonContext> &ctx,
                                               const std::shared_ptr<Table> &table,
                                               const T &hash_column,
                                               std::shared_ptr<arrow::Table> &table_out) {
-  // partition the tables locally
-  std::vector<uint32_t> outPartitions, counts;
-  int no_of_partitions = ctx->GetWorldSize();
-  RETURN_CYLON_STATUS_IF_FAILED(
-      MapToHashPartitions(table, hash_column, no_of_partitions, outPartitions, counts));
+  const uint32_t num_partitions = ctx->GetWorldSize();
+  return shuffle_table_in_batches(
+      ctx, table,
+      [&](int64_t offset, std::shared_ptr<Table> &batch, std::vector<uint32_t> &target_partitions,
+          std::vector<uint32_t> &partition_hist) {
+        CYLON_UNUSED(offset);
+        return MapToHashPartitions(batch, hash_column, num_partitions, target_partitions,
+                                   partition_hist);
+      },
+      table_out);
+}
 
-  std::vector<std::shared_ptr<arrow::Table>> partitioned_tables;
-  RETURN_CYLON_STATUS_IF_FAILED(
-      Split(table, no_of_partitions, outPartitions, counts, partitioned_tables));
+// name of the hidden column that carries the row hashes of a table through a shuffle
+static constexpr const char *kRowHashColumnName = "__cylon_row_hash__";
 
-  std::shared_ptr<arrow::Schema> schema = table->get_table()->schema();
-  // we are going to free if retain is set to false
+/**
+ * Appends the row hashes to a table as a hidden uint32 column, so that a shuffle carries them along
+ * with the rows (and replicates them along with replicated rows)
+ */
+static Status append_row_hashes(const std::shared_ptr<CylonContext> &ctx,
+                                const std::shared_ptr<Table> &table,
+                                const std::vector<uint32_t> &row_hashes,
+                                std::shared_ptr<Table> &out) {
+  const std::shared_ptr<arrow::Table> arrow_table = table->get_table();
+  const auto num_rows = static_cast<int64_t>(row_hashes.size());
+  CYLON_ASSIGN_OR_RAISE(auto buf, arrow::AllocateBuffer(num_rows * (int64_t) sizeof(uint32_t),
+                                                        cylon::ToArrowPool(ctx)))
+  std::copy(row_hashes.begin(), row_hashes.end(), reinterpret_cast<uint32_t *>(buf->mutable_data()));
+  const auto &hashes = std::make_shared<arrow::UInt32Array>(num_rows, std::move(buf));
+  CYLON_ASSIGN_OR_RAISE(auto with_hashes,
+                        arrow_table->AddColumn(arrow_table->num_columns(),
+                                               arrow::field(kRowHashColumnName, arrow::uint32()),
+                                               std::make_shared<arrow::ChunkedArray>(hashes)))
+
+  // we are going to free if retain is set to false. the shuffle then frees the hidden column
   if (!table->IsRetain()) {
     const_cast<std::shared_ptr<Table> &>(table).reset();
   }
+  out = std::make_shared<Table>(ctx, std::move(with_hashes));
+  out->retainMemory(false);
+  return Status::OK();
+}
+
+/**
+ * Removes the hidden row hash column of a shuffled table, and outputs the hashes
+ */
+static Status remove_row_hashes(std::shared_ptr<arrow::Table> &table,
+                                std::shared_ptr<std::vector<uint32_t>> &row_hashes) {
+  const int hash_idx = table->num_columns() - 1;
+  if (hash_idx < 0 || table->field(hash_idx)->name() != kRowHashColumnName) {
+    return {Code::Invalid, "table does not have a row hash column"};
+  }
+  const auto &column = table->column(hash_idx);
+  row_hashes = std::make_shared<std::vector<uint32_t>>();
+  row_hashes->reserve(table->num_rows());
+  for (const auto &chunk: column->chunks()) {
+    const auto *values = std::static_pointer_cast<arrow::UInt32Array>(chunk)->raw_values();
+    row_hashes->insert(row_hashes->end(), values, values + chunk->length());
+  }
+  CYLON_ASSIGN_OR_RAISE(table, table->RemoveColumn(hash_idx))
+  return Status::OK();
+}
+
+/**
+ * Maps rows [offset, offset + length) to hash % num_partitions. With the HashRows hashes of the hash
+ * columns, this is the partition that MapToHashPartitions gives them
+ */
+static void map_row_hashes_to_partitions(const std::vector<uint32_t> &row_hashes,
+                                         int64_t offset,
+                                         int64_t length,
+                                         uint32_t num_partitions,
+                                         std::vector<uint32_t> &target_partitions,
+                                         std::vector<uint32_t> &partition_hist) {
+  target_partitions.resize(length);
+  partition_hist.assign(num_partitions, 0);
+  for (int64_t i = 0; i < length; i++) {
+    const uint32_t p = row_hashes[offset + i] % num_partitions;
+    target_partitions[i] = p;
+    partition_hist[p]++;
+  }
+}
+
+/**
+ * Shuffles a table in batches, partitioning the rows by their hashes. The hashes travel with the
+ * rows, and the hashes of the received rows are output, so that the receivers can use them for
+ * their local hash tables, without hashing the rows again.
+ */
+static Status shuffle_table_with_row_hashes(const std::shared_ptr<CylonContext> &ctx,
+                                            const std::shared_ptr<Table> &table,
+                                            const std::vector<uint32_t> &row_hashes,
+                                            std::shared_ptr<arrow::Table> &table_out,
+                                            std::shared_ptr<std::vector<uint32_t>> &row_hashes_out) {
+  std::shared_ptr<Table> hashed_table;
+  RETURN_CYLON_STATUS_IF_FAILED(append_row_hashes(ctx, table, row_hashes, hashed_table));
+  const uint32_t num_partitions = ctx->GetWorldSize();
+  RETURN_CYLON_STATUS_IF_FAILED(shuffle_table_in_batches(
+      ctx, hashed_table,
+      [&](int64_t offset, std::shared_ptr<Table> &batch, std::vector<uint32_t> &target_partitions,
+          std::vector<uint32_t> &partition_hist) {
+        map_row_hashes_to_partitions(row_hashes, offset, batch->Rows(), num_partitions,
+                                     target_partitions, partition_hist);
+        return Status::OK();
+      },
+      table_out));
+  return remove_row_hashes(table_out, row_hashes_out);
+}
+
+/**
+ * Hash shuffles a table in batches of rows, and outputs the row hashes (HashRows) of the received
+ * rows
+ */
+static Status shuffle_table_by_hashing(const std::shared_ptr<CylonContext> &ctx,
+                                       const std::shared_ptr<Table> &table,
+                                       const std::vector<int32_t> &hash_columns,
+                                       std::shared_ptr<arrow::Table> &table_out,
+                                       std::shared_ptr<std::vector<uint32_t>> &row_hashes_out) {
+  std::vector<uint32_t> row_hashes;
+  RETURN_CYLON_STATUS_IF_FAILED(HashRows(table, hash_columns, row_hashes));
+  return shuffle_table_with_row_hashes(ctx, table, row_hashes, table_out, row_hashes_out);
+}
 
-  return all_to_all_arrow_tables(ctx, schema, partitioned_tables, table_out);
+/**
+ * Shuffles a table of a join with a SkewAwarePartitioner
+ */
+static Status shuffle_table_skew_aware(const std::shared_ptr<CylonContext> &ctx,
+                                       const std::shared_ptr<Table> &table,
+                                       SkewAwarePartitioner &partitioner,
+                                       std::shared_ptr<arrow::Table> &table_out) {
+  auto pool = cylon::ToArrowPool(ctx);
+  std::vector<int64_t> indices;
+  return shuffle_table_in_batches(
+      ctx, table,
+      [&](int64_t offset, std::shared_ptr<Table> &batch, std::vector<uint32_t> &target_partitions,
+          std::vector<uint32_t> &partition_hist) -> Status {
+        RETURN_CYLON_STATUS_IF_FAILED(partitioner.Partition(offset, batch->Rows(),
+                                                            target_partitions, partition_hist,
+                                                            indices));
+        if (indices.empty()) {
+          return Status::OK();
+        }
+        // replicate the rows of the heavy hitters
+        arrow::Int64Builder builder(pool);
+        RETURN_CYLON_STATUS_IF_ARROW_FAILED(builder.AppendValues(indices));
+        CYLON_ASSIGN_OR_RAISE(auto take_indices, builder.Finish())
+        CYLON_ASSIGN_OR_RAISE(auto replicated, arrow::compute::Take(batch->get_table(),
+                                                                    take_indices))
+        batch = std::make_shared<Table>(ctx, replicated.table());
+        return Status::OK();
+      },
+      table_out);
+}
+
+/**
+ * Shuffles the tables of a join, splitting the rows of heavy-hitter keys among several workers and
+ * replicating the matching rows of the other table (see FindJoinHeavyHitters)
+ */
+static Status shuffle_two_tables_skew_aware(const std::shared_ptr<CylonContext> &ctx,
+                                            const std::shared_ptr<Table> &left_table,
+                                            const std::vector<int32_t> &left_hash_columns,
+                                            const std::shared_ptr<Table> &right_table,
+                                            const std::vector<int32_t> &right_hash_columns,
+                                            join::config::JoinType join_type,
+                                            std::shared_ptr<arrow::Table> &left_table_out,
+                                            std::shared_ptr<arrow::Table> &right_table_out,
+                                            std::shared_ptr<std::vector<uint32_t>> *left_hashes_out = nullptr,
+                                            std::shared_ptr<std::vector<uint32_t>> *right_hashes_out = nullptr) {
+  std::vector<uint32_t> left_hashes, right_hashes;
+  RETURN_CYLON_STATUS_IF_FAILED(HashRows(left_table, left_hash_columns, left_hashes));
+  RETURN_CYLON_STATUS_IF_FAILED(HashRows(right_table, right_hash_columns, right_hashes));
+
+  HeavyHitters heavy_hitters;
+  RETURN_CYLON_STATUS_IF_FAILED(FindJoinHeavyHitters(
+      ctx, left_hashes, right_hashes,
+      join_type == join::config::INNER || join_type == join::config::LEFT,
+      join_type == join::config::INNER || join_type == join::config::RIGHT, &heavy_hitters));
+
+  // the hashes are carried with the rows, if the output hashes are requested
+  std::shared_ptr<Table> left = left_table, right = right_table;
+  if (left_hashes_out != nullptr) {
+    RETURN_CYLON_STATUS_IF_FAILED(append_row_hashes(ctx, left_table, left_hashes, left));
+  }
+  if (right_hashes_out != nullptr) {
+    RETURN_CYLON_STATUS_IF_FAILED(append_row_hashes(ctx, right_table, right_hashes, right));
+  }
+
+  const uint32_t num_partitions = ctx->GetWorldSize(), rank = ctx->GetRank();
+  SkewAwarePartitioner left_partitioner(std::move(left_hashes), heavy_hitters, /*left=*/true,
+                                        num_partitions, rank);
+  RETURN_CYLON_STATUS_IF_FAILED(
+      shuffle_table_skew_aware(ctx, left, left_partitioner, left_table_out));
+  if (left_hashes_out != nullptr) {
+    RETURN_CYLON_STATUS_IF_FAILED(remove_row_hashes(left_table_out, *left_hashes_out));
+  }
+
+  SkewAwarePartitioner right_partitioner(std::move(right_hashes), heavy_hitters, /*left=*/false,
+                                         num_partitions, rank);
+  RETURN_CYLON_STATUS_IF_FAILED(
+      shuffle_table_skew_aware(ctx, right, right_partitioner, right_table_out));
+  if (right_hashes_out != nullptr) {
+    RETURN_CYLON_STATUS_IF_FAILED(remove_row_hashes(right_table_out, *right_hashes_out));
+  }
+  return Status::OK();
 }
 
 template<typename T>
@@ -256,21 +559,10 @@ static inline Status shuffle_two_tables_by_hashing(const std::shared_ptr<cylon::
                                                    std::shared_ptr<arrow::Table> &right_table_out) {
   LOG(INFO) << "Shuffling two tables with total rows : "
             << left_table->Rows() + right_table->Rows();
-  auto t1 = std::chrono::high_resolution_clock::now();
   RETURN_CYLON_STATUS_IF_FAILED(
       shuffle_table_by_hashing(ctx, left_table, left_hash_column, left_table_out));
-
-  auto t2 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Left shuffle time : "
-            << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count();
-
   RETURN_CYLON_STATUS_IF_FAILED(
       shuffle_table_by_hashing(ctx, right_table, right_hash_column, right_table_out));
-
-  auto t3 = std::chrono::high_resolution_clock::now();
-  LOG(INFO) << "Right shuffle time : "
-            << std::chrono::duration_cast<std::chrono::milliseconds>(t3 - t2).count();
-
   return Status::OK();
 }
 
@@ -400,11 +692,19 @@ Status Merge(const std::vector<std::shared_ptr<cylon::Table>> &ctables,
   }
 }
 
+// number of threads of a local sort, from the kSortThreadsConfig context config
+static int GetSortThreads(const std::shared_ptr<CylonContext> &ctx) {
+  const auto &config = ctx->GetConfig(kSortThreadsConfig);
+  return config.empty() ? 1 : util::GetNumThreads(std::stoi(config));
+}
+
 Status Sort(const std::shared_ptr<Table> &table, int sort_column,
             std::shared_ptr<cylon::Table> &out, bool ascending) {
   std::shared_ptr<arrow::Table> sorted_table;
   const auto &table_ = table->get_table();
   const auto &ctx = table->GetContext();
+  MemoryScope memory_scope(ctx, "sort");
+  trace::Span span("sort.local");
   auto pool = cylon::ToArrowPool(ctx);
 
   // if num_rows is 0 or 1, we dont need to sort
@@ -412,8 +712,11 @@ Status Sort(const std::shared_ptr<Table> &table, int sort_column,
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::Duplicate(table_, pool, sorted_table));
   }
 
+  // the sort indices are scratch memory
+  OperatorArena arena(ctx);
   RETURN_CYLON_STATUS_IF_ARROW_FAILED(
-      util::SortTable(table_, sort_column, pool, sorted_table, ascending));
+      util::SortTable(table_, sort_column, pool, sorted_table, ascending, GetSortThreads(ctx),
+                      arena.pool()));
   return Table::FromArrowTable(ctx, sorted_table, out);
 }
 
@@ -433,6 +736,8 @@ Status Sort(const std::shared_ptr<Table> &table, const std::vector<int32_t> &sor
   std::shared_ptr<arrow::Table> sorted_table;
   auto table_ = table->get_table();
   const auto &ctx = table->GetContext();
+  MemoryScope memory_scope(ctx, "sort");
+  trace::Span span("sort.local");
   auto pool = cylon::ToArrowPool(ctx);
 
   // if num_rows is 0 or 1, we dont need to sort
@@ -440,11 +745,15 @@ Status Sort(const std::shared_ptr<Table> &table, const std::vector<int32_t> &sor
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::Duplicate(table_, pool, sorted_table));
   }
 
+  // the sort indices are scratch memory
+  OperatorArena arena(ctx);
   RETURN_CYLON_STATUS_IF_ARROW_FAILED(cylon::util::SortTableMultiColumns(table_,
                                                                          sort_columns,
                                                                          pool,
                                                                          sorted_table,
-                                                                         sort_direction));
+                                                                         sort_direction,
+                                                                         GetSortThreads(ctx),
+                                                                         arena.pool()));
   return Table::FromArrowTable(ctx, sorted_table, out);
 }
 
@@ -506,7 +815,7 @@ Status MergeSortedTable(const std::vector<std::shared_ptr<Table>> &tables,
   std::shared_ptr<Table> concatenated;
   std::vector<int64_t> table_indices(tables.size()),
       table_end_indices(tables.size());
-  int acc = 0;
+  int64_t acc = 0;
   for (size_t i = 0; i < table_indices.size(); i++) {
     table_indices[i] = acc;
     acc += tables[i]->Rows();
@@ -541,13 +850,9 @@ Status MergeSortedTable(const std::vector<std::shared_ptr<Table>> &tables,
   arrow::Int64Builder filter(pool);
   RETURN_CYLON_STATUS_IF_ARROW_FAILED(filter.Reserve(concatenated->Rows()));
 
-  std::vector<int> temp_v;
-
   while (!pq.empty()) {
     int t = pq.top();
     pq.pop();
-    // std::cout<<table_indices[t]<<std::endl;
-    temp_v.push_back(table_indices[t]);
     filter.UnsafeAppend(table_indices[t]);
     table_indices[t] += 1;
     if (table_indices[t] < table_end_indices[t]) {
@@ -676,6 +981,186 @@ Status GetSplitPointIndices(const std::shared_ptr<Table> &split_points,
   return Status::OK();
 }
 
+/**
+ * Sorted runs spilled to local disk as Arrow IPC files. The files are removed on destruction.
+ */
+class SpilledRuns {
+ public:
+  explicit SpilledRuns(const std::string &spill_dir)
+      : prefix_(SpillDir(spill_dir) + "/cylon_sort_" + util::generate_uuid_v4()) {}
+
+  ~SpilledRuns() {
+    for (const auto &path: paths_) {
+      std::remove(path.c_str());
+    }
+  }
+
+  Status Spill(const std::shared_ptr<arrow::Table> &run) {
+    // add the path first, so that a partially written file would also be removed
+    paths_.push_back(prefix_ + "_" + std::to_string(paths_.size()) + ".arrow");
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(io::WriteIPC(run, paths_.back()));
+    return Status::OK();
+  }
+
+  /**
+   * runs are memory mapped, hence they are paged in only while being accessed
+   */
+  Status Read(size_t run, const std::shared_ptr<CylonContext> &ctx, std::shared_ptr<Table> *out) const {
+    CYLON_ASSIGN_OR_RAISE(auto table, io::ReadIPC(paths_[run], true, ToArrowPool(ctx)))
+    *out = std::make_shared<Table>(ctx, std::move(table));
+    return Status::OK();
+  }
+
+  size_t size() const { return paths_.size(); }
+
+ private:
+  static std::string SpillDir(const std::string &spill_dir) {
+    if (!spill_dir.empty()) {
+      return spill_dir;
+    }
+    const char *tmp_dir = std::getenv("TMPDIR");
+    return tmp_dir != nullptr ? tmp_dir : "/tmp";
+  }
+
+  std::string prefix_;
+  std::vector<std::string> paths_;
+};
+
+static Status MergeSpilledRuns(const SpilledRuns &runs,
+                               const std::shared_ptr<CylonContext> &ctx,
+                               const std::shared_ptr<arrow::Schema> &schema,
+                               const std::vector<int32_t> &sort_columns,
+                               const std::vector<bool> &sort_direction,
+                               std::shared_ptr<cylon::Table> &output) {
+  if (runs.size() == 0) {
+    std::shared_ptr<arrow::Table> empty;
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::CreateEmptyTable(schema, &empty, ToArrowPool(ctx)));
+    output = std::make_shared<Table>(ctx, std::move(empty));
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Table>> tables(runs.size());
+  for (size_t i = 0; i < runs.size(); i++) {
+    RETURN_CYLON_STATUS_IF_FAILED(runs.Read(i, ctx, &tables[i]));
+  }
+  return MergeSortedTable(tables, sort_columns, sort_direction, output);
+}
+
+/**
+ * Out of core variant of the regular sampling sort. The local table is sorted in runs of
+ * sort_options.memory_limit bytes, which are spilled to disk. Split points are determined from the
+ * samples of every run. Then the runs are shuffled one at a time, and the sorted pieces received in
+ * each round are merged and spilled. Finally the received runs are k-way merged.
+ */
+static Status DistributedSortSpilling(const std::shared_ptr<Table> &table,
+                                      const std::vector<int32_t> &sort_columns,
+                                      const std::vector<bool> &sort_direction,
+                                      std::shared_ptr<cylon::Table> &output,
+                                      const SortOptions &sort_options) {
+  const auto &ctx = table->GetContext();
+  const int world_sz = ctx->GetWorldSize();
+  auto pool = ToArrowPool(ctx);
+  const auto &arrow_table = table->get_table();
+  const auto &schema = arrow_table->schema();
+
+  std::vector<int> all_columns(table->Columns());
+  std::iota(all_columns.begin(), all_columns.end(), 0);
+  const int64_t num_bytes = util::GetBytesAndElements(arrow_table, all_columns)[1];
+  const int64_t num_rows = arrow_table->num_rows();
+
+  if (world_sz == 1 && num_bytes <= sort_options.memory_limit) {
+    return Sort(table, sort_columns, output, sort_direction);
+  }
+
+  const auto run_rows = num_bytes == 0 ? num_rows : std::max<int64_t>(
+      1, (int64_t) ((double) num_rows * sort_options.memory_limit / num_bytes));
+  const int sampling_ratio = sort_options.num_samples == 0 ? 2 : sort_options.num_samples;
+
+  // sort and spill runs
+  SpilledRuns local_runs(sort_options.spill_dir);
+  std::vector<std::shared_ptr<Table>> run_samples;
+  for (int64_t offset = 0; offset < num_rows; offset += run_rows) {
+    std::shared_ptr<Table> sorted_run;
+    RETURN_CYLON_STATUS_IF_FAILED(Sort(std::make_shared<Table>(ctx, arrow_table->Slice(offset, run_rows)),
+                                       sort_columns, sorted_run, sort_direction));
+    if (world_sz > 1) {
+      std::shared_ptr<Table> sample;
+      const auto sample_count = std::min<int64_t>(world_sz * sampling_ratio, sorted_run->Rows());
+      RETURN_CYLON_STATUS_IF_FAILED(SampleTableUniform(sorted_run, sample_count, sort_columns, sample, ctx));
+      run_samples.push_back(std::move(sample));
+    }
+    RETURN_CYLON_STATUS_IF_FAILED(local_runs.Spill(sorted_run->get_table()));
+  }
+
+  if (world_sz == 1) {
+    return MergeSpilledRuns(local_runs, ctx, schema, sort_columns, sort_direction, output);
+  }
+
+  // determine split points from the samples of all runs. samples only contain sorted columns
+  std::vector<int32_t> sample_columns(sort_columns.size());
+  std::iota(sample_columns.begin(), sample_columns.end(), 0);
+  std::shared_ptr<Table> sample_result;
+  if (run_samples.empty()) {
+    RETURN_CYLON_STATUS_IF_FAILED(SampleTableUniform(table, 0, sort_columns, sample_result, ctx));
+  } else {
+    std::shared_ptr<Table> merged_samples;
+    RETURN_CYLON_STATUS_IF_FAILED(MergeSortedTable(run_samples, sample_columns, sort_direction,
+                                                   merged_samples));
+    const auto sample_count = std::min<int64_t>(world_sz * sampling_ratio, merged_samples->Rows());
+    RETURN_CYLON_STATUS_IF_FAILED(SampleTableUniform(merged_samples, sample_count, sample_columns,
+                                                     sample_result, ctx));
+  }
+  run_samples.clear();
+
+  std::shared_ptr<Table> split_points;
+  RETURN_CYLON_STATUS_IF_FAILED(GetSplitPoints(sample_result, sort_direction, split_points));
+
+  // every worker has to take part in the same number of shuffle rounds
+  std::shared_ptr<Scalar> max_runs;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->AllReduce(
+      Scalar::Make(std::make_shared<arrow::Int64Scalar>(local_runs.size())), net::MAX, &max_runs));
+  const int64_t num_rounds = std::static_pointer_cast<arrow::Int64Scalar>(max_runs->data())->value;
+
+  std::shared_ptr<arrow::Table> empty_table;
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::CreateEmptyTable(schema, &empty_table, pool));
+
+  SpilledRuns received_runs(sort_options.spill_dir);
+  for (int64_t round = 0; round < num_rounds; round++) {
+    std::vector<std::shared_ptr<arrow::Table>> split_tables;
+    if (round < (int64_t) local_runs.size()) {
+      std::shared_ptr<Table> run;
+      RETURN_CYLON_STATUS_IF_FAILED(local_runs.Read(round, ctx, &run));
+      auto run_table = run->get_table();
+      COMBINE_CHUNKS_RETURN_CYLON_STATUS(run_table, pool);
+      run = std::make_shared<Table>(ctx, run_table);
+
+      std::vector<uint32_t> target_partitions, partition_hist;
+      RETURN_CYLON_STATUS_IF_FAILED(GetSplitPointIndices(split_points, run, sort_columns, sort_direction,
+                                                         target_partitions, partition_hist));
+      // ArrowAllToAll sends whole buffers, hence the partitions are copied out rather than sliced
+      partition_hist.resize(world_sz, 0);
+      RETURN_CYLON_STATUS_IF_FAILED(Split(run, world_sz, target_partitions, partition_hist,
+                                          split_tables));
+    } else {
+      split_tables.assign(world_sz, empty_table);
+    }
+
+    std::vector<std::shared_ptr<Table>> received;
+    RETURN_CYLON_STATUS_IF_FAILED(all_to_all_arrow_tables_separated_cylon_table(
+        ctx, schema, split_tables, received));
+    split_tables.clear();
+
+    if (!received.empty()) {
+      std::shared_ptr<Table> merged;
+      RETURN_CYLON_STATUS_IF_FAILED(MergeSortedTable(received, sort_columns, sort_direction, merged));
+      received.clear();
+      RETURN_CYLON_STATUS_IF_FAILED(received_runs.Spill(merged->get_table()));
+    }
+  }
+
+  return MergeSpilledRuns(received_runs, ctx, schema, sort_columns, sort_direction, output);
+}
+
 /**
  * perform distributed sort on provided table
  * @param table
@@ -698,6 +1183,10 @@ Status DistributedSortRegularSampling(const std::shared_ptr<Table> &table,
                   "sizes of sort_column_indices and column_orders must match");
   }
 
+  if (sort_options.memory_limit > 0) {
+    return DistributedSortSpilling(table, sort_columns, sort_direction, output, sort_options);
+  }
+
   const auto &ctx = table->GetContext();
   int world_sz = ctx->GetWorldSize();
 
@@ -719,21 +1208,24 @@ Status DistributedSortRegularSampling(const std::shared_ptr<Table> &table,
   int sample_count = ctx->GetWorldSize() * SAMPLING_RATIO;
   sample_count = std::min((int64_t)sample_count, table->Rows());
 
-  // sample_result only contains sorted columns
-  std::shared_ptr<Table> sample_result;
+  {
+    trace::Span sample_span("sort.sample");
+    // sample_result only contains sorted columns
+    std::shared_ptr<Table> sample_result;
 
-  RETURN_CYLON_STATUS_IF_FAILED(
-      SampleTableUniform(local_sorted, sample_count, sort_columns, sample_result, ctx));
+    RETURN_CYLON_STATUS_IF_FAILED(
+        SampleTableUniform(local_sorted, sample_count, sort_columns, sample_result, ctx));
 
-  // determine split point, split_points only contains sorted columns
-  std::shared_ptr<Table> split_points;
-  RETURN_CYLON_STATUS_IF_FAILED(GetSplitPoints(
-      sample_result, sort_direction, split_points));
+    // determine split point, split_points only contains sorted columns
+    std::shared_ptr<Table> split_points;
+    RETURN_CYLON_STATUS_IF_FAILED(GetSplitPoints(
+        sample_result, sort_direction, split_points));
 
-  // construct target_partition, partition_hist
-  RETURN_CYLON_STATUS_IF_FAILED(
-      GetSplitPointIndices(split_points, local_sorted, sort_columns,
-                           sort_direction, target_partitions, partition_hist));
+    // construct target_partition, partition_hist
+    RETURN_CYLON_STATUS_IF_FAILED(
+        GetSplitPointIndices(split_points, local_sorted, sort_columns,
+                             sort_direction, target_partitions, partition_hist));
+  }
 
   // split and all_to_all
   RETURN_CYLON_STATUS_IF_FAILED(Split(local_sorted, world_sz, target_partitions,
@@ -746,9 +1238,13 @@ Status DistributedSortRegularSampling(const std::shared_ptr<Table> &table,
   //     const_cast<std::shared_ptr<Table> &>(table).reset();
   //   }
   std::vector<std::shared_ptr<Table>> all_to_all_result;
-  RETURN_CYLON_STATUS_IF_FAILED(all_to_all_arrow_tables_separated_cylon_table(
-      ctx, schema, split_tables, all_to_all_result));
+  {
+    trace::Span all_to_all_span("sort.all_to_all");
+    RETURN_CYLON_STATUS_IF_FAILED(all_to_all_arrow_tables_separated_cylon_table(
+        ctx, schema, split_tables, all_to_all_result));
+  }
 
+  trace::Span merge_span("sort.merge");
   return MergeSortedTable(all_to_all_result, sort_columns, sort_direction, output);
 }
 
@@ -797,13 +1293,15 @@ Status DistributedSortInitialSampling(const std::shared_ptr<Table> &table,
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::SortTable(arrow_table,
                                                         sort_columns[0],
                                                         ToArrowPool(ctx),
-                                                        sorted_table, sort_direction[0]));
+                                                        sorted_table, sort_direction[0],
+                                                        GetSortThreads(ctx)));
   } else {
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::SortTableMultiColumns(arrow_table,
                                                                     sort_columns,
                                                                     ToArrowPool(ctx),
                                                                     sorted_table,
-                                                                    sort_direction));
+                                                                    sort_direction,
+                                                                    GetSortThreads(ctx)));
   }
 
   return Table::FromArrowTable(ctx, sorted_table, output);
@@ -823,6 +1321,8 @@ Status DistributedSort(const std::shared_ptr<Table> &table,
                        std::shared_ptr<Table> &output,
                        const std::vector<bool> &sort_direction,
                        SortOptions sort_options) {
+  MemoryScope memory_scope(table->GetContext(), "sort");
+  trace::Span span("sort");
   if(sort_options.sort_method == sort_options.INITIAL_SAMPLE) {
     return DistributedSortInitialSampling(table, sort_columns, output, sort_direction, sort_options);
   } else {
@@ -885,10 +1385,17 @@ Status Join(const std::shared_ptr<Table> &left, const std::shared_ptr<Table> &ri
   } else {
     std::shared_ptr<arrow::Table> table, left_table, right_table;
     const auto &ctx = left->GetContext();
-    auto pool = cylon::ToArrowPool(ctx);
 
     left->ToArrowTable(left_table);
     right->ToArrowTable(right_table);
+    if (join_config.GetAlgorithm() == cylon::join::config::AUTO) {
+      join::JoinPlan plan;
+      RETURN_CYLON_STATUS_IF_FAILED(join::PlanJoin(left_table, right_table, join_config, &plan));
+      return Join(left, right, join_config.WithAlgorithm(plan.algorithm), out);
+    }
+    MemoryScope memory_scope(ctx, "join");
+    trace::Span span("join.local");
+    auto pool = cylon::ToArrowPool(ctx);
     // if it is a sort algorithm and certain key types, we are going to do an in-place sort
     if (!join_config.IsMultiColumn() && join_config.GetAlgorithm() == cylon::join::config::SORT) {
       int lIndex = join_config.GetLeftColumnIdx()[0];
@@ -918,6 +1425,36 @@ Status Table::ToArrowTable(std::shared_ptr<arrow::Table> &out) {
   return Status::OK();
 }
 
+/**
+ * Joins the local partition of one table with the other table gathered from all workers
+ */
+static Status BroadcastJoin(const std::shared_ptr<Table> &left, const std::shared_ptr<Table> &right,
+                            const join::config::JoinConfig &join_config, bool broadcast_right,
+                            std::shared_ptr<cylon::Table> &out) {
+  const auto &ctx = left->GetContext();
+  auto pool = cylon::ToArrowPool(ctx);
+
+  std::vector<std::shared_ptr<Table>> gathered;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->AllGather(broadcast_right ? right : left,
+                                                                  &gathered));
+  std::vector<std::shared_ptr<arrow::Table>> tables;
+  tables.reserve(gathered.size());
+  for (const auto &t: gathered) {
+    tables.push_back(t->get_table());
+  }
+  CYLON_ASSIGN_OR_RAISE(auto concat, arrow::ConcatenateTables(tables,
+                                                              arrow::ConcatenateTablesOptions::Defaults(),
+                                                              pool))
+  gathered.clear();
+  tables.clear();
+  CYLON_ASSIGN_OR_RAISE(auto combined, concat->CombineChunks(pool))
+
+  std::shared_ptr<Table> replicated;
+  RETURN_CYLON_STATUS_IF_FAILED(Table::FromArrowTable(ctx, std::move(combined), replicated));
+  return broadcast_right ? Join(left, replicated, join_config, out)
+                         : Join(replicated, right, join_config, out);
+}
+
 Status DistributedJoin(const std::shared_ptr<Table> &left, const std::shared_ptr<Table> &right,
                        const join::config::JoinConfig &join_config,
                        std::shared_ptr<cylon::Table> &out) {
@@ -926,19 +1463,58 @@ Status DistributedJoin(const std::shared_ptr<Table> &left, const std::shared_ptr
   if (ctx->GetWorldSize() == 1) {
     return Join(left, right, join_config, out);
   }
+  MemoryScope memory_scope(ctx, "join");
+  trace::Span span("join");
+
+  join::JoinPlan plan;
+  RETURN_CYLON_STATUS_IF_FAILED(join::PlanDistributedJoin(left, right, join_config, &plan));
+  const auto &config = join_config.WithAlgorithm(plan.algorithm);
+  if (plan.distribution != join::SHUFFLE) {
+    return BroadcastJoin(left, right, config, plan.distribution == join::BROADCAST_RIGHT, out);
+  }
+
+  // hash joins reuse the row hashes of the shuffle for their hash tables
+  const bool carry_hashes = config.GetAlgorithm() == join::config::HASH;
+  std::shared_ptr<std::vector<uint32_t>> left_hashes, right_hashes;
 
   std::shared_ptr<arrow::Table> left_final_table, right_final_table;
-  RETURN_CYLON_STATUS_IF_FAILED(shuffle_two_tables_by_hashing(ctx,
-                                                              left,
-                                                              join_config.GetLeftColumnIdx(),
-                                                              right,
-                                                              join_config.GetRightColumnIdx(),
-                                                              left_final_table,
-                                                              right_final_table));
+  if (ctx->GetConfig(kSkewAwareShuffleConfig) == "true"
+      && join_config.GetType() != join::config::FULL_OUTER) {
+    RETURN_CYLON_STATUS_IF_FAILED(shuffle_two_tables_skew_aware(ctx,
+                                                                left,
+                                                                join_config.GetLeftColumnIdx(),
+                                                                right,
+                                                                join_config.GetRightColumnIdx(),
+                                                                join_config.GetType(),
+                                                                left_final_table,
+                                                                right_final_table,
+                                                                carry_hashes ? &left_hashes : nullptr,
+                                                                carry_hashes ? &right_hashes : nullptr));
+  } else if (carry_hashes) {
+    RETURN_CYLON_STATUS_IF_FAILED(shuffle_table_by_hashing(ctx, left, join_config.GetLeftColumnIdx(),
+                                                           left_final_table, left_hashes));
+    RETURN_CYLON_STATUS_IF_FAILED(shuffle_table_by_hashing(ctx, right, join_config.GetRightColumnIdx(),
+                                                           right_final_table, right_hashes));
+  } else {
+    RETURN_CYLON_STATUS_IF_FAILED(shuffle_two_tables_by_hashing(ctx,
+                                                                left,
+                                                                join_config.GetLeftColumnIdx(),
+                                                                right,
+                                                                join_config.GetRightColumnIdx(),
+                                                                left_final_table,
+                                                                right_final_table));
+  }
 
+  trace::Span local_span("join.local");
   std::shared_ptr<arrow::Table> table;
-  RETURN_CYLON_STATUS_IF_FAILED(join::JoinTables(left_final_table, right_final_table,
-                                                 join_config, &table, cylon::ToArrowPool(ctx)));
+  if (carry_hashes) {
+    RETURN_CYLON_STATUS_IF_FAILED(join::HashJoin(left_final_table, right_final_table, config,
+                                                 left_hashes, right_hashes, &table,
+                                                 cylon::ToArrowPool(ctx)));
+  } else {
+    RETURN_CYLON_STATUS_IF_FAILED(join::JoinTables(left_final_table, right_final_table,
+                                                   config, &table, cylon::ToArrowPool(ctx)));
+  }
   return Table::FromArrowTable(ctx, std::move(table), out);
 }
 
@@ -951,9 +1527,11 @@ Status Select(const std::shared_ptr<Table> &table, const std::function<bool(cylo
   auto pool = cylon::ToArrowPool(ctx);
   std::shared_ptr<arrow::Table> out_table;
 
+  // the mask is scratch memory
+  OperatorArena arena(ctx);
   auto kI = table->Rows();
   if (kI) {
-    arrow::BooleanBuilder boolean_builder(pool);
+    arrow::BooleanBuilder boolean_builder(arena.pool());
     RETURN_CYLON_STATUS_IF_ARROW_FAILED(boolean_builder.Reserve(kI));
 
     for (int64_t row_index = 0; row_index < kI; row_index++) {
@@ -975,6 +1553,29 @@ Status Select(const std::shared_ptr<Table> &table, const std::function<bool(cylo
   return Status::OK();
 }
 
+Status Select(const std::shared_ptr<Table> &table, const compute::Predicate &predicate,
+              std::shared_ptr<Table> &out) {
+  const auto &ctx = table->GetContext();
+  const auto &table_ = table->get_table();
+  auto pool = cylon::ToArrowPool(ctx);
+  std::shared_ptr<arrow::Table> out_table;
+
+  if (table->Rows()) {
+    std::shared_ptr<arrow::BooleanArray> mask;
+    RETURN_CYLON_STATUS_IF_FAILED(compute::Evaluate(table_, predicate, &mask, pool));
+
+    arrow::compute::ExecContext exec_ctx(pool);
+    CYLON_ASSIGN_OR_RAISE(auto filter_res, arrow::compute::Filter(table_, mask,
+                                                                  arrow::compute::FilterOptions::Defaults(),
+                                                                  &exec_ctx))
+    out_table = filter_res.table();
+  } else {
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::Duplicate(table_, pool, out_table));
+  }
+  out = std::make_shared<cylon::Table>(ctx, out_table);
+  return Status::OK();
+}
+
 Status Union(const std::shared_ptr<Table> &first, const std::shared_ptr<Table> &second,
              std::shared_ptr<Table> &out) {
   std::shared_ptr<arrow::Table> ltab = first->get_table();
@@ -982,11 +1583,9 @@ Status Union(const std::shared_ptr<Table> &first, const std::shared_ptr<Table> &
   const auto &ctx = first->GetContext();
   auto pool = ToArrowPool(ctx);
 
-  COMBINE_CHUNKS_RETURN_CYLON_STATUS(ltab, pool);
-  COMBINE_CHUNKS_RETURN_CYLON_STATUS(rtab, pool);
-
   RETURN_CYLON_STATUS_IF_FAILED(VerifyTableSchema(ltab, rtab));
 
+  // chunked columns are hashed and compared in place. the output is combined below
   std::unique_ptr<DualTableRowIndexHash> hash;
   RETURN_CYLON_STATUS_IF_FAILED(DualTableRowIndexHash::Make(ltab, rtab, &hash));
 
@@ -1356,70 +1955,158 @@ Status Shuffle(const std::shared_ptr<Table> &table, const std::vector<int> &hash
   return cylon::Table::FromArrowTable(ctx_, std::move(table_out), output);
 }
 
-Status Unique(const std::shared_ptr<Table> &in, const std::vector<int> &cols,
-              std::shared_ptr<cylon::Table> &out, bool first) {
-#ifdef CYLON_DEBUG
-  auto p1 = std::chrono::high_resolution_clock::now();
-#endif
-  const auto &ctx = in->GetContext();
-  auto pool = cylon::ToArrowPool(ctx);
-  std::shared_ptr<arrow::Table> out_table, in_table = in->get_table();
+Status Shuffle(const std::shared_ptr<Table> &table, const std::vector<int> &hash_columns,
+               std::shared_ptr<cylon::Table> &output,
+               std::shared_ptr<std::vector<uint32_t>> &row_hashes) {
+  const auto &ctx_ = table->GetContext();
+  std::shared_ptr<arrow::Table> table_out;
+  RETURN_CYLON_STATUS_IF_FAILED(shuffle_table_by_hashing(ctx_, table, hash_columns, table_out,
+                                                         row_hashes));
+  return cylon::Table::FromArrowTable(ctx_, std::move(table_out), output);
+}
 
-  if (!in->Empty()) {
-    if (in_table->column(0)->num_chunks() > 1) {
-      CYLON_ASSIGN_OR_RAISE(in_table, in_table->CombineChunks(pool))
-    }
+static int GetUniqueThreads(const std::shared_ptr<CylonContext> &ctx) {
+  const auto &config = ctx->GetConfig(kUniqueThreadsConfig);
+  return config.empty() ? 1 : util::GetNumThreads(std::stoi(config));
+}
 
-    std::unique_ptr<TableRowIndexEqualTo> row_comp;
-    RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexEqualTo::Make(in_table, cols, &row_comp));
+// below this many rows, Unique deduplicates in a single hash set
+static constexpr int64_t kMinParallelUniqueRows = 1 << 14;
+// hash partitions per thread of a parallel Unique, so that uneven partitions get balanced
+static constexpr int kUniquePartitionsPerThread = 4;
 
-    std::unique_ptr<TableRowIndexHash> row_hash;
-    RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexHash::Make(in_table, cols, &row_hash));
+/**
+ * Finds the rows that Unique keeps (the first or the last row of each distinct key), in the order
+ * Unique outputs them, given the row hashes of the key columns (HashRows).
+ *
+ * With more than one thread, the rows are split into hash partitions. Equal keys always fall into
+ * the same partition, so the partitions are deduplicated independently, each in its own hash set.
+ */
+static Status unique_row_indices(const std::shared_ptr<arrow::Table> &table,
+                                 const std::vector<int> &cols,
+                                 std::shared_ptr<std::vector<uint32_t>> hashes,
+                                 bool first, int num_threads, std::vector<int64_t> &indices) {
+  const int64_t num_rows = table->num_rows();
+  indices.clear();
+  if (num_rows == 0) {
+    return Status::OK();
+  }
 
-    const int64_t num_rows = in_table->num_rows();
-    ska::bytell_hash_set<int64_t, TableRowIndexHash, TableRowIndexEqualTo>
-        rows_set(num_rows, *row_hash, *row_comp);
+  std::unique_ptr<TableRowIndexEqualTo> row_comp;
+  RETURN_CYLON_STATUS_IF_FAILED(TableRowIndexEqualTo::Make(table, cols, &row_comp));
+  const TableRowIndexHash row_hash(hashes);
 
-    arrow::Int64Builder filter(pool);
-    RETURN_CYLON_STATUS_IF_ARROW_FAILED(filter.Reserve(num_rows));
-#ifdef CYLON_DEBUG
-    auto p2 = std::chrono::high_resolution_clock::now();
-#endif
+  if (num_threads <= 1 || num_rows < kMinParallelUniqueRows) {
+    ska::bytell_hash_set<int64_t, TableRowIndexHash, TableRowIndexEqualTo>
+        rows_set(num_rows, row_hash, *row_comp);
     if (first) {
       for (int64_t row = 0; row < num_rows; ++row) {
-        const auto &res = rows_set.insert(row);
-        if (res.second) {
-          filter.UnsafeAppend(row);
+        if (rows_set.insert(row).second) {
+          indices.push_back(row);
         }
       }
     } else {
-      for (int64_t row = num_rows - 1; row > 0; --row) {
-        const auto &res = rows_set.insert(row);
-        if (res.second) {
-          filter.UnsafeAppend(row);
+      for (int64_t row = num_rows - 1; row >= 0; --row) {
+        if (rows_set.insert(row).second) {
+          indices.push_back(row);
         }
       }
     }
-#ifdef CYLON_DEBUG
-    auto p3 = std::chrono::high_resolution_clock::now();
-#endif
-    rows_set.clear();
-#ifdef CYLON_DEBUG
-    auto p4 = std::chrono::high_resolution_clock::now();
-#endif
-    CYLON_ASSIGN_OR_RAISE(auto take_arr, filter.Finish());
-    CYLON_ASSIGN_OR_RAISE(auto take_res, arrow::compute::Take(in_table, take_arr))
-    out_table = take_res.table();
-
-#ifdef CYLON_DEBUG
-    auto p5 = std::chrono::high_resolution_clock::now();
-    LOG(INFO) << "P1 " << std::chrono::duration_cast<std::chrono::milliseconds>(p2 - p1).count()
-              << " P2 " << std::chrono::duration_cast<std::chrono::milliseconds>(p3 - p2).count()
-              << " P3 " << std::chrono::duration_cast<std::chrono::milliseconds>(p4 - p3).count()
-              << " P4 " << std::chrono::duration_cast<std::chrono::milliseconds>(p5 - p4).count()
-              << " tot " << std::chrono::duration_cast<std::chrono::milliseconds>(p5 - p1).count()
-              << " tot " << rows_set.load_factor() << " " << rows_set.bucket_count();
-#endif
+    return Status::OK();
+  }
+
+  const uint32_t num_parts = num_threads * kUniquePartitionsPerThread;
+  const auto &partition_of = [&](int64_t row) {
+    // fibonacci hash, so that the partitions do not depend on the low bits the hash set uses
+    return static_cast<uint32_t>(((uint64_t) ((*hashes)[row] * 2654435769u) * num_parts) >> 32);
+  };
+
+  // counting sort of the rows by partition, which keeps the rows of a partition in order
+  std::vector<int64_t> part_offsets(num_parts + 1, 0);
+  for (int64_t row = 0; row < num_rows; row++) {
+    part_offsets[partition_of(row) + 1]++;
+  }
+  std::partial_sum(part_offsets.begin(), part_offsets.end(), part_offsets.begin());
+  std::vector<int64_t> part_rows(num_rows);
+  {
+    std::vector<int64_t> pos(part_offsets.begin(), part_offsets.end() - 1);
+    for (int64_t row = 0; row < num_rows; row++) {
+      part_rows[pos[partition_of(row)]++] = row;
+    }
+  }
+
+  // each row is marked by the single partition it belongs to
+  std::vector<uint8_t> keep(num_rows, 0);
+  RETURN_CYLON_STATUS_IF_FAILED(util::ParallelFor(num_threads, num_parts, [&](int64_t p) {
+    const int64_t begin = part_offsets[p], end = part_offsets[p + 1];
+    ska::bytell_hash_set<int64_t, TableRowIndexHash, TableRowIndexEqualTo>
+        rows_set(end - begin, row_hash, *row_comp);
+    if (first) {
+      for (int64_t i = begin; i < end; i++) {
+        keep[part_rows[i]] = rows_set.insert(part_rows[i]).second;
+      }
+    } else {
+      for (int64_t i = end - 1; i >= begin; i--) {
+        keep[part_rows[i]] = rows_set.insert(part_rows[i]).second;
+      }
+    }
+    return Status::OK();
+  }));
+
+  if (first) {
+    for (int64_t row = 0; row < num_rows; row++) {
+      if (keep[row]) indices.push_back(row);
+    }
+  } else {
+    for (int64_t row = num_rows - 1; row >= 0; row--) {
+      if (keep[row]) indices.push_back(row);
+    }
+  }
+  return Status::OK();
+}
+
+/**
+ * Takes the rows at indices from every column of the table
+ */
+static Status take_rows(const std::shared_ptr<CylonContext> &ctx,
+                        const std::shared_ptr<arrow::Table> &table,
+                        const std::vector<int64_t> &indices, int num_threads,
+                        std::shared_ptr<arrow::Table> &out) {
+  auto pool = cylon::ToArrowPool(ctx);
+  const auto &take_arr = std::make_shared<arrow::Int64Array>(
+      static_cast<int64_t>(indices.size()), arrow::Buffer::Wrap(indices));
+  arrow::ArrayVector out_arrays(table->num_columns());
+  RETURN_CYLON_STATUS_IF_FAILED(util::ParallelFor(num_threads, table->num_columns(), [&](int64_t c) {
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(util::TakeColumn(table->column((int) c), take_arr, pool,
+                                                         &out_arrays[c]));
+    return Status::OK();
+  }));
+  out = arrow::Table::Make(table->schema(), out_arrays, static_cast<int64_t>(indices.size()));
+  return Status::OK();
+}
+
+Status Unique(const std::shared_ptr<Table> &in, const std::vector<int> &cols,
+              std::shared_ptr<cylon::Table> &out, bool first) {
+  trace::Span span("unique");
+  const auto &ctx = in->GetContext();
+  std::shared_ptr<arrow::Table> out_table, in_table = in->get_table();
+
+  if (!in->Empty()) {
+    const int num_threads = GetUniqueThreads(ctx);
+    // chunked columns are hashed and compared in place
+    auto hashes = std::make_shared<std::vector<uint32_t>>();
+    {
+      trace::Span hash_span("unique.hash");
+      RETURN_CYLON_STATUS_IF_FAILED(HashRows(in, cols, *hashes));
+    }
+    std::vector<int64_t> indices;
+    {
+      trace::Span dedup_span("unique.dedup");
+      RETURN_CYLON_STATUS_IF_FAILED(
+          unique_row_indices(in_table, cols, std::move(hashes), first, num_threads, indices));
+    }
+    trace::Span take_span("unique.take");
+    RETURN_CYLON_STATUS_IF_FAILED(take_rows(ctx, in_table, indices, num_threads, out_table));
   } else {
     out_table = in_table;
   }
@@ -1433,10 +2120,36 @@ Status DistributedUnique(const std::shared_ptr<Table> &in, const std::vector<int
     return Unique(in, cols, out);
   }
 
-  std::shared_ptr<cylon::Table> shuffle_out;
-  RETURN_CYLON_STATUS_IF_FAILED(cylon::Shuffle(in, cols, shuffle_out));
+  // drop the local duplicates first, so that they are not shuffled
+  const int num_threads = GetUniqueThreads(ctx);
+  auto hashes = std::make_shared<std::vector<uint32_t>>();
+  RETURN_CYLON_STATUS_IF_FAILED(HashRows(in, cols, *hashes));
+  std::vector<int64_t> indices;
+  RETURN_CYLON_STATUS_IF_FAILED(
+      unique_row_indices(in->get_table(), cols, hashes, true, num_threads, indices));
+
+  std::shared_ptr<arrow::Table> local_unique;
+  RETURN_CYLON_STATUS_IF_FAILED(take_rows(ctx, in->get_table(), indices, num_threads, local_unique));
+
+  // the shuffle carries the row hashes, which map to the same partitions as MapToHashPartitions,
+  // and the received rows are deduplicated on them
+  std::vector<uint32_t> local_hashes(indices.size());
+  for (size_t i = 0; i < indices.size(); i++) {
+    local_hashes[i] = (*hashes)[indices[i]];
+  }
+  hashes.reset();
+  std::vector<int64_t>().swap(indices);
 
-  return Unique(shuffle_out, cols, out);
+  std::shared_ptr<arrow::Table> shuffled;
+  RETURN_CYLON_STATUS_IF_FAILED(shuffle_table_with_row_hashes(
+      ctx, std::make_shared<Table>(ctx, std::move(local_unique)), local_hashes, shuffled, hashes));
+  std::vector<uint32_t>().swap(local_hashes);
+
+  RETURN_CYLON_STATUS_IF_FAILED(
+      unique_row_indices(shuffled, cols, std::move(hashes), true, num_threads, indices));
+  std::shared_ptr<arrow::Table> out_table;
+  RETURN_CYLON_STATUS_IF_FAILED(take_rows(ctx, shuffled, indices, num_threads, out_table));
+  return Table::FromArrowTable(ctx, std::move(out_table), out);
 }
 
 Status Equals(const std::shared_ptr<cylon::Table> &a, const std::shared_ptr<cylon::Table> &b,
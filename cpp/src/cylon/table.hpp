@@ -38,6 +38,10 @@
 
 namespace cylon {
 
+namespace compute {
+class Predicate;
+}
+
 /**
  * Table provides the main API for using cylon for data processing.
  */
@@ -298,7 +302,14 @@ Status DistributedIntersect(const std::shared_ptr<Table> &left, const std::share
                             std::shared_ptr<Table> &out);
 
 /**
- * Shuffles a table based on hashes
+ * CylonContext config for the approximate number of bytes of a table that Shuffle (and the distributed
+ * operations that shuffle by hashing) partitions and sends at a time. Defaults to 16MB
+ */
+constexpr const char *kShuffleBatchBytesConfig = "shuffle_batch_bytes";
+
+/**
+ * Shuffles a table based on hashes. The table is partitioned in batches of rows, and each batch is
+ * sent while the next one is being partitioned. The output has a chunk per received table.
  * @param table
  * @param hash_col_idx vector of column indices that needs to be hashed
  * @param output
@@ -307,6 +318,20 @@ Status DistributedIntersect(const std::shared_ptr<Table> &left, const std::share
 Status Shuffle(const std::shared_ptr<Table> &table, const std::vector<int> &hash_col_idx,
                std::shared_ptr<cylon::Table> &output);
 
+/**
+ * Shuffles a table based on hashes, and outputs the row hashes (HashRows of the hash columns) of the
+ * output table. The hashes travel with the rows as a hidden column, so that the local hash tables
+ * of the receivers (ie. HashGroupBy, HashJoin) can use them, instead of hashing the rows again.
+ * @param table
+ * @param hash_col_idx vector of column indices that needs to be hashed
+ * @param output
+ * @param row_hashes hash of each row of the output
+ * @return
+ */
+Status Shuffle(const std::shared_ptr<Table> &table, const std::vector<int> &hash_col_idx,
+               std::shared_ptr<cylon::Table> &output,
+               std::shared_ptr<std::vector<uint32_t>> &row_hashes);
+
 /**
  * Partition the table based on the hash
  * @param hash_columns the columns use for has
@@ -317,6 +342,13 @@ Status HashPartition(const std::shared_ptr<Table> &table, const std::vector<int>
                      int no_of_partitions,
                      std::unordered_map<int, std::shared_ptr<cylon::Table>> *output);
 
+/**
+ * CylonContext config for the number of threads of a local Sort (and the local sort of
+ * DistributedSort). Defaults to 1, and a value <= 0 uses all hardware threads. The sorted table is
+ * the same for any number of threads.
+ */
+constexpr const char *kSortThreadsConfig = "sort_threads";
+
 /**
  * Sort the table according to the given column, this is a local sort (if the table has chunked
  * columns, they will be merged in the output table)
@@ -361,8 +393,19 @@ struct SortOptions {
   uint32_t num_bins;
   uint64_t num_samples;
   SortMethod sort_method;
+  /**
+   * Memory (in bytes) a worker may use to hold table data while sorting. If the local table exceeds
+   * it, the table is sorted in runs of this size which are spilled to spill_dir as Arrow IPC files,
+   * shuffled run by run and k-way merged at the end. 0 disables spilling.
+   * Only used by REGULAR_SAMPLE.
+   */
+  int64_t memory_limit = 0;
+  /**
+   * Directory for the spilled runs. Defaults to $TMPDIR or /tmp
+   */
+  std::string spill_dir;
 
-  static SortOptions Defaults() { return {0, 0, REGULAR_SAMPLE}; }
+  static SortOptions Defaults() { return {0, 0, REGULAR_SAMPLE, 0, {}}; }
 };
 
 Status DistributedSort(const std::shared_ptr<Table> &table,
@@ -409,6 +452,17 @@ Status MergeSortedTable(const std::vector<std::shared_ptr<Table>> &tables,
 Status Select(const std::shared_ptr<Table> &table, const std::function<bool(cylon::Row)> &selector,
               std::shared_ptr<Table> &output);
 
+/**
+ * Filters out rows based on a vectorized predicate. Prefer this over the selector function version,
+ * as rows are evaluated in batches into a selection bitmap.
+ * @param table
+ * @param predicate
+ * @param output
+ * @return
+ */
+Status Select(const std::shared_ptr<Table> &table, const compute::Predicate &predicate,
+              std::shared_ptr<Table> &output);
+
 /**
  * Creates a View of an existing table by dropping one or more columns
  * @param table
@@ -419,16 +473,34 @@ Status Select(const std::shared_ptr<Table> &table, const std::function<bool(cylo
 Status Project(const std::shared_ptr<Table> &table, const std::vector<int32_t> &project_columns,
                std::shared_ptr<Table> &output);
 
+/**
+ * CylonContext config for the number of threads of a local Unique (and the local phases of
+ * DistributedUnique). Defaults to 1, and a value <= 0 uses all hardware threads. With more than one
+ * thread, rows are deduplicated in hash partitions, and the output is the same for any number of
+ * threads.
+ */
+constexpr const char *kUniqueThreadsConfig = "unique_threads";
+
 /**
  * Creates a new table by dropping the duplicated elements column-wise
  * @param table
  * @param cols
  * @param out
+ * @param first keep the first row of each duplicate (in row order), or the last row (in reverse
+ * row order)
  * @return Status
  */
 Status Unique(const std::shared_ptr<Table> &in, const std::vector<int> &cols,
               std::shared_ptr<cylon::Table> &out, bool first = true);
 
+/**
+ * Distributed Unique. Local duplicates are dropped before the shuffle, which reuses the row hashes
+ * of the local Unique to partition the rows, and the shuffled rows are then deduplicated again.
+ * @param in
+ * @param cols
+ * @param out
+ * @return
+ */
 Status DistributedUnique(const std::shared_ptr<Table> &in, const std::vector<int> &cols,
                          std::shared_ptr<cylon::Table> &out);
 
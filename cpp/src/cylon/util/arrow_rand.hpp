@@ -16,6 +16,7 @@
 #define CYLON_CPP_SRC_CYLON_UTIL_ARROW_RAND_HPP_
 
 #include <arrow/api.h>
+#include <algorithm>
 #include <random>
 
 namespace cylon {
@@ -80,7 +81,7 @@ struct RandomArrayGenerator {
 
     data = *arrow::AllocateEmptyBitmap(size, pool);
     if (true_probability > 0.0) {
-      GenerateBitmap(validity->mutable_data(), size, 1 - true_probability, nullptr, seed++);
+      GenerateBitmap(data->mutable_data(), size, 1 - true_probability, nullptr, seed++);
     }
 
     auto array_data = arrow::ArrayData::Make(arrow::boolean(),
@@ -115,6 +116,41 @@ struct RandomArrayGenerator {
     return std::make_shared<arrow::NumericArray<ArrowType>>(std::move(array_data));
   }
 
+  std::shared_ptr<arrow::Array> String(int64_t size,
+                                       int32_t min_length,
+                                       int32_t max_length,
+                                       double null_probability = 0.0) {
+    std::shared_ptr<arrow::Buffer> validity = nullptr, offsets, data;
+    int64_t null_count = 0;
+    if (null_probability > 0.0) {
+      validity = *arrow::AllocateEmptyBitmap(size, pool);
+      GenerateBitmap(validity->mutable_data(), size, null_probability, &null_count, seed++);
+    }
+
+    // lengths of the values, null values are empty
+    offsets = *arrow::AllocateBuffer((size + 1) * sizeof(int32_t), pool);
+    auto *mut_offsets = reinterpret_cast<int32_t *>(offsets->mutable_data());
+    GenerateTypedData<int32_t>(mut_offsets + 1, size, min_length, max_length, seed++);
+    mut_offsets[0] = 0;
+    for (int64_t i = 0; i < size; i++) {
+      const bool valid = validity == nullptr || arrow::BitUtil::GetBit(validity->data(), i);
+      mut_offsets[i + 1] = mut_offsets[i] + (valid ? mut_offsets[i + 1] : 0);
+    }
+
+    data = *arrow::AllocateBuffer(mut_offsets[size], pool);
+    std::mt19937 rng(seed++);
+    std::uniform_int_distribution<int> dist('a', 'z');
+    std::generate(data->mutable_data(), data->mutable_data() + mut_offsets[size],
+                  [&] { return static_cast<uint8_t>(dist(rng)); });
+
+    auto array_data = arrow::ArrayData::Make(arrow::utf8(),
+                                             size,
+                                             {std::move(validity), std::move(offsets),
+                                              std::move(data)},
+                                             null_count);
+    return std::make_shared<arrow::StringArray>(std::move(array_data));
+  }
+
  private:
   uint32_t seed;
   arrow::MemoryPool *pool;
@@ -24,46 +24,80 @@
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/arrow/arrow_kernels.hpp>
 #include <cylon/util/macros.hpp>
+#include <cylon/util/parallel.hpp>
 #include <iostream>
 
 namespace cylon {
 namespace util {
 
-arrow::Status SortTable(const std::shared_ptr<arrow::Table> &table, int32_t sort_column_index,
-                        arrow::MemoryPool *memory_pool, std::shared_ptr<arrow::Table> &sorted_table,
-                        bool ascending) {
-  std::shared_ptr<arrow::Table> tab_to_process;  // table referenced
-  // combine chunks if multiple chunks are available
-  if (table->column(sort_column_index)->num_chunks() > 1) {
-    const auto &res = table->CombineChunks(memory_pool);
-    RETURN_ARROW_STATUS_IF_FAILED(res.status());
-    tab_to_process = res.ValueOrDie();
+arrow::Status TakeColumn(const std::shared_ptr<arrow::ChunkedArray> &column,
+                         const std::shared_ptr<arrow::Array> &indices,
+                         arrow::MemoryPool *memory_pool,
+                         std::shared_ptr<arrow::Array> *out) {
+  if (column->num_chunks() <= 1) {
+    arrow::compute::ExecContext exec_context(memory_pool);
+    // no bounds check is needed as indices are guaranteed to be within range
+    const arrow::compute::TakeOptions &take_options = arrow::compute::TakeOptions::NoBoundsCheck();
+    ARROW_ASSIGN_OR_RAISE(auto res, arrow::compute::Take(GetChunkOrEmptyArray(column, 0, memory_pool),
+                                                         indices, take_options, &exec_context))
+    *out = res.make_array();
+    return arrow::Status::OK();
+  }
+
+  // arrow's Take would concatenate the chunks. copy the rows from the chunks instead
+  std::vector<int64_t> rows(indices->length());
+  if (indices->type_id() == arrow::Type::UINT64) {
+    const auto *values = indices->data()->GetValues<uint64_t>(1);
+    std::copy(values, values + indices->length(), rows.begin());
+  } else if (indices->type_id() == arrow::Type::INT64) {
+    const auto *values = indices->data()->GetValues<int64_t>(1);
+    std::copy(values, values + indices->length(), rows.begin());
   } else {
-    tab_to_process = table;
+    return arrow::Status::Invalid("unsupported index type " + indices->type()->ToString());
   }
-  const std::shared_ptr<arrow::Array> &column_to_sort =
-      cylon::util::GetChunkOrEmptyArray(tab_to_process->column(sort_column_index), 0);
+  return copy_array_by_indices(rows, column, out, memory_pool);
+}
 
+/**
+ * Takes the sorted rows of each column, with a column per task
+ */
+static arrow::Status TakeColumns(const std::shared_ptr<arrow::Table> &table,
+                                 const std::shared_ptr<arrow::UInt64Array> &indices,
+                                 arrow::MemoryPool *memory_pool, int num_threads,
+                                 arrow::ArrayVector &columns) {
+  columns.resize(table->num_columns());
+  const auto &status = ParallelFor(num_threads, table->num_columns(), [&](int64_t col_index) {
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(TakeColumn(table->column(col_index), indices, memory_pool,
+                                                   &columns[col_index]));
+    return Status::OK();
+  });
+  return status.is_ok() ? arrow::Status::OK() : arrow::Status::ExecutionError(status.get_msg());
+}
+
+arrow::Status SortTable(const std::shared_ptr<arrow::Table> &table, int32_t sort_column_index,
+                        arrow::MemoryPool *memory_pool, std::shared_ptr<arrow::Table> &sorted_table,
+                        bool ascending, int num_threads, arrow::MemoryPool *index_pool) {
+  if (index_pool == nullptr) {
+    index_pool = memory_pool;
+  }
   // sort to indices
   std::shared_ptr<arrow::UInt64Array> sorted_column_index;
-  RETURN_ARROW_STATUS_IF_FAILED(
-      cylon::SortIndices(memory_pool, column_to_sort, sorted_column_index, ascending));
+  const auto &column_to_sort = table->column(sort_column_index);
+  if (column_to_sort->num_chunks() > 1) {
+    // the multi column kernels sort the chunks in place
+    RETURN_ARROW_STATUS_IF_FAILED(
+        SortIndicesMultiColumns(index_pool, table, {sort_column_index}, sorted_column_index,
+                                {ascending}, num_threads));
+  } else {
+    RETURN_ARROW_STATUS_IF_FAILED(
+        cylon::SortIndices(index_pool, GetChunkOrEmptyArray(column_to_sort, 0),
+                           sorted_column_index, ascending, num_threads));
+  }
 
   // now sort everything based on sorted index
   arrow::ArrayVector sorted_columns;
-  sorted_columns.reserve(table->num_columns());
-
-  arrow::compute::ExecContext exec_context(memory_pool);
-  // no bounds check is needed as indices are guaranteed to be within range
-  const arrow::compute::TakeOptions &take_options = arrow::compute::TakeOptions::NoBoundsCheck();
-
-  for (int32_t col_index = 0; col_index < tab_to_process->num_columns(); ++col_index) {
-    const arrow::Result<arrow::Datum> &res = arrow::compute::Take(
-        cylon::util::GetChunkOrEmptyArray(tab_to_process->column(col_index), 0),
-        sorted_column_index, take_options, &exec_context);
-    RETURN_ARROW_STATUS_IF_FAILED(res.status());
-    sorted_columns.emplace_back(res.ValueOrDie().make_array());
-  }
+  RETURN_ARROW_STATUS_IF_FAILED(TakeColumns(table, sorted_column_index, memory_pool,
+                                            num_threads, sorted_columns));
 
   sorted_table = arrow::Table::Make(table->schema(), sorted_columns);
   return arrow::Status::OK();
@@ -73,38 +107,23 @@ arrow::Status SortTableMultiColumns(const std::shared_ptr<arrow::Table> &table,
                                     const std::vector<int32_t> &sort_column_indices,
                                     arrow::MemoryPool *memory_pool,
                                     std::shared_ptr<arrow::Table> &sorted_table,
-                                    const std::vector<bool> &sort_column_directions) {
-  std::shared_ptr<arrow::Table> combined_tab;  // table referenced
-  // combine chunks if multiple chunks are available
-  if (util::CheckArrowTableContainsChunks(table, sort_column_indices)) {
-    ARROW_ASSIGN_OR_RAISE(combined_tab, table->CombineChunks(memory_pool));
-  } else {
-    combined_tab = table;
+                                    const std::vector<bool> &sort_column_directions,
+                                    int num_threads, arrow::MemoryPool *index_pool) {
+  if (index_pool == nullptr) {
+    index_pool = memory_pool;
   }
-
-  // sort to indices
+  // sort to indices. chunked columns are sorted without combining the chunks
   std::shared_ptr<arrow::UInt64Array> sorted_column_index;
   RETURN_ARROW_STATUS_IF_FAILED(
-      SortIndicesMultiColumns(memory_pool, combined_tab, sort_column_indices, sorted_column_index,
-                              sort_column_directions));
+      SortIndicesMultiColumns(index_pool, table, sort_column_indices, sorted_column_index,
+                              sort_column_directions, num_threads));
 
   // now sort everything based on sorted index
   arrow::ArrayVector sorted_columns;
-  sorted_columns.reserve(combined_tab->num_columns());
-
-  arrow::compute::ExecContext exec_context(memory_pool);
-  // no bounds check is needed as indices are guaranteed to be within range
-  const arrow::compute::TakeOptions &take_options = arrow::compute::TakeOptions::NoBoundsCheck();
-
-  for (int col_index = 0; col_index < combined_tab->num_columns(); ++col_index) {
-    const arrow::Result<arrow::Datum> &res = arrow::compute::Take(
-        cylon::util::GetChunkOrEmptyArray(combined_tab->column(col_index), 0),
-        sorted_column_index, take_options, &exec_context);
-    RETURN_ARROW_STATUS_IF_FAILED(res.status());
-    sorted_columns.emplace_back(res.ValueOrDie().make_array());
-  }
+  RETURN_ARROW_STATUS_IF_FAILED(TakeColumns(table, sorted_column_index, memory_pool,
+                                            num_threads, sorted_columns));
 
-  sorted_table = arrow::Table::Make(combined_tab->schema(), sorted_columns);
+  sorted_table = arrow::Table::Make(table->schema(), sorted_columns);
   return arrow::Status::OK();
 }
 
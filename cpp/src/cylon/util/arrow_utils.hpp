@@ -18,6 +18,9 @@
 #include <arrow/api.h>
 #include <arrow/table.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace cylon {
 namespace util {
 
@@ -60,27 +63,86 @@ static inline constexpr int64_t CheckBit(const int64_t v) {
   return (v >> (sizeof(int64_t) * CHAR_BIT - 1)) & int64_t(1);
 }
 
+/**
+ * Sorts a table by a column. The sort (and taking the sorted rows of the columns) uses up to
+ * num_threads threads, and the result does not depend on the number of threads. The sort indices
+ * are allocated from index_pool (ie. an operator arena), or memory_pool if it is null.
+ */
 arrow::Status SortTable(const std::shared_ptr<arrow::Table> &table, int32_t sort_column_index,
                         arrow::MemoryPool *memory_pool, std::shared_ptr<arrow::Table> &sorted_table,
-                        bool ascending = true);
-
-arrow::Status SortTableMultiColumns(const std::shared_ptr<arrow::Table> &table,
-                                    const std::vector<int32_t> &sort_column_indices,
-                                    arrow::MemoryPool *memory_pool,
-                                    std::shared_ptr<arrow::Table> &sorted_table,
-                                    const std::vector<bool> &sort_column_directions);
+                        bool ascending = true, int num_threads = 1,
+                        arrow::MemoryPool *index_pool = nullptr);
 
 arrow::Status SortTableMultiColumns(const std::shared_ptr<arrow::Table> &table,
                                     const std::vector<int32_t> &sort_column_indices,
                                     arrow::MemoryPool *memory_pool,
                                     std::shared_ptr<arrow::Table> &sorted_table,
-                                    const std::vector<bool> &sort_column_directions);
+                                    const std::vector<bool> &sort_column_directions,
+                                    int num_threads = 1,
+                                    arrow::MemoryPool *index_pool = nullptr);
 
 arrow::Status copy_array_by_indices(const std::vector<int64_t> &indices,
                                     const std::shared_ptr<arrow::Array> &source_array,
                                     std::shared_ptr<arrow::Array> *copied_array,
                                     arrow::MemoryPool *memory_pool = arrow::default_memory_pool());
 
+/**
+ * Copies the rows at indices (-1 for a null) of a chunked array into a single array. Rows are read
+ * from their chunks, without concatenating the chunks first.
+ * @param indices
+ * @param source_column
+ * @param copied_array
+ * @param memory_pool
+ * @return
+ */
+arrow::Status copy_array_by_indices(const std::vector<int64_t> &indices,
+                                    const std::shared_ptr<arrow::ChunkedArray> &source_column,
+                                    std::shared_ptr<arrow::Array> *copied_array,
+                                    arrow::MemoryPool *memory_pool = arrow::default_memory_pool());
+
+/**
+ * Takes the rows at indices of a column, into a single array. A column with a single chunk is
+ * taken with arrow::compute::Take, and the rows of other columns are read from their chunks.
+ * @param column
+ * @param indices Int64 or UInt64 indices, within the bounds of the column
+ * @param memory_pool
+ * @param out
+ * @return
+ */
+arrow::Status TakeColumn(const std::shared_ptr<arrow::ChunkedArray> &column,
+                         const std::shared_ptr<arrow::Array> &indices,
+                         arrow::MemoryPool *memory_pool,
+                         std::shared_ptr<arrow::Array> *out);
+
+/**
+ * Maps a row index of a chunked array to its chunk, and the offset of the row in that chunk
+ */
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const arrow::ArrayVector &chunks) : offsets(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); i++) {
+      offsets[i + 1] = offsets[i] + chunks[i]->length();
+    }
+  }
+
+  /**
+   * @param index row index of the chunked array
+   * @return (chunk, offset in the chunk)
+   */
+  inline std::pair<int, int64_t> Resolve(int64_t index) const {
+    if (offsets.size() <= 2) {
+      return {0, index};
+    }
+    // last chunk that starts at or before the index, skipping empty chunks
+    const auto it = std::upper_bound(offsets.begin() + 1, offsets.end() - 1, index);
+    const auto chunk = static_cast<int>(it - offsets.begin()) - 1;
+    return {chunk, index - offsets[chunk]};
+  }
+
+ private:
+  std::vector<int64_t> offsets;
+};
+
 /**
  * Free the buffers of a arrow table, after this, the table is no-longer valid
  * @param table the table pointer
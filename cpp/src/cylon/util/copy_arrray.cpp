@@ -16,6 +16,7 @@
 #include <arrow/api.h>
 #include <glog/logging.h>
 #include <cylon/util/arrow_utils.hpp>
+#include <cylon/util/macros.hpp>
 #include <cylon/status.hpp>
 
 namespace cylon {
@@ -282,5 +283,123 @@ arrow::Status copy_array_by_indices(const std::vector<int64_t> &indices,
   }
 }
 
+template<typename TYPE>
+arrow::Status do_copy_chunked_array(const std::vector<int64_t> &indices,
+                                    const std::shared_ptr<arrow::ChunkedArray> &source_column,
+                                    std::shared_ptr<arrow::Array> *copied_array,
+                                    arrow::MemoryPool *memory_pool) {
+  using ARRAY_TYPE = typename arrow::TypeTraits<TYPE>::ArrayType;
+  using BUILDER_TYPE = typename arrow::TypeTraits<TYPE>::BuilderType;
+
+  std::vector<std::shared_ptr<ARRAY_TYPE>> chunks;
+  chunks.reserve(source_column->num_chunks());
+  for (const auto &chunk: source_column->chunks()) {
+    chunks.push_back(std::static_pointer_cast<ARRAY_TYPE>(chunk));
+  }
+  const ChunkResolver resolver(source_column->chunks());
+
+  BUILDER_TYPE builder(source_column->type(), memory_pool);
+  RETURN_ARROW_STATUS_IF_FAILED(builder.Reserve(indices.size()));
+  for (auto &index : indices) {
+    if (index == -1) {
+      RETURN_ARROW_STATUS_IF_FAILED(builder.AppendNull());
+      continue;
+    }
+    const auto &loc = resolver.Resolve(index);
+    const auto &chunk = chunks[loc.first];
+    if (chunk->IsNull(loc.second)) {
+      RETURN_ARROW_STATUS_IF_FAILED(builder.AppendNull());
+    } else {
+      RETURN_ARROW_STATUS_IF_FAILED(builder.Append(chunk->GetView(loc.second)));
+    }
+  }
+  return builder.Finish(copied_array);
+}
+
+arrow::Status copy_array_by_indices(const std::vector<int64_t> &indices,
+                                    const std::shared_ptr<arrow::ChunkedArray> &source_column,
+                                    std::shared_ptr<arrow::Array> *copied_array,
+                                    arrow::MemoryPool *memory_pool) {
+  if (source_column->num_chunks() <= 1) {
+    return copy_array_by_indices(indices, GetChunkOrEmptyArray(source_column, 0, memory_pool),
+                                 copied_array, memory_pool);
+  }
+
+  switch (source_column->type()->id()) {
+    case arrow::Type::BOOL:
+      return do_copy_chunked_array<arrow::BooleanType>(indices, source_column, copied_array,
+                                                       memory_pool);
+    case arrow::Type::UINT8:
+      return do_copy_chunked_array<arrow::UInt8Type>(indices, source_column, copied_array,
+                                                     memory_pool);
+    case arrow::Type::INT8:
+      return do_copy_chunked_array<arrow::Int8Type>(indices, source_column, copied_array,
+                                                    memory_pool);
+    case arrow::Type::UINT16:
+      return do_copy_chunked_array<arrow::UInt16Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::INT16:
+      return do_copy_chunked_array<arrow::Int16Type>(indices, source_column, copied_array,
+                                                     memory_pool);
+    case arrow::Type::UINT32:
+      return do_copy_chunked_array<arrow::UInt32Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::INT32:
+      return do_copy_chunked_array<arrow::Int32Type>(indices, source_column, copied_array,
+                                                     memory_pool);
+    case arrow::Type::UINT64:
+      return do_copy_chunked_array<arrow::UInt64Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::INT64:
+      return do_copy_chunked_array<arrow::Int64Type>(indices, source_column, copied_array,
+                                                     memory_pool);
+    case arrow::Type::HALF_FLOAT:
+      return do_copy_chunked_array<arrow::HalfFloatType>(indices, source_column, copied_array,
+                                                         memory_pool);
+    case arrow::Type::FLOAT:
+      return do_copy_chunked_array<arrow::FloatType>(indices, source_column, copied_array,
+                                                     memory_pool);
+    case arrow::Type::DOUBLE:
+      return do_copy_chunked_array<arrow::DoubleType>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::DATE32:
+      return do_copy_chunked_array<arrow::Date32Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::DATE64:
+      return do_copy_chunked_array<arrow::Date64Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::TIMESTAMP:
+      return do_copy_chunked_array<arrow::TimestampType>(indices, source_column, copied_array,
+                                                         memory_pool);
+    case arrow::Type::TIME32:
+      return do_copy_chunked_array<arrow::Time32Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::TIME64:
+      return do_copy_chunked_array<arrow::Time64Type>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::STRING:
+      return do_copy_chunked_array<arrow::StringType>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::LARGE_STRING:
+      return do_copy_chunked_array<arrow::LargeStringType>(indices, source_column, copied_array,
+                                                           memory_pool);
+    case arrow::Type::BINARY:
+      return do_copy_chunked_array<arrow::BinaryType>(indices, source_column, copied_array,
+                                                      memory_pool);
+    case arrow::Type::LARGE_BINARY:
+      return do_copy_chunked_array<arrow::LargeBinaryType>(indices, source_column, copied_array,
+                                                           memory_pool);
+    case arrow::Type::FIXED_SIZE_BINARY:
+      return do_copy_chunked_array<arrow::FixedSizeBinaryType>(indices, source_column,
+                                                               copied_array, memory_pool);
+    default: {
+      // other types (ie. lists) are copied from the concatenated chunks
+      const auto &res = arrow::Concatenate(source_column->chunks(), memory_pool);
+      RETURN_ARROW_STATUS_IF_FAILED(res.status());
+      return copy_array_by_indices(indices, res.ValueOrDie(), copied_array, memory_pool);
+    }
+  }
+}
+
 }  // namespace util
 }  // namespace cylon
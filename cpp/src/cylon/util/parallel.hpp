@@ -0,0 +1,173 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_UTIL_PARALLEL_HPP_
+#define CYLON_CPP_SRC_CYLON_UTIL_PARALLEL_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cylon/status.hpp>
+#include <cylon/util/macros.hpp>
+
+namespace cylon {
+namespace util {
+
+/**
+ * Resolves a requested thread count. Values <= 0 mean "use all hardware threads".
+ * @param num_threads
+ * @return
+ */
+inline int GetNumThreads(int num_threads) {
+  if (num_threads > 0) {
+    return num_threads;
+  }
+  const auto hw = static_cast<int>(std::thread::hardware_concurrency());
+  return hw > 0 ? hw : 1;
+}
+
+/**
+ * Runs fn(task_id) for every task_id in [0, num_tasks) using num_threads threads (calling thread
+ * included). Tasks are handed out dynamically, so uneven tasks get balanced across threads.
+ * fn should return a cylon::Status. Once a task fails, no new tasks are started and the first
+ * failed status is returned.
+ * @param num_threads
+ * @param num_tasks
+ * @param fn
+ * @return
+ */
+template<typename TaskFn>
+Status ParallelFor(int num_threads, int64_t num_tasks, TaskFn &&fn) {
+  num_threads = (int) std::min<int64_t>(GetNumThreads(num_threads), num_tasks);
+  if (num_threads <= 1) {
+    for (int64_t t = 0; t < num_tasks; t++) {
+      RETURN_CYLON_STATUS_IF_FAILED(fn(t));
+    }
+    return Status::OK();
+  }
+
+  std::atomic<int64_t> next_task{0};
+  std::atomic<bool> failed{false};
+  std::mutex status_mutex;
+  Status status = Status::OK();
+
+  const auto &worker = [&]() {
+    int64_t t;
+    while (!failed.load(std::memory_order_relaxed)
+        && (t = next_task.fetch_add(1, std::memory_order_relaxed)) < num_tasks) {
+      const auto &st = fn(t);
+      if (!st.is_ok()) {
+        std::lock_guard<std::mutex> lock(status_mutex);
+        if (!failed.exchange(true)) {
+          status = st;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int i = 0; i < num_threads - 1; i++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread: threads) {
+    thread.join();
+  }
+  return status;
+}
+
+/**
+ * Number of elements that the first d elements of the stable merge of a and b take from a
+ */
+template<typename T, typename Less>
+int64_t MergeCoRank(int64_t d, const T *a, int64_t na, const T *b, int64_t nb, Less &&less) {
+  int64_t lo = std::max<int64_t>(0, d - nb), hi = std::min(d, na);
+  while (lo < hi) {
+    const int64_t i = lo + (hi - lo) / 2, j = d - i;
+    if (j > 0 && !less(b[j - 1], a[i])) {
+      // a[i] precedes b[j - 1]
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Stable sort of [data, data + n) using num_threads threads. Contiguous runs are sorted in parallel
+ * and merged pairwise, and each merge is split among the threads at the co-ranks of its output. The
+ * result is the same as std::stable_sort, for any number of threads.
+ * @param num_threads
+ * @param data
+ * @param n
+ * @param less
+ * @return
+ */
+template<typename T, typename Less>
+Status ParallelStableSort(int num_threads, T *data, int64_t n, Less &&less) {
+  // runs smaller than this are not worth a thread
+  constexpr int64_t kMinRunLength = 1 << 14;
+  num_threads = GetNumThreads(num_threads);
+  const int64_t num_runs = std::min<int64_t>(num_threads, n / kMinRunLength);
+  if (num_runs <= 1) {
+    std::stable_sort(data, data + n, less);
+    return Status::OK();
+  }
+
+  std::vector<int64_t> bounds(num_runs + 1);
+  for (int64_t r = 0; r <= num_runs; r++) {
+    bounds[r] = n * r / num_runs;
+  }
+  RETURN_CYLON_STATUS_IF_FAILED(ParallelFor(num_threads, num_runs, [&](int64_t r) {
+    std::stable_sort(data + bounds[r], data + bounds[r + 1], less);
+    return Status::OK();
+  }));
+
+  std::vector<T> buffer(n);
+  T *src = data, *dst = buffer.data();
+  for (int64_t width = 1; width < num_runs; width *= 2) {
+    const int64_t num_merges = (num_runs + 2 * width - 1) / (2 * width);
+    const int64_t parts = (num_threads + num_merges - 1) / num_merges;
+    RETURN_CYLON_STATUS_IF_FAILED(ParallelFor(num_threads, num_merges * parts, [&](int64_t t) {
+      const int64_t m = t / parts, p = t % parts;
+      const int64_t lo = bounds[2 * m * width];
+      const int64_t mid = bounds[std::min(2 * m * width + width, num_runs)];
+      const int64_t hi = bounds[std::min(2 * m * width + 2 * width, num_runs)];
+      const T *a = src + lo, *b = src + mid;
+      const int64_t na = mid - lo, nb = hi - mid;
+
+      // merge the output range [d0, d1) of this part
+      const int64_t d0 = (na + nb) * p / parts, d1 = (na + nb) * (p + 1) / parts;
+      const int64_t i0 = MergeCoRank(d0, a, na, b, nb, less);
+      const int64_t i1 = MergeCoRank(d1, a, na, b, nb, less);
+      std::merge(a + i0, a + i1, b + (d0 - i0), b + (d1 - i1), dst + lo + d0, less);
+      return Status::OK();
+    }));
+    std::swap(src, dst);
+  }
+  if (src != data) {
+    std::copy(src, src + n, data);
+  }
+  return Status::OK();
+}
+
+}  // namespace util
+}  // namespace cylon
+
+#endif //CYLON_CPP_SRC_CYLON_UTIL_PARALLEL_HPP_
@@ -0,0 +1,245 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include <arrow/api.h>
+
+#include "cylon/util/trace.hpp"
+#include "cylon/ctx/cylon_context.hpp"
+#include "cylon/ctx/arrow_memory_pool_utils.hpp"
+#include "cylon/table.hpp"
+#include "cylon/util/macros.hpp"
+
+namespace cylon {
+namespace trace {
+
+namespace {
+std::atomic<bool> tracing_enabled{false};
+std::atomic<int32_t> next_thread{0};
+std::mutex spans_mutex;
+std::vector<SpanRecord> spans;
+
+inline int64_t NowMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+inline int32_t ThreadId() {
+  static thread_local int32_t id = next_thread.fetch_add(1);
+  return id;
+}
+
+const std::shared_ptr<arrow::Schema> &SpansSchema() {
+  static const auto schema = arrow::schema({arrow::field("rank", arrow::int32()),
+                                            arrow::field("name", arrow::utf8()),
+                                            arrow::field("thread", arrow::int32()),
+                                            arrow::field("start_us", arrow::int64()),
+                                            arrow::field("duration_us", arrow::int64()),
+                                            arrow::field("bytes", arrow::int64())});
+  return schema;
+}
+
+struct SpanColumns {
+  std::shared_ptr<arrow::Int32Array> rank;
+  std::shared_ptr<arrow::StringArray> name;
+  std::shared_ptr<arrow::Int32Array> thread;
+  std::shared_ptr<arrow::Int64Array> start_us;
+  std::shared_ptr<arrow::Int64Array> duration_us;
+  std::shared_ptr<arrow::Int64Array> bytes;
+};
+
+Status GetSpanColumns(const std::shared_ptr<Table> &spans_table, SpanColumns *columns) {
+  const auto &table = spans_table->get_table();
+  if (!table->schema()->Equals(*SpansSchema(), false)) {
+    return {Code::Invalid, "not a table of spans: " + table->schema()->ToString()};
+  }
+  CYLON_ASSIGN_OR_RAISE(auto combined,
+                        table->CombineChunks(ToArrowPool(spans_table->GetContext())))
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  for (const auto &col: combined->columns()) {
+    if (col->num_chunks() == 0) {
+      CYLON_ASSIGN_OR_RAISE(auto empty, arrow::MakeArrayOfNull(col->type(), 0))
+      arrays.push_back(std::move(empty));
+    } else {
+      arrays.push_back(col->chunk(0));
+    }
+  }
+  columns->rank = std::static_pointer_cast<arrow::Int32Array>(arrays[0]);
+  columns->name = std::static_pointer_cast<arrow::StringArray>(arrays[1]);
+  columns->thread = std::static_pointer_cast<arrow::Int32Array>(arrays[2]);
+  columns->start_us = std::static_pointer_cast<arrow::Int64Array>(arrays[3]);
+  columns->duration_us = std::static_pointer_cast<arrow::Int64Array>(arrays[4]);
+  columns->bytes = std::static_pointer_cast<arrow::Int64Array>(arrays[5]);
+  return Status::OK();
+}
+
+void WriteJsonString(std::ostream &out, const std::string &str) {
+  out << '"';
+  for (char c: str) {
+    if (c == '"' || c == '\\') {
+      out << '\\';
+    }
+    out << c;
+  }
+  out << '"';
+}
+}  // namespace
+
+void SetEnabled(bool enabled) {
+  tracing_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsEnabled() {
+  return tracing_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<SpanRecord> GetSpans() {
+  std::lock_guard<std::mutex> lock(spans_mutex);
+  return spans;
+}
+
+void Clear() {
+  std::lock_guard<std::mutex> lock(spans_mutex);
+  spans.clear();
+}
+
+Span::Span(const char *name) : name_(name), start_us_(IsEnabled() ? NowMicros() : -1) {}
+
+Span::~Span() {
+  if (start_us_ < 0) {
+    return;
+  }
+  SpanRecord record{name_, start_us_, NowMicros() - start_us_, bytes_, ThreadId()};
+  std::lock_guard<std::mutex> lock(spans_mutex);
+  spans.push_back(record);
+}
+
+Status ToTable(const std::shared_ptr<CylonContext> &ctx, std::shared_ptr<Table> *out) {
+  auto *pool = ToArrowPool(ctx);
+  arrow::Int32Builder rank(pool), thread(pool);
+  arrow::StringBuilder name(pool);
+  arrow::Int64Builder start_us(pool), duration_us(pool), bytes(pool);
+
+  const auto &records = GetSpans();
+  const auto num_spans = static_cast<int64_t>(records.size());
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(rank.Reserve(num_spans));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(thread.Reserve(num_spans));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(name.Reserve(num_spans));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(start_us.Reserve(num_spans));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(duration_us.Reserve(num_spans));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(bytes.Reserve(num_spans));
+  for (const auto &record: records) {
+    rank.UnsafeAppend(ctx->GetRank());
+    RETURN_CYLON_STATUS_IF_ARROW_FAILED(name.Append(record.name));
+    thread.UnsafeAppend(record.thread);
+    start_us.UnsafeAppend(record.start_us);
+    duration_us.UnsafeAppend(record.duration_us);
+    bytes.UnsafeAppend(record.bytes);
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays(6);
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(rank.Finish(&arrays[0]));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(name.Finish(&arrays[1]));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(thread.Finish(&arrays[2]));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(start_us.Finish(&arrays[3]));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(duration_us.Finish(&arrays[4]));
+  RETURN_CYLON_STATUS_IF_ARROW_FAILED(bytes.Finish(&arrays[5]));
+  return Table::FromArrowTable(ctx, arrow::Table::Make(SpansSchema(), arrays), *out);
+}
+
+Status Gather(const std::shared_ptr<CylonContext> &ctx, std::shared_ptr<Table> *out, int root) {
+  std::shared_ptr<Table> local;
+  RETURN_CYLON_STATUS_IF_FAILED(ToTable(ctx, &local));
+  if (ctx->GetWorldSize() == 1) {
+    *out = std::move(local);
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Table>> tables;
+  RETURN_CYLON_STATUS_IF_FAILED(ctx->GetCommunicator()->Gather(local, root, true, &tables));
+  if (ctx->GetRank() != root) {
+    *out = std::move(local);
+    return Status::OK();
+  }
+  return Merge(tables, *out);
+}
+
+Status WriteChromeTrace(const std::shared_ptr<Table> &spans_table, const std::string &path) {
+  SpanColumns columns;
+  RETURN_CYLON_STATUS_IF_FAILED(GetSpanColumns(spans_table, &columns));
+
+  std::ofstream out(path);
+  if (!out) {
+    return {Code::IOError, "unable to open " + path};
+  }
+  out << "{\"traceEvents\":[";
+  for (int64_t i = 0; i < columns.rank->length(); i++) {
+    out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    WriteJsonString(out, columns.name->GetString(i));
+    out << ",\"ph\":\"X\",\"ts\":" << columns.start_us->Value(i)
+        << ",\"dur\":" << columns.duration_us->Value(i)
+        << ",\"pid\":" << columns.rank->Value(i)
+        << ",\"tid\":" << columns.thread->Value(i)
+        << ",\"args\":{\"bytes\":" << columns.bytes->Value(i) << "}}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  out.close();
+  if (!out) {
+    return {Code::IOError, "unable to write " + path};
+  }
+  return Status::OK();
+}
+
+Status WriteSummary(const std::shared_ptr<Table> &spans_table, const std::string &path) {
+  SpanColumns columns;
+  RETURN_CYLON_STATUS_IF_FAILED(GetSpanColumns(spans_table, &columns));
+
+  struct Summary {
+    int64_t count = 0;
+    int64_t total_us = 0;
+    int64_t max_us = 0;
+    int64_t bytes = 0;
+  };
+  std::map<std::pair<std::string, int32_t>, Summary> summaries;
+  for (int64_t i = 0; i < columns.rank->length(); i++) {
+    auto &summary = summaries[{columns.name->GetString(i), columns.rank->Value(i)}];
+    summary.count++;
+    summary.total_us += columns.duration_us->Value(i);
+    summary.max_us = std::max(summary.max_us, columns.duration_us->Value(i));
+    summary.bytes += columns.bytes->Value(i);
+  }
+
+  std::ofstream out(path);
+  if (!out) {
+    return {Code::IOError, "unable to open " + path};
+  }
+  out << "name,rank,count,total_us,max_us,bytes\n";
+  for (const auto &s: summaries) {
+    out << s.first.first << "," << s.first.second << "," << s.second.count << ","
+        << s.second.total_us << "," << s.second.max_us << "," << s.second.bytes << "\n";
+  }
+  out.close();
+  if (!out) {
+    return {Code::IOError, "unable to write " + path};
+  }
+  return Status::OK();
+}
+
+}  // namespace trace
+}  // namespace cylon
@@ -0,0 +1,119 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CYLON_CPP_SRC_CYLON_UTIL_TRACE_HPP_
+#define CYLON_CPP_SRC_CYLON_UTIL_TRACE_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cylon/status.hpp>
+
+namespace cylon {
+
+class CylonContext;
+class Table;
+
+/**
+ * Tracing of the phases of the operators (partition, serialize, all-to-all, local kernels etc).
+ *
+ * A Span times a phase while it is in scope, and records it when tracing is enabled. Spans are
+ * collected per process (ie. per rank), from all threads. When tracing is disabled, a span only
+ * checks a flag. The spans of all ranks can be gathered to a table, and written as a Chrome trace
+ * (chrome://tracing, Perfetto) or as a CSV summary per phase and rank.
+ */
+namespace trace {
+
+struct SpanRecord {
+  // a string literal
+  const char *name;
+  // microseconds since the epoch
+  int64_t start_us;
+  int64_t duration_us;
+  int64_t bytes;
+  int32_t thread;
+};
+
+void SetEnabled(bool enabled);
+
+bool IsEnabled();
+
+/**
+ * Spans recorded by this process since the last Clear
+ */
+std::vector<SpanRecord> GetSpans();
+
+void Clear();
+
+class Span {
+ public:
+  /**
+   * @param name a string literal, ex: "shuffle.all_to_all"
+   */
+  explicit Span(const char *name);
+
+  ~Span();
+
+  /**
+   * Adds to the bytes processed in the span
+   */
+  void AddBytes(int64_t bytes) { bytes_ += bytes; }
+
+ private:
+  const char *name_;
+  int64_t start_us_;
+  int64_t bytes_ = 0;
+};
+
+/**
+ * Spans of this rank as a table of (rank, name, thread, start_us, duration_us, bytes)
+ * @param ctx
+ * @param out
+ * @return
+ */
+Status ToTable(const std::shared_ptr<CylonContext> &ctx, std::shared_ptr<Table> *out);
+
+/**
+ * Gathers the spans of all ranks to the root, as a table like ToTable. Ranks other than the root
+ * get their own spans.
+ * @param ctx
+ * @param out
+ * @param root
+ * @return
+ */
+Status Gather(const std::shared_ptr<CylonContext> &ctx, std::shared_ptr<Table> *out, int root = 0);
+
+/**
+ * Writes spans (a table from ToTable/ Gather) in the Chrome trace event format. Each rank is a
+ * process and each thread a track.
+ * @param spans
+ * @param path
+ * @return
+ */
+Status WriteChromeTrace(const std::shared_ptr<Table> &spans, const std::string &path);
+
+/**
+ * Writes a CSV of (name, rank, count, total_us, max_us, bytes) for each span name and rank, so that
+ * the time of a phase can be compared across ranks.
+ * @param spans
+ * @param path
+ * @return
+ */
+Status WriteSummary(const std::shared_ptr<Table> &spans, const std::string &path);
+
+}  // namespace trace
+}  // namespace cylon
+
+#endif //CYLON_CPP_SRC_CYLON_UTIL_TRACE_HPP_
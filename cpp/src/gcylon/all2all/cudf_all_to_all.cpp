@@ -601,7 +601,7 @@ std::unique_ptr<cudf::table> CudfAllToAll::constructTable(std::shared_ptr<Pendin
 /**
 * This function is called when a data is received
 */
-bool CudfAllToAll::onReceive(int source, std::shared_ptr<cylon::Buffer> buffer, int length) {
+bool CudfAllToAll::onReceive(int source, std::shared_ptr<cylon::Buffer> buffer, int64_t length) {
 
   if (length == 0) {
     return true;
@@ -682,7 +682,7 @@ bool CudfAllToAll::onReceiveHeader(int source, int finished, int *buffer, int le
 * This method is called after we successfully send a buffer
 * @return
 */
-bool CudfAllToAll::onSendComplete(int target, const void *buffer, int length) {
+bool CudfAllToAll::onSendComplete(int target, const void *buffer, int64_t length) {
   return true;
 }
 
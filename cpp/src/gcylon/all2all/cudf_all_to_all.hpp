@@ -234,7 +234,7 @@ public:
   /**
    * This function is called when a data is received
    */
-  bool onReceive(int source, std::shared_ptr<cylon::Buffer> buffer, int length) override;
+  bool onReceive(int source, std::shared_ptr<cylon::Buffer> buffer, int64_t length) override;
 
   /**
    * Receive the header, this happens before we receive the actual data
@@ -245,7 +245,7 @@ public:
    * This method is called after we successfully send a buffer
    * @return
    */
-  bool onSendComplete(int target, const void *buffer, int length) override;
+  bool onSendComplete(int target, const void *buffer, int64_t length) override;
 
 private:
   std::unique_ptr<int []> makeTableHeader(int headers_length, int ref, int number_of_columns, int number_of_rows);
@@ -23,12 +23,12 @@
 #include <cudf/table/table.hpp>
 
 
-std::vector<std::vector<int32_t>> bufferSizesPerTable(const std::vector<int32_t> &all_buffer_sizes,
+std::vector<std::vector<int64_t>> bufferSizesPerTable(const std::vector<int64_t> &all_buffer_sizes,
                                                       int number_of_buffers,
                                                       int numb_workers) {
-  std::vector<std::vector<int32_t>> buffer_sizes_all_tables;
+  std::vector<std::vector<int64_t>> buffer_sizes_all_tables;
   for (int i = 0, k = 0; i < numb_workers; ++i) {
-    std::vector<int32_t> single_table_buffer_sizes;
+    std::vector<int64_t> single_table_buffer_sizes;
     for (int j = 0; j < number_of_buffers; ++j) {
       single_table_buffer_sizes.push_back(all_buffer_sizes[k++]);
     }
@@ -46,9 +46,9 @@ cylon::Status gcylon::net::Gather(const cudf::table_view &tv,
 
   auto serializer = std::make_shared<CudfTableSerializer>(tv);
   auto allocator = std::make_shared<CudfAllocator>();
-  std::vector<int32_t> all_buffer_sizes;
+  std::vector<int64_t> all_buffer_sizes;
   std::vector<std::shared_ptr<cylon::Buffer>> receive_buffers;
-  std::vector<std::vector<int32_t>> all_disps;
+  std::vector<std::vector<int64_t>> all_disps;
 
   RETURN_CYLON_STATUS_IF_FAILED(cylon::mpi::Gather(serializer,
                                                    gather_root,
@@ -60,7 +60,7 @@ cylon::Status gcylon::net::Gather(const cudf::table_view &tv,
                                                    ctx));
 
   if (cylon::mpi::AmIRoot(gather_root, ctx)) {
-    std::vector<std::vector<int32_t>> buffer_sizes_per_table =
+    std::vector<std::vector<int64_t>> buffer_sizes_per_table =
         bufferSizesPerTable(all_buffer_sizes, receive_buffers.size(), ctx->GetWorldSize());
 
     TableDeserializer deserializer(tv);
@@ -76,9 +76,9 @@ cylon::Status gcylon::net::AllGather(const cudf::table_view &tv,
 
   auto serializer = std::make_shared<CudfTableSerializer>(tv);
   auto allocator = std::make_shared<CudfAllocator>();
-  std::vector<int32_t> all_buffer_sizes;
+  std::vector<int64_t> all_buffer_sizes;
   std::vector<std::shared_ptr<cylon::Buffer>> receive_buffers;
-  std::vector<std::vector<int32_t>> all_disps;
+  std::vector<std::vector<int64_t>> all_disps;
 
   RETURN_CYLON_STATUS_IF_FAILED(cylon::mpi::AllGather(serializer,
                                                       allocator,
@@ -87,7 +87,7 @@ cylon::Status gcylon::net::AllGather(const cudf::table_view &tv,
                                                       all_disps,
                                                       ctx));
 
-  std::vector<std::vector<int32_t>> buffer_sizes_per_table =
+  std::vector<std::vector<int64_t>> buffer_sizes_per_table =
     bufferSizesPerTable(all_buffer_sizes, receive_buffers.size(), ctx->GetWorldSize());
 
   TableDeserializer deserializer(tv);
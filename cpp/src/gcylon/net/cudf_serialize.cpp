@@ -50,7 +50,7 @@ void CudfTableSerializer::initTableBuffers() {
   table_buffers_initialized = true;
 }
 
-const std::vector<int32_t> &CudfTableSerializer::getBufferSizes() {
+const std::vector<int64_t> &CudfTableSerializer::getBufferSizes() {
   if (!table_buffers_initialized) {
     initTableBuffers();
   }
@@ -69,8 +69,8 @@ int CudfTableSerializer::getNumberOfBuffers() {
   return tv_.num_columns() * 3;
 }
 
-std::vector<int32_t> CudfTableSerializer::getEmptyTableBufferSizes() {
-  return std::vector<int32_t>(getNumberOfBuffers(), 0);
+std::vector<int64_t> CudfTableSerializer::getEmptyTableBufferSizes() {
+  return std::vector<int64_t>(getNumberOfBuffers(), 0);
 }
 
 std::pair<int32_t, const uint8_t *> CudfTableSerializer::getColumnData(const cudf::column_view &cv) {
@@ -52,7 +52,7 @@ public:
    * This method is symmetrical to getDataBuffers()
    * @return
    */
-  const std::vector<int32_t>& getBufferSizes();
+  const std::vector<int64_t>& getBufferSizes();
 
   /**
    * number of buffers
@@ -65,7 +65,7 @@ public:
    * This is used by the MPI gather root
    * @return
    */
-  std::vector<int32_t> getEmptyTableBufferSizes();
+  std::vector<int64_t> getEmptyTableBufferSizes();
 
   /**
    * Get data buffers starting from column 0 to the last column
@@ -118,7 +118,7 @@ public:
 
 private:
   const cudf::table_view tv_;
-  std::vector<int32_t> buffer_sizes_{};
+  std::vector<int64_t> buffer_sizes_{};
   std::vector<const uint8_t *> table_buffers_{};
   bool table_buffers_initialized = false;
 
@@ -32,8 +32,8 @@ TableDeserializer::TableDeserializer(const cudf::table_view &tv) : tv_(tv) {
 
 std::unique_ptr<cudf::table>
 TableDeserializer::deserializeTable(std::vector<std::shared_ptr<cylon::Buffer>> &received_buffers,
-                                    std::vector<int32_t> &disp_per_buffer,
-                                    std::vector<int32_t> &buffer_sizes) {
+                                    std::vector<int64_t> &disp_per_buffer,
+                                    std::vector<int64_t> &buffer_sizes) {
 
   std::vector<std::unique_ptr<cudf::column>> columns{};
   int32_t num_rows = gcylon::net::numOfRows(tv_.column(0).type(),
@@ -67,22 +67,22 @@ TableDeserializer::deserializeTable(std::vector<std::shared_ptr<cylon::Buffer>>
   return std::make_unique<cudf::table>(std::move(columns));
 }
 
-std::vector<int32_t> displacementsPerTable(std::vector<std::vector<int32_t>> &displacements_per_buffer,
+std::vector<int64_t> displacementsPerTable(std::vector<std::vector<int64_t>> &displacements_per_buffer,
                                            int tableNo) {
-  std::vector<int32_t> disp;
+  std::vector<int64_t> disp;
   for (long unsigned int i = 0; i < displacements_per_buffer.size(); ++i) {
     disp.push_back(displacements_per_buffer.at(i).at(tableNo));
   }
   return disp;
 }
 
-bool allZero(std::vector<int32_t> &buffer_sizes) {
-  return std::all_of(buffer_sizes.begin(), buffer_sizes.end(), [](int32_t i) { return i == 0; });
+bool allZero(std::vector<int64_t> &buffer_sizes) {
+  return std::all_of(buffer_sizes.begin(), buffer_sizes.end(), [](int64_t i) { return i == 0; });
 }
 
 cylon::Status TableDeserializer::deserialize(std::vector<std::shared_ptr<cylon::Buffer>> &received_buffers,
-                                             std::vector<std::vector<int32_t>> &displacements_per_buffer,
-                                             std::vector<std::vector<int32_t>> &buffer_sizes_per_table,
+                                             std::vector<std::vector<int64_t>> &displacements_per_buffer,
+                                             std::vector<std::vector<int64_t>> &buffer_sizes_per_table,
                                              std::vector<std::unique_ptr<cudf::table>> &received_tables) {
 
   int number_of_tables = buffer_sizes_per_table.size();
@@ -93,7 +93,7 @@ cylon::Status TableDeserializer::deserialize(std::vector<std::shared_ptr<cylon::
       received_tables.push_back(cudf::empty_like(tv_));
       continue;
     }
-    std::vector<int32_t> disp = displacementsPerTable(displacements_per_buffer, i);
+    std::vector<int64_t> disp = displacementsPerTable(displacements_per_buffer, i);
     std::unique_ptr<cudf::table> outTable = deserializeTable(received_buffers,
                                                              disp,
                                                              buffer_sizes_per_table.at(i));
@@ -40,8 +40,8 @@ public:
    * @return
    */
   std::unique_ptr<cudf::table> deserializeTable(std::vector<std::shared_ptr<cylon::Buffer>> &received_buffers,
-                                                std::vector<int32_t> &disp_per_buffer,
-                                                std::vector<int32_t> &buffer_sizes);
+                                                std::vector<int64_t> &disp_per_buffer,
+                                                std::vector<int64_t> &buffer_sizes);
 
    /**
     * deserialize all tables received by gather operation
@@ -53,8 +53,8 @@ public:
     * @return
     */
   cylon::Status deserialize(std::vector<std::shared_ptr<cylon::Buffer>> &received_buffers,
-                            std::vector<std::vector<int32_t>> &displacements_per_buffer,
-                            std::vector<std::vector<int32_t>> &buffer_sizes_per_table,
+                            std::vector<std::vector<int64_t>> &displacements_per_buffer,
+                            std::vector<std::vector<int64_t>> &buffer_sizes_per_table,
                             std::vector<std::unique_ptr<cudf::table>> &received_tables);
 
 private:
@@ -0,0 +1,93 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "common/test_header.hpp"
+#include "cylon/ctx/arena_memory_pool.hpp"
+#include "test_arrow_utils.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+TEST_CASE("Test arena memory pool") {
+  SECTION("bump allocations") {
+    ArenaMemoryPool arena(1024);
+    uint8_t *p1, *p2, *p3;
+    CHECK_CYLON_STATUS(arena.Allocate(100, &p1));
+    REQUIRE(reinterpret_cast<uintptr_t>(p1) % 64 == 0);
+    std::memset(p1, 1, 100);
+
+    // the last allocation grows in place
+    CHECK_CYLON_STATUS(arena.Reallocate(100, 500, &p1));
+    REQUIRE(p1[99] == 1);
+    CHECK_CYLON_STATUS(arena.Allocate(10, &p2));
+    REQUIRE(p2 == p1 + 512);
+
+    // otherwise it moves
+    CHECK_CYLON_STATUS(arena.Reallocate(500, 900, &p1));
+    REQUIRE(p1[0] == 1);
+    REQUIRE(arena.bytes_allocated() == 910);
+    REQUIRE(arena.bytes_reserved() == 2048);
+
+    // a block of its own
+    CHECK_CYLON_STATUS(arena.Allocate(5000, &p3));
+    REQUIRE(arena.bytes_reserved() == 2048 + 5056);
+
+    arena.Free(p3, 5000);
+    arena.Free(p2, 10);
+    arena.Free(p1, 900);
+    REQUIRE(arena.bytes_allocated() == 0);
+    REQUIRE(arena.max_memory() == 5910);
+
+    arena.Reset();
+    REQUIRE(arena.bytes_reserved() == 0);
+    REQUIRE(arena.max_memory() == 5910);
+  }
+
+  SECTION("free gives back the last allocation") {
+    ArenaMemoryPool arena(1024);
+    uint8_t *p1, *p2;
+    CHECK_CYLON_STATUS(arena.Allocate(64, &p1));
+    arena.Free(p1, 64);
+    CHECK_CYLON_STATUS(arena.Allocate(64, &p2));
+    REQUIRE(p1 == p2);
+    arena.Free(p2, 64);
+  }
+
+  SECTION("operator arena") {
+    auto schema = arrow::schema({arrow::field("a", arrow::int64()),
+                                 arrow::field("b", arrow::int64())});
+    auto atable = TableFromJSON(schema, {R"([[3, 1], [1, 2], [2, 3], [1, 4], [3, 5]])"});
+    std::shared_ptr<Table> table, expected, out;
+    CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+    CHECK_CYLON_STATUS(Sort(table, 0, expected));
+
+    ctx->AddConfig(kOperatorArenaConfig, "true");
+    {
+      OperatorArena arena(ctx);
+      std::shared_ptr<arrow::Array> scratch;
+      CHECK_ARROW_STATUS(arrow::MakeArrayOfNull(arrow::int64(), 100, arena.pool()).Value(&scratch));
+      REQUIRE(arena.max_memory() > 0);
+    }
+    // outputs of the operators do not live in the arenas
+    CHECK_CYLON_STATUS(Sort(table, 0, out));
+    ctx->AddConfig(kOperatorArenaConfig, "");
+    CHECK_ARROW_EQUAL(expected->get_table(), out->get_table());
+  }
+}
+
+} // namespace test
+} // namespace cylon
@@ -0,0 +1,131 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include "common/test_header.hpp"
+#include "cylon/arrow/arrow_buffer.hpp"
+#include "cylon/util/macros.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+class CountingRegistrar : public MemoryRegistrar {
+ public:
+  Status Register(uint8_t *address, int64_t length, void **handle) override {
+    CYLON_UNUSED(length);
+    *handle = address;
+    registered++;
+    return Status::OK();
+  }
+
+  void Deregister(void *handle) override {
+    CYLON_UNUSED(handle);
+    registered--;
+  }
+
+  int64_t registered = 0;
+};
+
+TEST_CASE("Test buffer pool") {
+  SECTION("size classes") {
+    REQUIRE(BufferPool::BlockSize(0) == 64);
+    REQUIRE(BufferPool::BlockSize(64) == 64);
+    REQUIRE(BufferPool::BlockSize(65) == 80);
+    REQUIRE(BufferPool::BlockSize(1000) == 1024);
+    REQUIRE(BufferPool::BlockSize(1025) == 1280);
+    REQUIRE(BufferPool::BlockSize((1LL << 30) + 1) == (1LL << 30) + 1);
+  }
+
+  SECTION("reuse") {
+    auto pool = BufferPool::Make();
+    PooledArrowAllocator allocator(pool);
+
+    std::shared_ptr<Buffer> b1, b2;
+    CHECK_CYLON_STATUS(allocator.Allocate(1000, &b1));
+    REQUIRE(b1->GetLength() == 1000);
+    uint8_t *data = b1->GetByteBuffer();
+    b1.reset();
+
+    // same size class
+    CHECK_CYLON_STATUS(allocator.Allocate(900, &b2));
+    REQUIRE(b2->GetByteBuffer() == data);
+    // different size class
+    CHECK_CYLON_STATUS(allocator.Allocate(10000, &b1));
+
+    auto stats = pool->GetStats();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.bytes_in_use == 1024 + 10240);
+    REQUIRE(stats.bytes_cached == 0);
+
+    b1.reset();
+    b2.reset();
+    REQUIRE(pool->GetStats().bytes_cached == 1024 + 10240);
+    pool->Trim();
+    REQUIRE(pool->GetStats().bytes_cached == 0);
+  }
+
+  SECTION("buffers outlive the allocator") {
+    std::shared_ptr<arrow::Buffer> buf;
+    {
+      auto pool = BufferPool::Make();
+      CHECK_CYLON_STATUS(pool->Allocate(100, &buf));
+    }
+    std::memset(buf->mutable_data(), 0, buf->size());
+    buf.reset();
+  }
+
+  SECTION("cache limit") {
+    auto pool = BufferPool::Make(arrow::default_memory_pool(), 1024);
+    std::shared_ptr<arrow::Buffer> b1, b2;
+    CHECK_CYLON_STATUS(pool->Allocate(1024, &b1));
+    CHECK_CYLON_STATUS(pool->Allocate(1024, &b2));
+    b1.reset();
+    b2.reset();
+    REQUIRE(pool->GetStats().bytes_cached == 1024);
+  }
+
+  SECTION("registration") {
+    auto pool = BufferPool::Make();
+    std::shared_ptr<arrow::Buffer> b1, b2;
+    CHECK_CYLON_STATUS(pool->Allocate(100, &b1));
+    b1.reset();
+
+    auto registrar = std::make_shared<CountingRegistrar>();
+    pool->SetRegistrar(registrar);
+    // cached block is registered
+    REQUIRE(registrar->registered == 1);
+
+    CHECK_CYLON_STATUS(pool->Allocate(100, &b1));
+    CHECK_CYLON_STATUS(pool->Allocate(100, &b2));
+    REQUIRE(registrar->registered == 2);
+    REQUIRE(pool->GetStats().registered_blocks == 2);
+    // the channels look up the handles of the blocks they receive into
+    REQUIRE(pool->GetMemoryHandle(b1->data()) == b1->data());
+    REQUIRE(pool->GetMemoryHandle(b1->data() + 1) == nullptr);
+
+    b1.reset();
+    b2.reset();
+    // cached blocks stay registered
+    REQUIRE(registrar->registered == 2);
+
+    pool->Trim();
+    REQUIRE(registrar->registered == 0);
+  }
+}
+
+} // namespace test
+} // namespace cylon
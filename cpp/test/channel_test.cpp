@@ -0,0 +1,32 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/test_header.hpp"
+#include "cylon/net/channel.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+TEST_CASE("Test channel header length") {
+  int header[CYLON_CHANNEL_HEADER_SIZE]{};
+  for (int64_t length: {int64_t(0), int64_t(1), int64_t(INT32_MAX), int64_t(INT32_MAX) + 1,
+                        int64_t(UINT32_MAX), int64_t(5) << 32, (int64_t(1) << 40) + 12345}) {
+    SetHeaderLength(header, length);
+    REQUIRE(GetHeaderLength(header) == length);
+  }
+}
+
+} // namespace test
+} // namespace cylon
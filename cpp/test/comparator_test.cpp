@@ -340,5 +340,65 @@ TEST_CASE("test dual table", "[comp]") {
   }
 }
 
+TEST_CASE("test chunked table", "[comp]") {
+  auto schema = arrow::schema({{field("a", arrow::int32())},
+                               {field("b", arrow::float32())},
+                               {field("c", arrow::utf8())}});
+  auto table = TableFromJSON(schema, {
+      R"([{"a":	10	, "b":	10	, "c":	""	},
+          {"a":	10	, "b":	10	, "c":	"a"	},
+          {"a":	10	, "b":	null	, "c":	"b"	},
+          {"a":	null	, "b":	10	, "c":	"c"	},
+          {"a":	null	, "b":	null	, "c":	null	},
+          {"a":	10	, "b":	10	, "c":	null	},
+          {"a":	10	, "b":	10	, "c":	""	},
+          {"a":	10	, "b":	10	, "c":	"a"	},
+          {"a":	10	, "b":	null	, "c":	"d"	},
+          {"a":	null	, "b":	10	, "c":	"e"	},
+          {"a":	null	, "b":	null	, "c":	null	},
+          {"a":	10	, "b":	10	, "c":	null	}])"});
+  auto chunked = *arrow::ConcatenateTables({table->Slice(0, 5), table->Slice(5, 0),
+                                            table->Slice(5, 2), table->Slice(7)});
+
+  std::unique_ptr<TableRowIndexEqualTo> exp_comp;
+  CHECK_CYLON_STATUS(TableRowIndexEqualTo::Make(table, {0, 1, 2}, &exp_comp));
+  std::unique_ptr<TableRowIndexHash> exp_hash;
+  CHECK_CYLON_STATUS(TableRowIndexHash::Make(table, {0, 1, 2}, &exp_hash));
+
+  SECTION("single table") {
+    std::unique_ptr<TableRowIndexEqualTo> comp;
+    CHECK_CYLON_STATUS(TableRowIndexEqualTo::Make(chunked, {0, 1, 2}, &comp));
+    std::unique_ptr<TableRowIndexHash> hash;
+    CHECK_CYLON_STATUS(TableRowIndexHash::Make(chunked, {0, 1, 2}, &hash));
+
+    for (int64_t i = 0; i < table->num_rows(); i++) {
+      REQUIRE((*exp_hash)(i) == (*hash)(i));
+      for (int64_t j = 0; j < table->num_rows(); j++) {
+        INFO("" << i << " " << j);
+        REQUIRE((*exp_comp)(i, j) == (*comp)(i, j));
+        REQUIRE(check_comp_values(exp_comp->compare(i, j), comp->compare(i, j)));
+      }
+    }
+  }
+
+  SECTION("dual table") {
+    auto table1 = chunked->Slice(0, 6);
+    auto table2 = chunked->Slice(6);
+    REQUIRE(table2->column(0)->num_chunks() > 1);
+
+    std::unique_ptr<DualTableRowIndexEqualTo> comp;
+    CHECK_CYLON_STATUS(DualTableRowIndexEqualTo::Make(table1, table2, &comp));
+
+    for (int64_t i = 0; i < table1->num_rows(); i++) {
+      for (int64_t j = 0; j < table2->num_rows(); j++) {
+        INFO("" << i << " " << j);
+        REQUIRE((*exp_comp)(i, 6 + j) == (*comp)(i, util::SetBit(j)));
+        REQUIRE((*exp_comp)(6 + j, i) == (*comp)(util::SetBit(j), i));
+        REQUIRE(check_comp_values(exp_comp->compare(i, 6 + j), comp->compare(i, util::SetBit(j))));
+      }
+    }
+  }
+}
+
 }
 }
\ No newline at end of file
@@ -21,13 +21,13 @@ namespace cylon {
 void testDistSort(const std::vector<int>& sort_cols,
                   const std::vector<bool>& sort_order,
                   std::shared_ptr<Table>& global_table,
-                  std::shared_ptr<Table>& table) {
+                  std::shared_ptr<Table>& table,
+                  const SortOptions& sort_options = {0, 0, SortOptions::INITIAL_SAMPLE, 0, {}}) {
   std::shared_ptr<Table> out;
   auto ctx = table->GetContext();
   std::shared_ptr<arrow::Table> arrow_output;
 
-  CHECK_CYLON_STATUS(DistributedSort(table, sort_cols, out, sort_order,
-                                     {0, 0, SortOptions::INITIAL_SAMPLE}));
+  CHECK_CYLON_STATUS(DistributedSort(table, sort_cols, out, sort_order, sort_options));
 
   std::vector<std::shared_ptr<Table>> gathered;
   CHECK_CYLON_STATUS(ctx->GetCommunicator()->Gather(out, /*root*/0, /*gather_from_root*/true,
@@ -113,6 +113,14 @@ TEMPLATE_LIST_TEST_CASE("Dist sort testing", "[dist sort]", ArrowNumericTypes) {
     testDistSort({1, 0}, {false, false}, global_table, table1);
   }
 
+  SECTION("dist_sort_test_5_spilling") {
+    // a few rows per run, so that every worker spills multiple runs
+    auto sort_options = SortOptions::Defaults();
+    sort_options.memory_limit = 64;
+    testDistSort({0, 1}, {true, false}, global_table, table1, sort_options);
+    testDistSort({1, 0}, {false, true}, global_table, table1, sort_options);
+  }
+
   SECTION("dist_sort_test_4_one_empty_table") {
     if (RANK == 0) {
       auto pool = cylon::ToArrowPool(ctx);
@@ -130,7 +138,7 @@ TEMPLATE_LIST_TEST_CASE("Dist sort testing", "[dist sort]", ArrowNumericTypes) {
     auto status = DistributedSort(table1, {1, 0}, out, {0, 0});
     REQUIRE(status.is_ok());
     status = DistributedSort(table1, {1, 0}, out2, {0, 0},
-                    {0, 0, SortOptions::INITIAL_SAMPLE});
+                    {0, 0, SortOptions::INITIAL_SAMPLE, 0, {}});
     REQUIRE(status.is_ok());
     bool eq;
     status = DistributedEquals(out, out2, eq);
@@ -18,12 +18,16 @@
 #include <cylon/table.hpp>
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/groupby/groupby.hpp>
+#include <cylon/groupby/hash_groupby.hpp>
+#include <cylon/groupby/partial_groupby.hpp>
 #include <cylon/compute/aggregates.hpp>
 
 #include "common/test_header.hpp"
 
 #include "cylon/mapreduce/mapreduce.hpp"
 
+#include <cylon/util/arrow_rand.hpp>
+
 namespace cylon {
 namespace test {
 
@@ -174,6 +178,71 @@ TEMPLATE_LIST_TEST_CASE("groupby testing", "[groupby]", ArrowNumericTypes) {
   }
 }
 
+TEST_CASE("two-phase groupby testing", "[groupby]") {
+  const int64_t rows = 10000;
+  const std::vector<compute::AggregationOpId> ops{compute::SUM, compute::COUNT, compute::MIN,
+                                                  compute::MAX, compute::MEAN, compute::VAR,
+                                                  compute::STDDEV, compute::NUNIQUE,
+                                                  compute::QUANTILE};
+  RandomArrayGenerator gen(RANK);
+  // few groups and heavily duplicated values, so that the partial states are small
+  auto schema = arrow::schema({arrow::field("k", arrow::int64()),
+                               arrow::field("v", arrow::int64())});
+  auto atable = arrow::Table::Make(schema, {gen.Numeric<arrow::Int64Type>(rows, 0, 50, 0),
+                                            gen.Numeric<arrow::Int64Type>(rows, 0, 10, 0.1)});
+  std::shared_ptr<Table> table;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+
+  SECTION("merged partial states match hash groupby") {
+    // a value column per aggregation
+    std::vector<std::shared_ptr<compute::AggregationOp>> aggregations;
+    std::vector<std::pair<int32_t, std::shared_ptr<compute::AggregationOp>>> agg_cols;
+    std::vector<int32_t> project_cols{0};
+    for (size_t i = 0; i < ops.size(); i++) {
+      aggregations.push_back(compute::MakeAggregationOpFromID(ops[i]));
+      agg_cols.emplace_back(1 + i, aggregations.back());
+      project_cols.push_back(1);
+    }
+    std::shared_ptr<Table> projected, expected;
+    CHECK_CYLON_STATUS(Project(table, project_cols, projected));
+    CHECK_CYLON_STATUS(HashGroupBy(projected, {0}, agg_cols, expected));
+
+    // partial states of the two halves of the table, merged
+    const auto &full = projected->get_table();
+    std::vector<std::shared_ptr<arrow::Table>> partials;
+    for (const auto &half: {full->Slice(0, rows / 2), full->Slice(rows / 2)}) {
+      std::shared_ptr<Table> input, partial;
+      CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, half, input));
+      CHECK_CYLON_STATUS(PartialHashGroupBy(input, 1, aggregations, partial));
+      REQUIRE(partial->Rows() < half->num_rows());
+      partials.push_back(partial->get_table());
+    }
+    auto concat = arrow::ConcatenateTables(partials);
+    REQUIRE(concat.ok());
+    std::shared_ptr<Table> partial, result;
+    CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, concat.ValueOrDie(), partial));
+    CHECK_CYLON_STATUS(MergePartialGroupBy(partial, full->schema(), 1, aggregations, result));
+
+    bool equal = false;
+    CHECK_CYLON_STATUS(Equals(expected, result, equal, /*ordered=*/false));
+    REQUIRE(equal);
+  }
+
+  SECTION("pre-aggregated groupby matches shuffled groupby") {
+    const std::vector<int32_t> agg_cols(ops.size(), 1);
+    std::shared_ptr<Table> expected, result;
+    ctx->AddConfig(kGroupByPreAggregationRatioConfig, "0");
+    CHECK_CYLON_STATUS(DistributedHashGroupBy(table, {0}, agg_cols, ops, expected));
+    ctx->AddConfig(kGroupByPreAggregationRatioConfig, "1");
+    CHECK_CYLON_STATUS(DistributedHashGroupBy(table, {0}, agg_cols, ops, result));
+    ctx->AddConfig(kGroupByPreAggregationRatioConfig, "");
+
+    bool equal = false;
+    CHECK_CYLON_STATUS(DistributedEquals(expected, result, equal, /*ordered=*/false));
+    REQUIRE(equal);
+  }
+}
+
 } // namespace test 
 } // namespace cylon
 
@@ -16,6 +16,11 @@
 #include "test_utils.hpp"
 #include "test_arrow_utils.hpp"
 
+#include <cylon/util/arrow_rand.hpp>
+#include <cylon/join/join_planner.hpp>
+#include <cylon/ops/kernels/join_kernel.hpp>
+#include <cylon/partition/heavy_hitters.hpp>
+
 namespace cylon {
 namespace test {
 
@@ -36,6 +41,12 @@ TEST_CASE("Join testing", "[join]") {
         join::config::JoinConfig::InnerJoin(0, 0, join::config::JoinAlgorithm::HASH);
     test::TestJoinOperation(join_config, ctx, path1, path2, out_path);
   }
+
+  SECTION("testing inner joins - auto") {
+    const auto &join_config =
+        join::config::JoinConfig::InnerJoin(0, 0, join::config::JoinAlgorithm::AUTO);
+    test::TestJoinOperation(join_config, ctx, path1, path2, out_path);
+  }
 }
 
 TEST_CASE("Join testing with null values in value columns", "[join]") {
@@ -121,5 +132,274 @@ TEST_CASE("Join testing chunks", "[join]") {
   }
 }
 
+TEST_CASE("Partitioned hash join testing", "[join]") {
+  std::string path1 = "../data/input/csv1_" + std::to_string(RANK) + ".csv";
+  std::string path2 = "../data/input/csv2_" + std::to_string(RANK) + ".csv";
+  std::shared_ptr<Table> table1, table2;
+
+  auto read_options = io::config::CSVReadOptions().UseThreads(false);
+  CHECK_CYLON_STATUS(FromCSV(ctx, std::vector<std::string>{path1, path2},
+                             std::vector<std::shared_ptr<Table> *>{&table1, &table2},
+                             read_options));
+
+  const auto join_types = {join::config::INNER, join::config::LEFT, join::config::RIGHT,
+                           join::config::FULL_OUTER};
+  const std::vector<std::vector<int>> key_columns = {{0}, {0, 1}};
+
+  for (const auto &type: join_types) {
+    for (const auto &keys: key_columns) {
+      SECTION("join type " + std::to_string(type) + " keys " + std::to_string(keys.size())) {
+        const join::config::JoinConfig serial_config(type, keys, keys, join::config::HASH, "l_", "r_");
+        auto parallel_config = serial_config;
+        parallel_config.SetNumThreads(4);
+
+        std::shared_ptr<Table> expected, result;
+        CHECK_CYLON_STATUS(Join(table1, table2, serial_config, expected));
+        CHECK_CYLON_STATUS(Join(table1, table2, parallel_config, result));
+
+        // partitioned join preserves the row order of the serial hash join
+        bool equal = false;
+        CHECK_CYLON_STATUS(Equals(expected, result, equal, /*ordered=*/true));
+        REQUIRE(equal);
+      }
+    }
+  }
+}
+
+TEST_CASE("Streaming join kernel testing", "[join]") {
+  std::string path1 = "../data/input/csv1_" + std::to_string(RANK) + ".csv";
+  std::string path2 = "../data/input/csv2_" + std::to_string(RANK) + ".csv";
+  std::shared_ptr<Table> table1, table2;
+
+  auto read_options = io::config::CSVReadOptions().UseThreads(false);
+  CHECK_CYLON_STATUS(FromCSV(ctx, std::vector<std::string>{path1, path2},
+                             std::vector<std::shared_ptr<Table> *>{&table1, &table2},
+                             read_options));
+
+  // slices of a table, as they would arrive from a shuffle
+  const int num_slices = 4;
+  auto slice = [&](const std::shared_ptr<Table> &table, int i) {
+    const int64_t len = (table->Rows() + num_slices - 1) / num_slices;
+    return std::make_shared<Table>(ctx, table->get_table()->Slice(i * len, len));
+  };
+
+  const auto join_types = {join::config::INNER, join::config::LEFT, join::config::RIGHT,
+                           join::config::FULL_OUTER};
+  for (const auto &type: join_types) {
+    SECTION("join type " + std::to_string(type)) {
+      const join::config::JoinConfig config(type, {0}, {0}, join::config::HASH, "l_", "r_");
+      kernel::JoinKernel kernel(ctx, table1->get_table()->schema(),
+                                table2->get_table()->schema(), &config);
+
+      // joined tables are returned while the relations arrive
+      std::vector<std::shared_ptr<Table>> joined;
+      for (int i = 0; i < num_slices; i++) {
+        for (const auto &input: {std::make_pair(100, table1), std::make_pair(200, table2)}) {
+          std::shared_ptr<Table> out;
+          CHECK_CYLON_STATUS(kernel.InsertTable(input.first, slice(input.second, i), &out));
+          if (out != nullptr) {
+            joined.push_back(out);
+          }
+        }
+      }
+      REQUIRE_FALSE(joined.empty());
+
+      std::shared_ptr<Table> unmatched, result, expected;
+      CHECK_CYLON_STATUS(kernel.Finalize(unmatched));
+      if (type == join::config::INNER) {
+        REQUIRE(unmatched->Rows() == 0);
+      }
+      joined.push_back(unmatched);
+      CHECK_CYLON_STATUS(Merge(joined, result));
+      CHECK_CYLON_STATUS(Join(table1, table2, config, expected));
+
+      bool equal = false;
+      CHECK_CYLON_STATUS(Equals(expected, result, equal, /*ordered=*/false));
+      REQUIRE(equal);
+    }
+  }
+}
+
+TEST_CASE("Join planner testing", "[join]") {
+  RandomArrayGenerator gen(RANK);
+  const int64_t rows = 10000;
+
+  SECTION("key stats") {
+    // 100 distinct keys, sorted
+    arrow::Int64Builder builder;
+    for (int64_t i = 0; i < rows; i++) {
+      REQUIRE(builder.Append(i / 100).ok());
+    }
+    auto sorted = arrow::Table::Make(arrow::schema({arrow::field("a", arrow::int64())}),
+                                     {builder.Finish().ValueOrDie()});
+    join::KeyStats stats;
+    CHECK_CYLON_STATUS(join::SampleKeyStats(sorted, {0}, &stats));
+    REQUIRE(stats.rows == rows);
+    REQUIRE(stats.sorted);
+    REQUIRE(stats.distinct == 100);
+
+    auto unique = arrow::Table::Make(arrow::schema({arrow::field("a", arrow::int64())}),
+                                     {gen.Numeric<arrow::Int64Type>(rows, 0, 1LL << 40, 0)});
+    CHECK_CYLON_STATUS(join::SampleKeyStats(unique, {0}, &stats));
+    REQUIRE_FALSE(stats.sorted);
+    REQUIRE(stats.distinct > rows / 2);
+
+    REQUIRE(join::ChooseJoinAlgorithm({rows, 0, 100, true}, {rows, 0, 100, true})
+                == join::config::SORT);
+    REQUIRE(join::ChooseJoinAlgorithm({rows, 0, 10, false}, {rows, 0, 10, false})
+                == join::config::SORT);
+    REQUIRE(join::ChooseJoinAlgorithm({rows, 0, rows, false}, {100, 0, 100, false})
+                == join::config::HASH);
+  }
+
+  SECTION("auto join matches hash join") {
+    // large left table and a small right table, which AUTO broadcasts
+    auto left_schema = arrow::schema({arrow::field("k", arrow::int64()),
+                                      arrow::field("v", arrow::float64())});
+    auto right_schema = arrow::schema({arrow::field("k", arrow::int64()),
+                                       arrow::field("w", arrow::int64())});
+    auto left_atable = arrow::Table::Make(left_schema, {gen.Numeric<arrow::Int64Type>(rows, 0, 200, 0.01),
+                                                        gen.Numeric<arrow::DoubleType>(rows, 0, 1, 0)});
+    auto right_atable = arrow::Table::Make(right_schema, {gen.Numeric<arrow::Int64Type>(20, 0, 200, 0),
+                                                          gen.Numeric<arrow::Int64Type>(20, 0, 10, 0)});
+    std::shared_ptr<Table> left, right;
+    CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, left_atable, left));
+    CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, right_atable, right));
+
+    for (const auto type: {join::config::INNER, join::config::LEFT, join::config::RIGHT,
+                           join::config::FULL_OUTER}) {
+      const join::config::JoinConfig hash_config(type, {0}, {0}, join::config::HASH, "l_", "r_");
+      std::shared_ptr<Table> expected, result;
+      CHECK_CYLON_STATUS(DistributedJoin(left, right, hash_config, expected));
+      CHECK_CYLON_STATUS(DistributedJoin(left, right, hash_config.WithAlgorithm(join::config::AUTO),
+                                         result));
+
+      // broadcast joins leave the rows of the large table in place
+      bool equal = false;
+      CHECK_CYLON_STATUS(DistributedEquals(expected, result, equal, /*ordered=*/false));
+      REQUIRE(equal);
+    }
+  }
+}
+
+TEST_CASE("Broadcast join testing", "[join]") {
+  std::string path1 = "../data/input/csv1_" + std::to_string(RANK) + ".csv";
+  std::string path2 = "../data/input/csv2_" + std::to_string(RANK) + ".csv";
+  std::shared_ptr<Table> table1, table2;
+
+  auto read_options = io::config::CSVReadOptions().UseThreads(false);
+  CHECK_CYLON_STATUS(FromCSV(ctx, std::vector<std::string>{path1, path2},
+                             std::vector<std::shared_ptr<Table> *>{&table1, &table2},
+                             read_options));
+
+  auto check_broadcast = [&](const join::config::JoinConfig &config) {
+    std::shared_ptr<Table> expected, result;
+    CHECK_CYLON_STATUS(DistributedJoin(table1, table2, config, expected));
+    auto broadcast_config = config;
+    broadcast_config.SetBroadcastHint(config.GetType() == join::config::RIGHT
+                                      ? join::config::BROADCAST_LEFT_TABLE
+                                      : join::config::BROADCAST_RIGHT_TABLE);
+    CHECK_CYLON_STATUS(DistributedJoin(table1, table2, broadcast_config, result));
+
+    bool equal = false;
+    CHECK_CYLON_STATUS(DistributedEquals(expected, result, equal, /*ordered=*/false));
+    REQUIRE(equal);
+  };
+
+  for (const auto type: {join::config::INNER, join::config::LEFT, join::config::RIGHT}) {
+    for (const auto algorithm: {join::config::SORT, join::config::HASH}) {
+      SECTION("hint join type " + std::to_string(type) + " algorithm " + std::to_string(algorithm)) {
+        check_broadcast(join::config::JoinConfig(type, {0}, {0}, algorithm, "l_", "r_"));
+      }
+    }
+  }
+
+  SECTION("invalid hint") {
+    if (WORLD_SZ == 1) {
+      // local joins ignore the hints
+      return;
+    }
+    auto config = join::config::JoinConfig::FullOuterJoin(0, 0, join::config::HASH);
+    config.SetBroadcastHint(join::config::BROADCAST_RIGHT_TABLE);
+    std::shared_ptr<Table> out;
+    REQUIRE(DistributedJoin(table1, table2, config, out).get_code() == Code::Invalid);
+
+    auto left_config = join::config::JoinConfig::LeftJoin(0, 0, join::config::HASH);
+    left_config.SetBroadcastHint(join::config::BROADCAST_LEFT_TABLE);
+    REQUIRE(DistributedJoin(table1, table2, left_config, out).get_code() == Code::Invalid);
+  }
+
+  SECTION("size threshold") {
+    const auto &config = join::config::JoinConfig::InnerJoin(0, 0, join::config::HASH, "l_", "r_");
+    std::shared_ptr<Table> expected, result;
+    CHECK_CYLON_STATUS(DistributedJoin(table1, table2, config, expected));
+
+    ctx->AddConfig(join::kBroadcastJoinThresholdConfig, std::to_string(1LL << 30));
+    auto status = DistributedJoin(table1, table2, config, result);
+    ctx->AddConfig(join::kBroadcastJoinThresholdConfig, "");
+    CHECK_CYLON_STATUS(status);
+
+    bool equal = false;
+    CHECK_CYLON_STATUS(DistributedEquals(expected, result, equal, /*ordered=*/false));
+    REQUIRE(equal);
+  }
+}
+
+TEST_CASE("Skew-aware join testing", "[join]") {
+  // half of the left rows have key 0
+  const int64_t left_rows = 2000, right_rows = 200;
+  arrow::Int64Builder left_keys, right_keys;
+  for (int64_t i = 0; i < left_rows; i++) {
+    REQUIRE(left_keys.Append(i % 2 == 0 ? 0 : RANK * left_rows + i).ok());
+  }
+  for (int64_t i = 0; i < right_rows; i++) {
+    REQUIRE(right_keys.Append(i < 4 ? 0 : RANK * left_rows + 2 * i + 1).ok());
+  }
+  RandomArrayGenerator gen(RANK);
+  auto left_atable = arrow::Table::Make(arrow::schema({arrow::field("k", arrow::int64()),
+                                                       arrow::field("v", arrow::float64())}),
+                                        {left_keys.Finish().ValueOrDie(),
+                                         gen.Numeric<arrow::DoubleType>(left_rows, 0, 1, 0)});
+  auto right_atable = arrow::Table::Make(arrow::schema({arrow::field("k", arrow::int64()),
+                                                        arrow::field("w", arrow::int64())}),
+                                         {right_keys.Finish().ValueOrDie(),
+                                          gen.Numeric<arrow::Int64Type>(right_rows, 0, 10, 0)});
+  std::shared_ptr<Table> left, right;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, left_atable, left));
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, right_atable, right));
+
+  auto max_rows = [&](const std::shared_ptr<Table> &table) {
+    std::shared_ptr<Scalar> max;
+    CHECK_CYLON_STATUS(ctx->GetCommunicator()->AllReduce(
+        Scalar::Make(std::make_shared<arrow::Int64Scalar>(table->Rows())), net::MAX, &max));
+    return std::static_pointer_cast<arrow::Int64Scalar>(max->data())->value;
+  };
+
+  for (const auto type: {join::config::INNER, join::config::LEFT, join::config::RIGHT,
+                         join::config::FULL_OUTER}) {
+    for (const auto algorithm: {join::config::SORT, join::config::HASH}) {
+      SECTION("join type " + std::to_string(type) + " algorithm " + std::to_string(algorithm)) {
+        const join::config::JoinConfig config(type, {0}, {0}, algorithm, "l_", "r_");
+        std::shared_ptr<Table> expected, result;
+        CHECK_CYLON_STATUS(DistributedJoin(left, right, config, expected));
+
+        ctx->AddConfig(kSkewAwareShuffleConfig, "true");
+        auto status = DistributedJoin(left, right, config, result);
+        ctx->AddConfig(kSkewAwareShuffleConfig, "");
+        CHECK_CYLON_STATUS(status);
+
+        bool equal = false;
+        CHECK_CYLON_STATUS(DistributedEquals(expected, result, equal, /*ordered=*/false));
+        REQUIRE(equal);
+
+        // the rows of key 0 are split among the workers
+        if (WORLD_SZ > 1 && (type == join::config::INNER || type == join::config::LEFT)) {
+          REQUIRE(max_rows(result) < max_rows(expected));
+        }
+      }
+    }
+  }
+}
+
+}
 }
-}
\ No newline at end of file
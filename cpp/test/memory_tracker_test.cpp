@@ -0,0 +1,109 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include "common/test_header.hpp"
+#include "cylon/ctx/memory_tracker.hpp"
+#include "test_arrow_utils.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+TEST_CASE("Test memory tracker") {
+  SECTION("tracker tree") {
+    MemoryTracker root("root", nullptr, arrow::default_memory_pool());
+    MemoryTracker child("child", &root, arrow::default_memory_pool());
+    root.SetLimit(150);
+
+    uint8_t *p1, *p2;
+    CHECK_ARROW_STATUS(child.Allocate(100, &p1));
+    REQUIRE(root.bytes_allocated() == 100);
+    REQUIRE(child.bytes_allocated() == 100);
+
+    // over the budget of the parent
+    REQUIRE(child.Allocate(100, &p2).IsOutOfMemory());
+    REQUIRE(child.Reallocate(100, 200, &p1).IsOutOfMemory());
+    REQUIRE(root.bytes_allocated() == 100);
+    REQUIRE(child.bytes_allocated() == 100);
+
+    CHECK_ARROW_STATUS(child.Reallocate(100, 50, &p1));
+    REQUIRE(root.bytes_allocated() == 50);
+    child.Free(p1, 50);
+    REQUIRE(root.bytes_allocated() == 0);
+    REQUIRE(child.bytes_allocated() == 0);
+    REQUIRE(root.max_memory() == 100);
+
+    child.ResetPeak();
+    REQUIRE(child.max_memory() == 0);
+  }
+
+  SECTION("current tracker per thread") {
+    MemoryTrackers trackers(arrow::default_memory_pool());
+    auto *join = trackers.Push("join");
+    REQUIRE(trackers.current() == join);
+
+    MemoryTracker *worker_outer = nullptr, *worker_inner = nullptr;
+    std::thread worker([&] {
+      // the worker does not see the operator of the main thread
+      worker_outer = trackers.current();
+      worker_inner = trackers.Push("sort");
+      trackers.Pop({worker_inner->path(), 0, 0, -1});
+    });
+    worker.join();
+    REQUIRE(worker_outer == trackers.root());
+    REQUIRE(worker_inner->path() == "sort");
+    REQUIRE(trackers.current() == join);
+
+    auto *shuffle = trackers.Push("shuffle");
+    REQUIRE(shuffle->path() == "join/shuffle");
+    trackers.Pop({shuffle->path(), 0, 0, -1});
+    trackers.Pop({join->path(), 0, 0, -1});
+    REQUIRE(trackers.current() == trackers.root());
+    const auto &report = trackers.report();
+    REQUIRE(report.back().op == "join");
+    REQUIRE(report[report.size() - 2].op == "join/shuffle");
+  }
+
+  SECTION("operator budgets") {
+    auto schema = arrow::schema({arrow::field("a", arrow::int64()),
+                                 arrow::field("b", arrow::int64())});
+    auto atable = TableFromJSON(schema, {R"([[3, 1], [1, 2], [2, 3], [1, 4], [3, 5]])"});
+    std::shared_ptr<Table> table, out;
+    CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+
+    ctx->AddConfig(kMemoryTrackingConfig, "true");
+    CHECK_CYLON_STATUS(Sort(table, {0, 1}, out, true));
+    const auto &report = ctx->GetMemoryReport();
+    REQUIRE(report.size() == 1);
+    REQUIRE(report[0].op == "sort");
+    REQUIRE(report[0].peak_bytes > 0);
+    REQUIRE(report[0].retained_bytes > 0);
+    REQUIRE(report[0].budget == -1);
+    REQUIRE(ctx->GetActiveMemoryTracker() == nullptr);
+    out.reset();
+
+    ctx->AddConfig(std::string(kMemoryBudgetConfig) + ".sort", "1");
+    const auto &status = Sort(table, {0, 1}, out, true);
+    REQUIRE(status.get_code() == Code::OutOfMemory);
+    REQUIRE(ctx->GetActiveMemoryTracker() == nullptr);
+
+    ctx->AddConfig(std::string(kMemoryBudgetConfig) + ".sort", "");
+    ctx->AddConfig(kMemoryTrackingConfig, "");
+  }
+}
+
+} // namespace test
+} // namespace cylon
@@ -0,0 +1,158 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "common/test_header.hpp"
+#include "cylon/ops/api/parallel_op.hpp"
+#include "cylon/util/macros.hpp"
+#include "test_arrow_utils.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+// forwards the tables to the children
+class ForwardOp : public Op {
+ public:
+  ForwardOp(const std::shared_ptr<CylonContext> &ctx, int id, const ResultsCallback &callback,
+            bool communication = false)
+      : Op(ctx, nullptr, id, callback), communication_(communication) {}
+
+  bool Execute(int tag, std::shared_ptr<Table> &table) override {
+    if (communication_ && std::this_thread::get_id() != caller) {
+      wrong_thread = true;
+    }
+    InsertToAllChildren(tag, table);
+    return true;
+  }
+
+  bool IsCommunicationOp() const override { return communication_; }
+
+  void OnParentsFinalized() override {}
+
+  bool Finalize() override { return true; }
+
+  std::thread::id caller = std::this_thread::get_id();
+  bool wrong_thread = false;
+
+ private:
+  bool communication_;
+};
+
+class HeadOp : public RootOp {
+ public:
+  HeadOp(const std::shared_ptr<CylonContext> &ctx, const ResultsCallback &callback,
+         int num_threads)
+      : RootOp(ctx, nullptr, 0, callback) {
+    auto execution = new ThreadPoolExecution(num_threads);
+    execution->AddOp(this);
+    SetExecution(execution);
+  }
+};
+
+TEST_CASE("Test thread pool execution") {
+  for (int num_threads: {1, 4}) {
+    SECTION("threads " + std::to_string(num_threads)) {
+      std::atomic<int> results{0};
+      const ResultsCallback callback = [&](int tag, const std::shared_ptr<Table> &table) {
+        CYLON_UNUSED(tag);
+        CYLON_UNUSED(table);
+        results++;
+      };
+
+      // head -> compute -> communication -> compute, for two branches
+      HeadOp head(ctx, callback, num_threads);
+      auto *execution = dynamic_cast<ThreadPoolExecution *>(head.GetExecution());
+      std::vector<ForwardOp *> comm_ops;
+      for (int branch = 0; branch < 2; branch++) {
+        std::unique_ptr<ForwardOp> first(new ForwardOp(ctx, 1 + 3 * branch, callback));
+        std::unique_ptr<ForwardOp> comm(new ForwardOp(ctx, 2 + 3 * branch, callback, true));
+        std::unique_ptr<ForwardOp> last(new ForwardOp(ctx, 3 + 3 * branch, callback));
+        head.AddChild(first.get());
+        first->AddChild(comm.get());
+        comm->AddChild(last.get());
+        comm_ops.push_back(comm.get());
+        // the execution deletes the ops added to it, other than the head
+        execution->AddOp(first.release());
+        execution->AddOp(comm.release());
+        execution->AddOp(last.release());
+      }
+
+      for (int i = 0; i < 100; i++) {
+        head.InsertTable(i, nullptr);
+      }
+      head.WaitForCompletion();
+
+      // every table reaches the leaves of both branches
+      REQUIRE(results == 200);
+      for (const auto *comm: comm_ops) {
+        REQUIRE_FALSE(comm->wrong_thread);
+      }
+    }
+  }
+}
+
+TEST_CASE("Test op queue backpressure") {
+  int results = 0;
+  const ResultsCallback callback = [&](int tag, const std::shared_ptr<Table> &table) {
+    CYLON_UNUSED(tag);
+    REQUIRE(table->Rows() == 1);
+    results++;
+  };
+
+  // source -> sink, where the sink holds at most 2 rows
+  ForwardOp source(ctx, 1, callback);
+  ForwardOp sink(ctx, 2, callback);
+  source.AddChild(&sink);
+  sink.SetQueueCapacity(2, 0);
+
+  const auto &schema = arrow::schema({arrow::field("a", arrow::int64())});
+  const auto &row = std::make_shared<Table>(
+      ctx, arrow::Table::Make(schema, {ArrayFromJSON(arrow::int64(), "[1]")}));
+  for (int i = 0; i < 5; i++) {
+    source.InsertTable(0, row);
+  }
+  REQUIRE(source.GetQueueMetrics().rows == 5);
+
+  // a table of the tag is forwarded per call, until the sink is full
+  for (int i = 0; i < 3; i++) {
+    source.IsComplete();
+  }
+  REQUIRE(sink.IsQueueFull(0));
+  auto metrics = source.GetQueueMetrics();
+  REQUIRE(metrics.tables == 3);
+  REQUIRE(metrics.rows == 3);
+  REQUIRE(metrics.max_rows == 5);
+  // counted once per call held back
+  REQUIRE(metrics.backpressure_count == 1);
+  REQUIRE(sink.GetQueueMetrics().rows == 2);
+
+  // draining the sink lets the source continue
+  while (results < 5) {
+    sink.IsComplete();
+    source.IsComplete();
+  }
+  REQUIRE(source.GetQueueMetrics().rows == 0);
+  metrics = sink.GetQueueMetrics();
+  REQUIRE(metrics.rows == 0);
+  REQUIRE(metrics.max_rows == 2);
+  REQUIRE(metrics.bytes == 0);
+  REQUIRE(metrics.max_bytes > 0);
+}
+
+} // namespace test
+} // namespace cylon
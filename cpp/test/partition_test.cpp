@@ -14,6 +14,7 @@
 
 #include "common/test_header.hpp"
 #include "test_utils.hpp"
+#include "test_arrow_utils.hpp"
 
 #include <cylon/partition/partition.hpp>
 #include <cylon/util/murmur3.hpp>
@@ -78,6 +79,51 @@ TEST_CASE("Partition testing", "[join]") {
     }
   }
 
+  SECTION("shuffle with row hashes test") {
+    std::shared_ptr<cylon::Table> expected;
+    status = cylon::Shuffle(table, {0, 1}, expected);
+    REQUIRE(status.is_ok());
+
+    std::shared_ptr<std::vector<uint32_t>> row_hashes;
+    status = cylon::Shuffle(table, {0, 1}, output, row_hashes);
+    REQUIRE(status.is_ok());
+    // the hidden hash column is removed
+    REQUIRE(output->get_table()->Equals(*expected->get_table()));
+
+    std::vector<uint32_t> hashes;
+    status = cylon::HashRows(output, {0, 1}, hashes);
+    REQUIRE(status.is_ok());
+    REQUIRE(*row_hashes == hashes);
+    for (uint32_t hash: hashes) {
+      REQUIRE(hash % WORLD_SZ == (uint32_t) RANK);
+    }
+  }
+
+  SECTION("hash partitions of 64 bit keys test") {
+    // values outside the uint32 range, and negative values
+    auto schema = arrow::schema({arrow::field("a", arrow::int64()),
+                                 arrow::field("b", arrow::uint64())});
+    auto atable = cylon::test::TableFromJSON(schema, {R"([[-1, 4294967296],
+                                                         [4294967301, 18446744073709551615],
+                                                         [-4294967299, 7],
+                                                         [null, 4294967297],
+                                                         [9223372036854775807, null]])"});
+    std::shared_ptr<cylon::Table> keys;
+    REQUIRE(cylon::Table::FromArrowTable(ctx, atable, keys).is_ok());
+
+    for (uint32_t num_partitions: {3u, 4u}) {
+      for (const std::vector<int32_t> &cols: {std::vector<int32_t>{0}, std::vector<int32_t>{1},
+                                              std::vector<int32_t>{0, 1}}) {
+        std::vector<uint32_t> partitions, count, hashes;
+        REQUIRE(cylon::MapToHashPartitions(keys, cols, num_partitions, partitions, count).is_ok());
+        REQUIRE(cylon::HashRows(keys, cols, hashes).is_ok());
+        for (int64_t i = 0; i < keys->Rows(); i++) {
+          REQUIRE(partitions[i] == hashes[i] % num_partitions);
+        }
+      }
+    }
+  }
+
   SECTION("range partition test") {
     std::vector<uint32_t> partitions, count;
     status = cylon::MapToSortPartitions(table, 0, WORLD_SZ, partitions, count, true, table->Rows(), WORLD_SZ);
@@ -104,7 +150,7 @@ TEST_CASE("Partition testing", "[join]") {
     status =
         cylon::DistributedSort(table, 0, output, true,
                                {(uint32_t)WORLD_SZ, (uint64_t)table->Rows(),
-                                SortOptions::REGULAR_SAMPLE});
+                                SortOptions::REGULAR_SAMPLE, 0, {}});
     REQUIRE((status.is_ok()));
 
     for (auto &arr: output->get_table()->column(0)->chunks()) {
@@ -138,7 +184,7 @@ TEST_CASE("Partition testing", "[join]") {
     output.reset();
 
     status = cylon::DistributedSort(table, {0, 1}, output, {true, false},
-                                    {(uint32_t)WORLD_SZ, (uint64_t)table->Rows(), SortOptions::REGULAR_SAMPLE});
+                                    {(uint32_t)WORLD_SZ, (uint64_t)table->Rows(), SortOptions::REGULAR_SAMPLE, 0, {}});
     REQUIRE((status.is_ok()));
 
     for (int c = 0; c < output->get_table()->column(0)->num_chunks(); c++) {
@@ -20,6 +20,9 @@
 #include <cylon/table.hpp>
 #include <cylon/util/arrow_utils.hpp>
 #include <cylon/compute/aggregates.hpp>
+#include <cylon/arrow/arrow_comparator.hpp>
+#include <cylon/arrow/arrow_radix_sort.hpp>
+#include <cylon/util/arrow_rand.hpp>
 
 #include "common/test_header.hpp"
 
@@ -77,6 +80,126 @@ TEST_CASE("sort testing", "[sort]") {
   }
 }
 
+TEST_CASE("multi-column sort testing", "[sort]") {
+  const int64_t rows = 10000;
+  RandomArrayGenerator gen(0);
+  // few distinct values, so that the later columns break the ties
+  auto schema = arrow::schema({arrow::field("a", arrow::int32()),
+                               arrow::field("b", arrow::float64()),
+                               arrow::field("c", arrow::utf8()),
+                               arrow::field("d", arrow::int64())});
+  auto atable = arrow::Table::Make(schema, {gen.Numeric<arrow::Int32Type>(rows, -5, 5, 0.1),
+                                            gen.Numeric<arrow::DoubleType>(rows, -2, 2, 0.1),
+                                            gen.String(rows, 0, 12, 0.1),
+                                            gen.Numeric<arrow::Int64Type>(rows, -100, 100, 0)});
+  std::shared_ptr<Table> table;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+
+  for (const auto &columns: std::vector<std::vector<int32_t>>{{0, 1}, {0, 2, 3}, {2, 0}, {1, 3}}) {
+    for (const bool asc: {true, false}) {
+      std::vector<bool> directions;
+      for (size_t i = 0; i < columns.size(); i++) {
+        directions.push_back(i % 2 == 0 ? asc : !asc);
+      }
+      REQUIRE(IsNormalizedKeySortSupported(atable, columns));
+
+      std::shared_ptr<Table> output;
+      CHECK_CYLON_STATUS(Sort(table, columns, output, directions));
+      REQUIRE(output->Rows() == rows);
+
+      std::vector<std::unique_ptr<ArrayIndexComparator>> comparators;
+      for (size_t i = 0; i < columns.size(); i++) {
+        std::unique_ptr<ArrayIndexComparator> comp;
+        CHECK_CYLON_STATUS(CreateArrayIndexComparator(
+            output->get_table()->column(columns[i])->chunk(0), &comp, directions[i]));
+        comparators.push_back(std::move(comp));
+      }
+      for (int64_t r = 0; r < rows - 1; r++) {
+        int res = 0;
+        for (size_t c = 0; c < comparators.size() && res == 0; c++) {
+          res = comparators[c]->compare(r, r + 1);
+        }
+        REQUIRE(res <= 0);
+      }
+    }
+  }
+}
+
+TEST_CASE("parallel sort testing", "[sort]") {
+  // large enough for the parallel paths to be used
+  const int64_t rows = 100000;
+  RandomArrayGenerator gen(0);
+  auto schema = arrow::schema({arrow::field("a", arrow::int32()),
+                               arrow::field("b", arrow::float64()),
+                               arrow::field("c", arrow::utf8()),
+                               arrow::field("d", arrow::int64())});
+  auto atable = arrow::Table::Make(schema, {gen.Numeric<arrow::Int32Type>(rows, -5, 5, 0.1),
+                                            gen.Numeric<arrow::DoubleType>(rows, -2, 2, 0.1),
+                                            gen.String(rows, 0, 12, 0.1),
+                                            gen.Numeric<arrow::Int64Type>(rows, -100, 100, 0)});
+  std::shared_ptr<Table> table;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+
+  for (const auto &columns: std::vector<std::vector<int32_t>>{{0}, {1}, {2}, {0, 1}, {2, 0, 3}}) {
+    for (const bool asc: {true, false}) {
+      std::vector<bool> directions;
+      for (size_t i = 0; i < columns.size(); i++) {
+        directions.push_back(i % 2 == 0 ? asc : !asc);
+      }
+
+      ctx->AddConfig(kSortThreadsConfig, "");
+      std::shared_ptr<Table> expected;
+      CHECK_CYLON_STATUS(Sort(table, columns, expected, directions));
+
+      for (const auto &threads: {"2", "4", "0"}) {
+        ctx->AddConfig(kSortThreadsConfig, threads);
+        std::shared_ptr<Table> output;
+        CHECK_CYLON_STATUS(Sort(table, columns, output, directions));
+        // the sort is stable, so the output is the same for any number of threads
+        REQUIRE(output->get_table()->Equals(*expected->get_table(), true));
+      }
+    }
+  }
+  ctx->AddConfig(kSortThreadsConfig, "");
+}
+
+TEST_CASE("chunked sort testing", "[sort]") {
+  const int64_t rows = 1000;
+  RandomArrayGenerator gen(0);
+  auto schema = arrow::schema({arrow::field("a", arrow::int32()),
+                               arrow::field("b", arrow::float64()),
+                               arrow::field("c", arrow::utf8())});
+  auto atable = arrow::Table::Make(schema, {gen.Numeric<arrow::Int32Type>(rows, -5, 5, 0.1),
+                                            gen.Numeric<arrow::DoubleType>(rows, -2, 2, 0.1),
+                                            gen.String(rows, 0, 12, 0.1)});
+  // uneven chunks, with an empty chunk in the middle
+  auto chunked = *arrow::ConcatenateTables({atable->Slice(0, 100), atable->Slice(100, 0),
+                                            atable->Slice(100, 637), atable->Slice(737)});
+  REQUIRE(chunked->column(0)->num_chunks() == 4);
+
+  std::shared_ptr<Table> table, chunked_table;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, chunked, chunked_table));
+
+  for (const auto &columns: std::vector<std::vector<int32_t>>{{0}, {2}, {0, 1}, {2, 0}, {0, 2, 1}}) {
+    std::vector<bool> directions(columns.size(), true);
+    directions[0] = false;
+
+    std::shared_ptr<Table> expected, output;
+    CHECK_CYLON_STATUS(Sort(table, columns, expected, directions));
+    CHECK_CYLON_STATUS(Sort(chunked_table, columns, output, directions));
+    REQUIRE(output->get_table()->Equals(*expected->get_table(), true));
+  }
+
+  SECTION("unique") {
+    std::shared_ptr<Table> expected, output;
+    CHECK_CYLON_STATUS(Unique(table, {0, 2}, expected));
+    CHECK_CYLON_STATUS(Unique(chunked_table, {0, 2}, output));
+    auto combined = *output->get_table()->CombineChunks();
+    REQUIRE(combined->Equals(*expected->get_table(), true));
+  }
+}
+
 }
 }
 
@@ -12,12 +12,28 @@
  * limitations under the License.
  */
 
+#include <atomic>
+
 #include "common/test_header.hpp"
 
-#include <arrow/testing/random.h>
 #include <cylon/compute/aggregates.hpp>
+#include <cylon/compute/predicate.hpp>
+#include <cylon/arrow/arrow_all_to_all.hpp>
 #include <cylon/util/arrow_rand.hpp>
 
+namespace {
+std::atomic<int64_t> isend_count{0};
+}  // namespace
+
+/**
+ * Counts the messages of the MPI channels
+ */
+extern "C" int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag,
+                         MPI_Comm comm, MPI_Request *request) {
+  isend_count.fetch_add(1, std::memory_order_relaxed);
+  return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
 namespace cylon {
 namespace test {
 
@@ -111,5 +127,255 @@ TEST_CASE("Test unique", "[table_ops]") {
   }
 }
 
+
+TEST_CASE("Test parallel unique", "[table_ops]") {
+  // large enough for the parallel path, with plenty of duplicates
+  const int64_t rows = 100000;
+  RandomArrayGenerator gen(ctx->GetRank());
+  auto schema = arrow::schema({arrow::field("a", arrow::int32()),
+                               arrow::field("b", arrow::utf8()),
+                               arrow::field("c", arrow::float64())});
+  auto atable = arrow::Table::Make(schema, {gen.Numeric<arrow::Int32Type>(rows, 0, 50, 0.1),
+                                            gen.String(rows, 0, 2, 0.1),
+                                            gen.Numeric<arrow::DoubleType>(rows, 0, 1, 0)});
+  std::shared_ptr<Table> in;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, in));
+
+  SECTION("local") {
+    for (const bool first: {true, false}) {
+      ctx->AddConfig(kUniqueThreadsConfig, "");
+      std::shared_ptr<Table> expected;
+      CHECK_CYLON_STATUS(Unique(in, {0, 1}, expected, first));
+
+      for (const auto &threads: {"2", "4", "0"}) {
+        ctx->AddConfig(kUniqueThreadsConfig, threads);
+        std::shared_ptr<Table> out;
+        CHECK_CYLON_STATUS(Unique(in, {0, 1}, out, first));
+        // the same rows are kept, in the same order, for any number of threads
+        CHECK_ARROW_EQUAL(expected->get_table(), out->get_table());
+      }
+    }
+  }
+
+  SECTION("distributed") {
+    std::shared_ptr<Table> projected, shuffled, expected, out;
+    CHECK_CYLON_STATUS(Project(in, {0, 1}, projected));
+    // without the local pre-dedup
+    CHECK_CYLON_STATUS(Shuffle(projected, {0, 1}, shuffled));
+    CHECK_CYLON_STATUS(Unique(shuffled, {0, 1}, expected));
+
+    for (const auto &threads: {"", "4"}) {
+      ctx->AddConfig(kUniqueThreadsConfig, threads);
+      CHECK_CYLON_STATUS(DistributedUnique(projected, {0, 1}, out));
+      bool result;
+      CHECK_CYLON_STATUS(Equals(expected, out, result, /*ordered=*/false));
+      REQUIRE(result);
+    }
+  }
+  ctx->AddConfig(kUniqueThreadsConfig, "");
+}
+
+TEST_CASE("Test predicate select", "[table_ops]") {
+  auto schema = ::arrow::schema({
+                                    {field("a", arrow::int32())},
+                                    {field("b", arrow::utf8())},
+                                });
+  auto table = TableFromJSON(schema, {R"([{"a": null, "b": "x"},
+                                     {"a": 1,    "b": "y"},
+                                     {"a": 3,    "b": null}
+                                    ])",
+                                      R"([{"a": 5, "b": "z"},
+                                     {"a": 2,    "b": "x"},
+                                     {"a": 4,    "b": "y"}
+                                    ])"});
+  std::shared_ptr<Table> in, out;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, table, in));
+
+  SECTION("compare") {
+    auto expected = TableFromJSON(schema, {R"([{"a": 3, "b": null},
+                                     {"a": 5, "b": "z"},
+                                     {"a": 4, "b": "y"}])"});
+    // literal is cast to the column type
+    const auto &pred = compute::Compare(0, compute::GREATER, arrow::MakeScalar(int64_t(2)));
+    CHECK_CYLON_STATUS(Select(in, *pred, out));
+    CHECK_ARROW_EQUAL(expected, out->get_table());
+  }
+
+  SECTION("and/or/not") {
+    auto expected = TableFromJSON(schema, {R"([{"a": null, "b": "x"},
+                                     {"a": 3, "b": null},
+                                     {"a": 2, "b": "x"}])"});
+    // (a >= 2 and a <= 3) or b == "x"
+    const auto &pred = compute::Or(
+        compute::And(compute::Compare(0, compute::GREATER_EQUAL, arrow::MakeScalar(2)),
+                     compute::Compare(0, compute::LESS_EQUAL, arrow::MakeScalar(3))),
+        compute::Compare(1, compute::EQUAL, arrow::MakeScalar("x")));
+    CHECK_CYLON_STATUS(Select(in, *pred, out));
+    CHECK_ARROW_EQUAL(expected, out->get_table());
+
+    // nulls do not satisfy comparisons, hence are selected by the negation
+    auto expected_not = TableFromJSON(schema, {R"([{"a": null, "b": "x"},
+                                     {"a": 1, "b": "y"},
+                                     {"a": 2, "b": "x"}])"});
+    CHECK_CYLON_STATUS(Select(in, *compute::Not(compute::Compare(0, compute::GREATER, arrow::MakeScalar(2))),
+                              out));
+    CHECK_ARROW_EQUAL(expected_not, out->get_table());
+  }
+
+  SECTION("is in") {
+    auto expected = TableFromJSON(schema, {R"([{"a": 1, "b": "y"},
+                                     {"a": 4, "b": "y"}])"});
+    const auto &pred = compute::IsIn(1, ArrayFromJSON(arrow::utf8(), R"(["y", null, "w"])"));
+    CHECK_CYLON_STATUS(Select(in, *pred, out));
+    CHECK_ARROW_EQUAL(expected, out->get_table());
+  }
+
+  SECTION("null checks") {
+    auto expected = TableFromJSON(schema, {R"([{"a": 3, "b": null}])"});
+    CHECK_CYLON_STATUS(Select(in, *compute::IsNull(1), out));
+    CHECK_ARROW_EQUAL(expected, out->get_table());
+
+    CHECK_CYLON_STATUS(Select(in, *compute::IsValid(0), out));
+    REQUIRE(out->Rows() == 5);
+  }
+
+  SECTION("invalid column") {
+    REQUIRE_FALSE(Select(in, *compute::IsNull(2), out).is_ok());
+  }
+}
+
+TEST_CASE("Test predicate select against selector function", "[table_ops]") {
+  // spans multiple batches, with a partial last batch
+  const int64_t rows = 10007;
+  auto schema = ::arrow::schema({{field("a", arrow::int64())}, {field("b", arrow::float64())}});
+  RandomArrayGenerator gen(0);
+  auto table = arrow::Table::Make(schema, {gen.Numeric<arrow::Int64Type>(rows, 0, 100, 0.1),
+                                           gen.Numeric<arrow::DoubleType>(rows, 0, 1, 0.1)});
+  std::shared_ptr<Table> in, expected, out;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, table, in));
+
+  std::vector<int64_t> in_list;
+  for (int64_t i = 0; i < 40; i += 2) {
+    in_list.push_back(i);
+  }
+  arrow::Int64Builder builder;
+  REQUIRE(builder.AppendValues(in_list).ok());
+  std::shared_ptr<arrow::Array> in_arr;
+  REQUIRE(builder.Finish(&in_arr).ok());
+
+  const auto &a = std::static_pointer_cast<arrow::Int64Array>(table->column(0)->chunk(0));
+  const auto &b = std::static_pointer_cast<arrow::DoubleArray>(table->column(1)->chunk(0));
+  CHECK_CYLON_STATUS(Select(in, [&](cylon::Row row) {
+    int64_t i = row.RowIndex();
+    bool in_set = a->IsValid(i)
+        && std::find(in_list.begin(), in_list.end(), a->Value(i)) != in_list.end();
+    bool b_lt = b->IsValid(i) && b->Value(i) < 0.5;
+    return in_set || (b_lt && a->IsValid(i) && a->Value(i) != 51);
+  }, expected));
+
+  const auto &pred = compute::Or(
+      compute::IsIn(0, in_arr),
+      compute::And(compute::Compare(1, compute::LESS, arrow::MakeScalar(0.5)),
+                   compute::Compare(0, compute::NOT_EQUAL, arrow::MakeScalar(int64_t(51)))));
+  CHECK_CYLON_STATUS(Select(in, *pred, out));
+  CHECK_ARROW_EQUAL(expected->get_table(), out->get_table());
+}
+
+
+/**
+ * Shuffles a random table on the keys with the configs set, and checks it against a shuffle with
+ * the default configs
+ * @param messages messages sent by this rank in the shuffle with the configs, over MPI
+ */
+void CheckShuffleWithConfigs(const std::vector<int> &keys,
+                             const std::vector<std::pair<std::string, std::string>> &configs,
+                             int64_t *messages = nullptr) {
+  const int64_t rows = 1000;
+  auto schema = ::arrow::schema({{field("a", arrow::int64())}, {field("b", arrow::utf8())},
+                                 {field("c", arrow::boolean())}, {field("d", arrow::float64())}});
+  RandomArrayGenerator gen(RANK);
+  auto table = arrow::Table::Make(schema, {gen.Numeric<arrow::Int64Type>(rows, 0, 100, 0.1),
+                                           gen.String(rows, 0, 10, 0.1),
+                                           gen.Boolean(rows, 0.5, 0.1),
+                                           gen.Numeric<arrow::DoubleType>(rows, 0, 1, 0)});
+  std::shared_ptr<Table> in, expected, out;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, table, in));
+  CHECK_CYLON_STATUS(Shuffle(in, keys, expected));
+
+  for (const auto &config: configs) {
+    ctx->AddConfig(config.first, config.second);
+  }
+  isend_count.store(0);
+  auto status = Shuffle(in, keys, out);
+  if (messages != nullptr) {
+    *messages = isend_count.load();
+  }
+  for (const auto &config: configs) {
+    ctx->AddConfig(config.first, "");
+  }
+  CHECK_CYLON_STATUS(status);
+
+  bool equal;
+  CHECK_CYLON_STATUS(Equals(expected, out, equal, /*ordered=*/false));
+  REQUIRE(equal);
+  CheckGlobalSumEqual<int64_t>(ctx, rows * WORLD_SZ, out->Rows());
+}
+
+/**
+ * Checks that packing the messages into eager packets sends fewer messages than the shuffle with
+ * the rest of the configs
+ */
+void CheckCoalescedShuffle(const std::string &eager_bytes,
+                           const std::vector<std::pair<std::string, std::string>> &configs) {
+  int64_t messages, coalesced_messages;
+  CheckShuffleWithConfigs({0}, configs, &messages);
+  auto coalesced_configs = configs;
+  coalesced_configs.emplace_back(kChannelEagerBytesConfig, eager_bytes);
+  CheckShuffleWithConfigs({0}, coalesced_configs, &coalesced_messages);
+
+  // only the MPI channel coalesces
+  if (ctx->GetCommType() == net::CommType::MPI) {
+    REQUIRE(coalesced_messages < messages);
+  }
+}
+
+TEST_CASE("Test pipelined shuffle", "[table_ops]") {
+  // a few rows per batch
+  CheckShuffleWithConfigs({0, 1}, {{kShuffleBatchBytesConfig, "256"}});
+}
+
+TEST_CASE("Test framed shuffle", "[table_ops]") {
+  SECTION("one frame per target") {
+    CheckShuffleWithConfigs({0, 1}, {{kArrowAllToAllFramesConfig, "true"}});
+  }
+  SECTION("many frames per target") {
+    CheckShuffleWithConfigs({0, 1}, {{kArrowAllToAllFramesConfig, "true"},
+                                     {kShuffleBatchBytesConfig, "256"}});
+  }
+}
+
+TEST_CASE("Test chunked shuffle", "[table_ops]") {
+  // buffers larger than the chunk size are sent as several messages (by the MPI channel)
+  SECTION("chunks smaller than the buffers") {
+    CheckShuffleWithConfigs({0}, {{kChannelMaxChunkBytesConfig, "100"}});
+  }
+  SECTION("chunks not aligned to the buffers") {
+    CheckShuffleWithConfigs({0}, {{kChannelMaxChunkBytesConfig, "7"}});
+  }
+}
+
+TEST_CASE("Test coalesced shuffle", "[table_ops]") {
+  // small buffers are packed with their headers, larger ones follow the packets (MPI channel)
+  SECTION("packets smaller than the buffers") {
+    CheckCoalescedShuffle("256", {});
+  }
+  SECTION("packets larger than the buffers") {
+    CheckCoalescedShuffle("65536", {});
+  }
+  SECTION("packets with chunked buffers") {
+    CheckCoalescedShuffle("256", {{kChannelMaxChunkBytesConfig, "512"}});
+  }
+}
+
 }
 }
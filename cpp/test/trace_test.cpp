@@ -0,0 +1,76 @@
+/*
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+
+#include "common/test_header.hpp"
+#include "cylon/util/trace.hpp"
+#include "test_arrow_utils.hpp"
+#include "test_macros.hpp"
+
+namespace cylon {
+namespace test {
+
+TEST_CASE("Test tracing") {
+  auto schema = arrow::schema({arrow::field("a", arrow::int64()),
+                               arrow::field("b", arrow::int64())});
+  auto atable = TableFromJSON(schema, {R"([[3, 1], [1, 2], [3, 1], [1, 4], [3, 5]])"});
+  std::shared_ptr<Table> table, out;
+  CHECK_CYLON_STATUS(Table::FromArrowTable(ctx, atable, table));
+
+  // nothing is recorded while tracing is disabled
+  trace::Clear();
+  CHECK_CYLON_STATUS(Unique(table, {0, 1}, out, true));
+  REQUIRE(trace::GetSpans().empty());
+
+  trace::SetEnabled(true);
+  CHECK_CYLON_STATUS(Unique(table, {0, 1}, out, true));
+  trace::SetEnabled(false);
+
+  const auto &spans = trace::GetSpans();
+  std::set<std::string> names;
+  for (const auto &span: spans) {
+    names.insert(span.name);
+    REQUIRE(span.duration_us >= 0);
+  }
+  REQUIRE(names == std::set<std::string>{"unique", "unique.hash", "unique.dedup", "unique.take"});
+
+  std::shared_ptr<Table> trace_table;
+  CHECK_CYLON_STATUS(trace::Gather(ctx, &trace_table));
+  REQUIRE(trace_table->Rows() == (int64_t) spans.size());
+
+  const std::string trace_path = "/tmp/cylon_trace_test.json";
+  CHECK_CYLON_STATUS(trace::WriteChromeTrace(trace_table, trace_path));
+  std::ifstream trace_file(trace_path);
+  std::string trace_json((std::istreambuf_iterator<char>(trace_file)), std::istreambuf_iterator<char>());
+  REQUIRE(trace_json.find("\"name\":\"unique.dedup\",\"ph\":\"X\"") != std::string::npos);
+
+  const std::string summary_path = "/tmp/cylon_trace_test.csv";
+  CHECK_CYLON_STATUS(trace::WriteSummary(trace_table, summary_path));
+  std::ifstream summary_file(summary_path);
+  std::string line;
+  std::getline(summary_file, line);
+  REQUIRE(line == "name,rank,count,total_us,max_us,bytes");
+  std::getline(summary_file, line);
+  REQUIRE(line.rfind("unique,0,1,", 0) == 0);
+
+  trace::Clear();
+  std::remove(trace_path.c_str());
+  std::remove(summary_path.c_str());
+}
+
+} // namespace test
+} // namespace cylon
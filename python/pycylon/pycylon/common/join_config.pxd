@@ -31,6 +31,7 @@ cdef extern from "../../../../cpp/src/cylon/join/join_config.hpp" namespace "cyl
     cdef enum CJoinAlgorithm "cylon::join::config::JoinAlgorithm":
         CSORT "cylon::join::config::JoinAlgorithm::SORT"
         CHASH "cylon::join::config::JoinAlgorithm::HASH"
+        CAUTO "cylon::join::config::JoinAlgorithm::AUTO"
 
 
 cdef extern from "../../../../cpp/src/cylon/join/join_config.hpp" namespace "cylon::join::config":
@@ -26,10 +26,12 @@ cpdef enum JoinType:
 cpdef enum JoinAlgorithm:
     SORT = CJoinAlgorithm.CSORT
     HASH = CJoinAlgorithm.CHASH
+    AUTO = CJoinAlgorithm.CAUTO
 
 StrToJoinAlgorithm = {
     'sort': CJoinAlgorithm.CSORT,
-    'hash': CJoinAlgorithm.CHASH
+    'hash': CJoinAlgorithm.CHASH,
+    'auto': CJoinAlgorithm.CAUTO
 }
 
 StrToJoinType = {
@@ -46,7 +48,7 @@ cdef class JoinConfig:
                   right_table_prefix: str = ""):
         """
         :param join_type: passed as a str from one of the ["inner","left","outer","right"]
-        :param join_algorithm: passed as a str from one of the ["sort", "hash"]
+        :param join_algorithm: passed as a str from one of the ["sort", "hash", "auto"]
         :param left_column_index: passed as a int (currently support joining a single column)
         :param right_column_index: passed as a int (currently support joining a single column)
         :return: None
@@ -0,0 +1,51 @@
+##
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+##
+
+# distutils: language = c++
+
+from libcpp.memory cimport shared_ptr
+from pyarrow.lib cimport CScalar as CArrowScalar
+from pyarrow.lib cimport CArray as CArrowArray
+
+cdef extern from "../../../../cpp/src/cylon/compute/predicate.hpp" namespace "cylon::compute":
+    cdef enum CCompareOp 'cylon::compute::CompareOp':
+        CEQUAL 'cylon::compute::EQUAL'
+        CNOT_EQUAL 'cylon::compute::NOT_EQUAL'
+        CLESS 'cylon::compute::LESS'
+        CLESS_EQUAL 'cylon::compute::LESS_EQUAL'
+        CGREATER 'cylon::compute::GREATER'
+        CGREATER_EQUAL 'cylon::compute::GREATER_EQUAL'
+
+    cdef cppclass CPredicate "cylon::compute::Predicate":
+        pass
+
+    shared_ptr[CPredicate] CCompare "cylon::compute::Compare"(int column, CCompareOp op,
+                                                             shared_ptr[CArrowScalar] value)
+
+    shared_ptr[CPredicate] CIsIn "cylon::compute::IsIn"(int column, shared_ptr[CArrowArray] values)
+
+    shared_ptr[CPredicate] CIsNull "cylon::compute::IsNull"(int column)
+
+    shared_ptr[CPredicate] CIsValid "cylon::compute::IsValid"(int column)
+
+    shared_ptr[CPredicate] CAnd "cylon::compute::And"(shared_ptr[CPredicate] left,
+                                                      shared_ptr[CPredicate] right)
+
+    shared_ptr[CPredicate] COr "cylon::compute::Or"(shared_ptr[CPredicate] left,
+                                                    shared_ptr[CPredicate] right)
+
+    shared_ptr[CPredicate] CNot "cylon::compute::Not"(shared_ptr[CPredicate] child)
+
+
+cdef shared_ptr[CPredicate] lower_predicate(expr, resolve_column) except *
@@ -0,0 +1,162 @@
+##
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+##
+
+# distutils: language = c++
+
+from libcpp.memory cimport shared_ptr
+from pyarrow.lib cimport CScalar as CArrowScalar
+from pyarrow.lib cimport CArray as CArrowArray
+from pyarrow.lib cimport pyarrow_unwrap_scalar, pyarrow_unwrap_array
+from pycylon.data.predicate cimport *
+
+import pyarrow as pa
+
+'''
+Vectorized filter predicates. Predicates are built in Python and lowered to the cylon C++
+predicate engine (cylon/compute/predicate.hpp) by Table.filter
+
+>>> from pycylon.data.predicate import col
+>>> tb.filter((col('a') > 5) & col('b').isin(['x', 'y']) | col('c').isnull())
+'''
+
+_COMPARE_OPS = {
+    'eq': CEQUAL,
+    'ne': CNOT_EQUAL,
+    'lt': CLESS,
+    'le': CLESS_EQUAL,
+    'gt': CGREATER,
+    'ge': CGREATER_EQUAL,
+}
+
+
+class Predicate:
+    '''
+    Filter predicate expression node. Combine predicates with &, | and ~
+    '''
+
+    def __init__(self, op, *args):
+        self.op = op
+        self.args = args
+
+    def __and__(self, other):
+        return Predicate('and', self, _check_predicate(other))
+
+    def __or__(self, other):
+        return Predicate('or', self, _check_predicate(other))
+
+    def __invert__(self):
+        return Predicate('not', self)
+
+    def __bool__(self):
+        raise ValueError("Predicates can not be used as booleans. Use &, | and ~ instead of "
+                         "and, or and not")
+
+    def __repr__(self):
+        return f"Predicate({self.op}, {', '.join(map(repr, self.args))})"
+
+
+class col:
+    '''
+    Column reference used to build filter predicates
+    Args:
+        column: column name or index
+    '''
+
+    def __init__(self, column):
+        if not isinstance(column, (str, int)):
+            raise ValueError("Column must be referred by its name or index")
+        self.column = column
+
+    def __eq__(self, value):
+        return Predicate('eq', self.column, value)
+
+    def __ne__(self, value):
+        return Predicate('ne', self.column, value)
+
+    def __lt__(self, value):
+        return Predicate('lt', self.column, value)
+
+    def __le__(self, value):
+        return Predicate('le', self.column, value)
+
+    def __gt__(self, value):
+        return Predicate('gt', self.column, value)
+
+    def __ge__(self, value):
+        return Predicate('ge', self.column, value)
+
+    def isin(self, values):
+        return Predicate('isin', self.column, values)
+
+    def isnull(self):
+        return Predicate('isnull', self.column)
+
+    def notnull(self):
+        return Predicate('notnull', self.column)
+
+    def __hash__(self):
+        return hash(self.column)
+
+    def __repr__(self):
+        return f"col({self.column!r})"
+
+
+def _check_predicate(other):
+    if not isinstance(other, Predicate):
+        raise ValueError(f"Expected a Predicate, found {type(other)}")
+    return other
+
+
+cdef shared_ptr[CPredicate] lower_predicate(expr, resolve_column) except *:
+    '''
+    Lowers a predicate expression to a C++ predicate
+    Args:
+        expr: Predicate
+        resolve_column: callable mapping a column name or index to a column index
+    '''
+    cdef shared_ptr[CArrowScalar] c_scalar
+    cdef shared_ptr[CArrowArray] c_array
+    cdef int column
+
+    op = _check_predicate(expr).op
+    if op == 'and':
+        return CAnd(lower_predicate(expr.args[0], resolve_column),
+                    lower_predicate(expr.args[1], resolve_column))
+    elif op == 'or':
+        return COr(lower_predicate(expr.args[0], resolve_column),
+                   lower_predicate(expr.args[1], resolve_column))
+    elif op == 'not':
+        return CNot(lower_predicate(expr.args[0], resolve_column))
+
+    column = resolve_column(expr.args[0])
+    if op in _COMPARE_OPS:
+        value = expr.args[1]
+        if not isinstance(value, pa.Scalar):
+            value = pa.scalar(value)
+        c_scalar = pyarrow_unwrap_scalar(value)
+        return CCompare(column, _COMPARE_OPS[op], c_scalar)
+    elif op == 'isin':
+        values = expr.args[1]
+        if isinstance(values, pa.ChunkedArray):
+            values = values.combine_chunks()
+        elif not isinstance(values, pa.Array):
+            values = pa.array(list(values))
+        c_array = pyarrow_unwrap_array(values)
+        return CIsIn(column, c_array)
+    elif op == 'isnull':
+        return CIsNull(column)
+    elif op == 'notnull':
+        return CIsValid(column)
+    else:
+        raise ValueError(f"Unsupported predicate operation {op}")
@@ -24,6 +24,7 @@ from libcpp.vector cimport vector
 from libc.stdint cimport int64_t
 from pycylon.ctx.context cimport CCylonContext
 from pycylon.indexing.cyindex cimport CBaseArrowIndex
+from pycylon.data.predicate cimport CPredicate
 
 
 cdef extern from "../../../../cpp/src/cylon/table.hpp" namespace "cylon":
@@ -71,6 +72,9 @@ cdef extern from "../../../../cpp/src/cylon/table.hpp" namespace "cylon":
     CStatus Project(shared_ptr[CTable] & table, const vector[int] & project_columns,
                     shared_ptr[ CTable] & output)
 
+    CStatus Select(const shared_ptr[CTable] & table, const CPredicate & predicate,
+                   shared_ptr[CTable] & output)
+
     CStatus Merge(vector[shared_ptr[CTable]] & tables, shared_ptr[CTable] output)
 
     CStatus Join(shared_ptr[CTable] & left, shared_ptr[CTable] & right,
@@ -129,6 +133,8 @@ cdef extern from "../../../../cpp/src/cylon/table.hpp" namespace "cylon":
     cdef cppclass CSortOptions "cylon::SortOptions":
         int num_bins
         long num_samples
+        int64_t memory_limit
+        string spill_dir
         @ staticmethod
         CSortOptions Defaults()
 
@@ -52,6 +52,8 @@ from pycylon.data.aggregates cimport CGroupByAggregationOp
 from pycylon.data.aggregates import AggregationOp, AggregationOpString
 from pycylon.data.groupby cimport (DistributedHashGroupBy, DistributedPipelineGroupBy, MapredHashGroupBy)
 from pycylon.data import compute
+from pycylon.data.predicate cimport CPredicate, lower_predicate
+from pycylon.data.predicate import Predicate
 
 from pycylon.index import RangeIndex, NumericIndex, range_calculator, process_index_by_value
 from pycylon.indexing.index_utils import IndexUtil
@@ -331,7 +333,7 @@ cdef class Table:
         Joins two PyCylon tables
         :param table: PyCylon table on which the join is performed (becomes the left table)
         :param join_type: Join Type as str ["inner", "left", "right", "outer"]
-        :param algorithm: Join Algorithm as str ["hash", "sort"]
+        :param algorithm: Join Algorithm as str ["hash", "sort", "auto"]
         :kwargs left_on: Join column of the left table as List[int] or List[str], right_on:
         Join column of the right table as List[int] or List[str], on: Join column in common with
         both tables as a List[int] or List[str].
@@ -357,7 +359,7 @@ cdef class Table:
          Joins two PyCylon tables in distributed memory
         :param table: PyCylon table on which the join is performed (becomes the left table)
         :param join_type: Join Type as str ["inner", "left", "right", "outer"]
-        :param algorithm: Join Algorithm as str ["hash", "sort"]
+        :param algorithm: Join Algorithm as str ["hash", "sort", "auto"]
         :kwargs left_on: Join column of the left table as List[int] or List[str], right_on:
         Join column of the right table as List[int] or List[str], on: Join column in common with
         both tables as a List[int] or List[str].
@@ -1156,9 +1158,38 @@ cdef class Table:
     #     @return: schema
     #     """
     #     pass
-    def filter(self, statement):
-        # TODO: Supported Added via: https://github.com/cylondata/cylon/issues/211
-        return statement
+    def filter(self, statement) -> Table:
+        '''
+        Filters the rows of the table
+        Args:
+            statement: a Predicate built from pycylon.data.predicate.col, or a boolean mask Table
+
+        Returns: PyCylon Table
+
+        Examples
+        --------
+        >>> from pycylon.data.predicate import col
+        >>> tb.filter((col('col-1') > 2) & ~col('col-2').isin([5, 6]))
+        '''
+        cdef shared_ptr[CPredicate] c_predicate
+        cdef shared_ptr[CTable] output
+        cdef CStatus status
+        if isinstance(statement, Predicate):
+            c_predicate = lower_predicate(statement, self._resolve_predicate_column)
+            status = Select(self.table_shd_ptr, c_predicate.get()[0], output)
+            if status.is_ok():
+                return pycylon_wrap_table(output)
+            else:
+                raise ValueError(f"Filter operation failed : {status.get_msg().decode()}")
+        elif isinstance(statement, Table):
+            return self._table_from_mask(statement)
+        else:
+            raise ValueError(f"Unsupported filter statement {type(statement)}")
+
+    def _resolve_predicate_column(self, column) -> int:
+        if isinstance(column, str):
+            return self._resolve_column_index_from_column_name(column)
+        return column
 
     def _table_from_mask(self, mask: Table) -> Table:
         '''
@@ -2523,7 +2554,7 @@ cdef class Table:
             tables: List of PyCylon Tables
             axis: 0:row-wise 1:column-wise
             join: 'inner' and 'outer'
-            algorithm: 'sort' or 'hash'
+            algorithm: 'sort', 'hash' or 'auto'
         Returns: PyCylon Table
 
         """
@@ -2553,7 +2584,7 @@ cdef class Table:
             tables: List of PyCylon Tables
             axis: 0:row-wise 1:column-wise
             join: 'inner' and 'outer'
-            algorithm: 'sort' or 'hash'
+            algorithm: 'sort', 'hash' or 'auto'
         Returns: PyCylon Table
 
         """
@@ -2728,12 +2759,16 @@ cdef class SortOptions:
     """
     Sort Operations for Distributed Sort
     """
-    def __cinit__(self, num_bins: int = 0, num_samples: int = 0):
+    def __cinit__(self, num_bins: int = 0, num_samples: int = 0, memory_limit: int = 0,
+                  spill_dir: str = None):
         '''
         Initializes the CSortOptions struct
         Args:
             num_bins: int
             num_samples: int
+            memory_limit: int, bytes of table data a worker may hold while sorting. Larger tables are
+            sorted in runs spilled to disk. 0 disables spilling
+            spill_dir: str, directory for the spilled runs. Defaults to $TMPDIR or /tmp
 
         Returns: None
 
@@ -2741,6 +2776,9 @@ cdef class SortOptions:
         self.thisPtr = new CSortOptions()
         self.thisPtr.num_bins = num_bins
         self.thisPtr.num_samples = num_samples
+        self.thisPtr.memory_limit = memory_limit
+        if spill_dir:
+            self.thisPtr.spill_dir = spill_dir.encode()
 
     cdef void init(self, CSortOptions *csort_options):
         self.thisPtr = csort_options
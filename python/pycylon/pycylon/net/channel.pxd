@@ -16,6 +16,7 @@
 Cython API Mapping for TwisterX C++ TxRequest for communication channels
 '''
 
+from libc.stdint cimport int64_t
 from libcpp.memory cimport shared_ptr
 from pycylon.net.txrequest cimport CTxRequest
 
@@ -27,5 +28,5 @@ cdef extern from "cylon/net/channel.hpp" namespace "cylon":
         void sendFinishComplete(shared_ptr[CTxRequest])
 
     cdef cppclass CChannelReceiveCallback "cylon::ChannelReceiveCallback":
-        void receivedData(int, void *, int)
+        void receivedData(int, void *, int64_t)
         void receivedHeader(int, int, int *, int)
@@ -16,18 +16,19 @@
 libCylon to PyCylon mapping for TxRequest API
 '''
 
+from libc.stdint cimport int64_t
 from libcpp.string cimport string
 
 cdef extern from "../../../../cpp/src/cylon/net/cylon_request.hpp" namespace "cylon":
     cdef cppclass CTxRequest "cylon::CylonRequest":
         void *buffer;
-        int length;
+        int64_t length;
         int target;
         int header[6];
         int headerLength;
         CTxRequest(int)
-        CTxRequest(int, void *, int)
-        CTxRequest(int, void *, int, int *, int)
+        CTxRequest(int, void *, int64_t)
+        CTxRequest(int, void *, int64_t, int *, int)
         void to_string(string, int)
 
 
@@ -271,9 +271,14 @@ def test_dist_io():
                                                    "python/pycylon/test/test_io.py"))
     assert responses[-1] == 0
 
+def test_predicate():
+    print("35. Predicate filter")
+    responses.append(os.system("pytest -q python/pycylon/test/test_predicate.py"))
+    assert responses[-1] == 0
+
 if os.environ.get('CYLON_GLOO'):
     def test_gloo():
-        print("35. Gloo")
+        print("36. Gloo")
         responses.append(os.system("python -m pytest python/pycylon/test/test_gloo.py"))
         assert responses[-1] == 0
 
@@ -0,0 +1,48 @@
+##
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+##
+
+'''
+Run test:
+>> pytest -q python/pycylon/test/test_predicate.py
+'''
+
+import pandas as pd
+import pycylon as cn
+from pycylon import CylonContext
+from pycylon.data.predicate import col
+
+
+def _filter_and_compare(cn_tb, df, predicate, pd_mask):
+    res = cn_tb.filter(predicate).to_pandas()
+    exp = df[pd_mask].reset_index(drop=True)
+    assert res.fillna(-1).values.tolist() == exp.fillna(-1).values.tolist()
+
+
+def test_filter_predicates():
+    ctx: CylonContext = CylonContext(config=None, distributed=False)
+    columns = ['col-1', 'col-2', 'col-3']
+    data = [[1, 2, 3, 4, 5, None], [6, 7, 8, 9, 10, 11], ['a', 'b', 'c', 'a', None, 'b']]
+    cn_tb = cn.Table.from_list(ctx, columns, data)
+    df = cn_tb.to_pandas()
+
+    _filter_and_compare(cn_tb, df, col('col-1') > 2, df['col-1'] > 2)
+    _filter_and_compare(cn_tb, df, col(1) <= 8, df['col-2'] <= 8)
+    _filter_and_compare(cn_tb, df, col('col-3') == 'a', df['col-3'] == 'a')
+    _filter_and_compare(cn_tb, df, (col('col-1') >= 2) & (col('col-2') != 9),
+                        (df['col-1'] >= 2) & (df['col-2'] != 9))
+    _filter_and_compare(cn_tb, df, (col('col-1') < 2) | col('col-3').isin(['b', 'c']),
+                        (df['col-1'] < 2) | df['col-3'].isin(['b', 'c']))
+    _filter_and_compare(cn_tb, df, ~(col('col-1') > 2), ~(df['col-1'] > 2))
+    _filter_and_compare(cn_tb, df, col('col-1').isnull(), df['col-1'].isnull())
+    _filter_and_compare(cn_tb, df, col('col-3').notnull(), df['col-3'].notnull())